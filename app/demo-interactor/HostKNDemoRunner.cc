@@ -7,13 +7,24 @@
 //---------------------------------------------------------------------------//
 #include "HostKNDemoRunner.hh"
 
+#include <algorithm>
 #include <iostream>
 #include <random>
+#include <vector>
+#include "celeritas_config.h"
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
+
 #include "base/ArrayUtils.hh"
+#include "base/CollectionAlgorithms.hh"
 #include "base/CollectionStateStore.hh"
 #include "base/Range.hh"
 #include "base/StackAllocator.hh"
 #include "base/Stopwatch.hh"
+#include "comm/KernelDiagnostics.hh"
+#include "comm/Tracer.hh"
+#include "random/PhiloxRngEngine.hh"
 #include "random/distributions/ExponentialDistribution.hh"
 #include "physics/base/ParticleTrackView.hh"
 #include "physics/base/Units.hh"
@@ -28,6 +39,62 @@ using celeritas::detail::KleinNishinaInteractor;
 
 namespace demo_interactor
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Maximum number of independently seeded blocks of tracks
+constexpr size_type max_num_blocks = 256;
+
+//! Number of tracks per block in reproducible mode
+constexpr size_type reproducible_block_size = 64;
+
+//---------------------------------------------------------------------------//
+int num_host_threads()
+{
+#if CELERITAS_USE_OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+int host_thread_id()
+{
+#if CELERITAS_USE_OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sum equal-sized blocks of values into the first block.
+ *
+ * Blocks are added pairwise in a tree whose shape depends only on the number
+ * of blocks, which gives the same rounding for any evaluation order and less
+ * rounding error than a sequential sum.
+ */
+void pairwise_sum_blocks(size_type       num_blocks,
+                         size_type       block_size,
+                         Span<real_type> values)
+{
+    CELER_EXPECT(values.size() == num_blocks * block_size);
+    for (size_type stride = 1; stride < num_blocks; stride *= 2)
+    {
+        for (size_type b = 0; b + stride < num_blocks; b += 2 * stride)
+        {
+            real_type*       dst = values.data() + b * block_size;
+            const real_type* src = dst + stride * block_size;
+            for (auto i : range(block_size))
+            {
+                dst[i] += src[i];
+            }
+        }
+    }
+}
+} // namespace
+
 //---------------------------------------------------------------------------//
 /*!
  * Construct with parameters.
@@ -51,6 +118,22 @@ HostKNDemoRunner::HostKNDemoRunner(constSPParticleParams particles,
 //---------------------------------------------------------------------------//
 /*!
  * Run given number of particles each for max steps.
+ *
+ * Tracks are divided into a fixed number of contiguous blocks, each of which
+ * has its own random number stream seeded from the run seed and block index.
+ * Blocks are dynamically scheduled across the host threads, each of which owns
+ * its particle state, secondary and hit buffers, and tally grid. The tally
+ * from each block is saved separately and the partial results are summed
+ * pairwise at the end, so the output for a given seed is independent of the
+ * number of threads.
+ *
+ * In reproducible mode, each step of each track instead draws from a
+ * counter-based stream keyed on the track and step numbers, and the blocks
+ * have a fixed number of tracks. A track's history then doesn't depend on
+ * which block or thread transports it, and the output depends only on the
+ * input. To bound the memory used by the block tallies, the blocks are
+ * transported in chunks of at most 256: the tallies of each chunk are summed
+ * pairwise and then added to the total in chunk order.
  */
 auto HostKNDemoRunner::operator()(demo_interactor::KNDemoRunArgs args)
     -> result_type
@@ -66,24 +149,10 @@ auto HostKNDemoRunner::operator()(demo_interactor::KNDemoRunArgs args)
 
     // Start timer for overall execution and transport-only time
     Stopwatch total_time;
-    double    transport_time = 0.0;
-
-    // Random number generations
-    std::mt19937 rng(args.seed);
-
-    // Particle data
-    ParticleStateData<Ownership::value, MemSpace::host> track_states;
-    resize(&track_states, pparams_->host_pointers(), 1);
-
-    // Make secondary store
-    StackAllocatorData<Secondary, Ownership::value, MemSpace::host> secondaries;
-    resize(&secondaries, args.max_steps);
 
     // Detector data
     DetectorParamsData detector_params;
     detector_params.tally_grid = args.tally_grid;
-    DetectorStateData<Ownership::value, MemSpace::host> detector_states;
-    resize(&detector_states, detector_params, args.max_steps);
 
     // Construct references
     ParamsHostRef params;
@@ -97,116 +166,139 @@ auto HostKNDemoRunner::operator()(demo_interactor::KNDemoRunArgs args)
     initial.particle = ParticleTrackState{kn_pointers_.gamma_id,
                                           units::MevEnergy{args.energy}};
 
-    StateHostRef state;
-    state.particle    = track_states;
-    state.secondaries = secondaries;
-    state.detector    = detector_states;
-
-    // Loop over particle tracks and events per track
-    for (CELER_MAYBE_UNUSED auto n : range(args.num_tracks))
+    // Partition tracks into blocks independently of the number of threads
+    const size_type num_blocks
+        = args.reproducible ? (args.num_tracks + reproducible_block_size - 1)
+                                  / reproducible_block_size
+                            : std::min(args.num_tracks, max_num_blocks);
+    const size_type tracks_per_block
+        = (args.num_tracks + num_blocks - 1) / num_blocks;
+    const size_type tally_size = detector_params.tally_grid.size;
+
+    // Per-block energy deposition for one chunk of blocks, total energy
+    // deposition, and per-thread living track counts
+    const size_type chunk_size = std::min(num_blocks, max_num_blocks);
+    std::vector<real_type>              block_edep(chunk_size * tally_size);
+    std::vector<real_type>              edep(tally_size, 0);
+    std::vector<std::vector<size_type>> thread_alive(num_host_threads());
+
+    Stopwatch elapsed_time;
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel
+#endif
     {
-        // Storage for track state
-        Real3     position  = {0, 0, 0};
-        Real3     direction = {0, 0, 1};
-        real_type time      = 0;
-        bool      alive     = true;
-
-        // Create and initialize particle view
-        ParticleTrackView particle(
-            params.particle, state.particle, ThreadId{0});
-
-        // Create helper classes
-        StackAllocator<Secondary> allocate_secondaries(state.secondaries);
-        Detector                  detector(params.detector, state.detector);
-        XsCalculator calc_xs(params.tables.xs, params.tables.reals);
-
-        CELER_ASSERT(state.secondaries.capacity() == args.max_steps);
-        CELER_ASSERT(state.detector.hit_buffer.capacity() == args.max_steps);
-        CELER_ASSERT(allocate_secondaries.get().size() == 0);
-        CELER_ASSERT(detector.num_hits() == 0);
-
-        // Counters
-        size_type num_steps       = 0;
-        auto      remaining_steps = args.max_steps;
-        Stopwatch elapsed_time;
-
-        particle = initial.particle;
-
-        while (alive && --remaining_steps > 0)
+        // Particle data
+        ParticleStateData<Ownership::value, MemSpace::host> track_states;
+        resize(&track_states, params.particle, 1);
+
+        // Make secondary store
+        StackAllocatorData<Secondary, Ownership::value, MemSpace::host>
+            secondaries;
+        resize(&secondaries, args.max_steps);
+
+        // Detector data
+        DetectorStateData<Ownership::value, MemSpace::host> detector_states;
+        resize(&detector_states, detector_params, args.max_steps);
+
+        StateHostRef state;
+        state.particle    = track_states;
+        state.secondaries = secondaries;
+        state.detector    = detector_states;
+
+        std::vector<size_type>& alive_counts
+            = thread_alive[host_thread_id()];
+        alive_counts.assign(result.alive.size(), 0);
+
+        for (size_type chunk_begin = 0; chunk_begin < num_blocks;
+             chunk_begin += chunk_size)
         {
-            // Increment alive counter
-            CELER_ASSERT(num_steps < result.alive.size());
-            result.alive[num_steps]++;
-            ++num_steps;
-
-            // Move to collision
-            demo_interactor::move_to_collision(
-                particle, calc_xs, direction, &position, &time, rng);
-
-            // Hit analysis
-            Hit h;
-            h.pos    = position;
-            h.dir    = direction;
-            h.thread = ThreadId(0);
-            h.time   = time;
-
-            // Check for below energy cutoff
-            if (particle.energy() < units::MevEnergy{0.01})
+            const size_type chunk_end
+                = std::min(chunk_begin + chunk_size, num_blocks);
+#if CELERITAS_USE_OPENMP
+#    pragma omp for schedule(dynamic)
+#endif
+            for (size_type b = chunk_begin; b < chunk_end; ++b)
             {
-                // Particle is below interaction energy
-                h.energy_deposited = particle.energy();
-
-                // Deposit energy and kill
-                detector.buffer_hit(h);
-                alive = false;
-                continue;
+                ScopedTrace trace_scope("transport_block");
+
+                const size_type end_track
+                    = std::min((b + 1) * tracks_per_block, args.num_tracks);
+                if (args.reproducible)
+                {
+                    for (size_type n = b * tracks_per_block; n < end_track;
+                         ++n)
+                    {
+                        // Random number generation, unique to each track step
+                        auto make_rng = [&args, n](size_type step) {
+                            return PhiloxRngEngine(args.seed, 0, n, step);
+                        };
+                        this->transport(params, state, initial, args.max_steps,
+                                        make_rng, make_span(alive_counts));
+                    }
+                }
+                else
+                {
+                    // Random number generation, unique to this block
+                    std::seed_seq seeds{args.seed,
+                                        static_cast<unsigned int>(b)};
+                    std::mt19937  rng(seeds);
+                    auto get_rng = [&rng](size_type) -> std::mt19937& {
+                        return rng;
+                    };
+                    for (size_type n = b * tracks_per_block; n < end_track;
+                         ++n)
+                    {
+                        this->transport(params, state, initial, args.max_steps,
+                                        get_rng, make_span(alive_counts));
+                    }
+                }
+
+                // Save the block's tally and reset the grid for the next block
+                auto tally
+                    = detector_states.tally_deposition[AllItems<real_type>{}];
+                std::copy(tally.begin(),
+                          tally.end(),
+                          block_edep.begin()
+                              + (b - chunk_begin) * tally_size);
+                fill(real_type(0), &detector_states.tally_deposition);
             }
 
-            // Construct the KN interactor
-            KleinNishinaInteractor interact(
-                kn_pointers_, particle, direction, allocate_secondaries);
-
-            // Perform interactions - emits a single particle
-            Interaction interaction = interact(rng);
-            CELER_ASSERT(interaction);
-            CELER_ASSERT(interaction.secondaries.size() == 1);
-
-            // Deposit energy from the secondary (all local)
+#if CELERITAS_USE_OPENMP
+#    pragma omp single
+#endif
             {
-                const auto& secondary = interaction.secondaries.front();
-                h.dir                 = secondary.direction;
-                h.energy_deposited    = secondary.energy;
-                detector.buffer_hit(h);
+                // Reduce the chunk's energy deposition in a fixed order
+                const size_type num_chunk_blocks = chunk_end - chunk_begin;
+                pairwise_sum_blocks(
+                    num_chunk_blocks,
+                    tally_size,
+                    make_span(block_edep)
+                        .subspan(0, num_chunk_blocks * tally_size));
+                for (auto i : range(tally_size))
+                {
+                    edep[i] += block_edep[i];
+                }
             }
-
-            // Update the energy and direction in the state from the
-            // interaction
-            direction = interaction.direction;
-            particle.energy(interaction.energy);
         }
-        CELER_ASSERT(num_steps < args.max_steps
-                         ? allocate_secondaries.get().size() == num_steps - 1
-                         : allocate_secondaries.get().size() == num_steps);
-        CELER_ASSERT(detector.num_hits() == num_steps);
-
-        // Store transport time
-        transport_time += elapsed_time();
+    }
+    const double transport_time = elapsed_time();
 
-        // Clear secondaries
-        allocate_secondaries.clear();
-        CELER_ASSERT(allocate_secondaries.get().size() == 0);
+    // Record the transport loop alongside device kernel diagnostics
+    static const auto stage_id = kernel_diagnostics().insert_host("transport");
+    kernel_diagnostics().launch_host(
+        stage_id, args.num_tracks, num_host_threads(), transport_time);
 
-        // Bin the tally results from the buffer onto the grid
-        for (auto hit_id : range(Detector::HitId{detector.num_hits()}))
+    // Reduce living track counts (exact) across threads
+    for (const auto& alive_counts : thread_alive)
+    {
+        for (auto i : range(alive_counts.size()))
         {
-            detector.process_hit(hit_id);
+            result.alive[i] += alive_counts[i];
         }
-        detector.clear_buffer();
     }
 
-    // Copy integrated energy deposition
-    result.edep.resize(detector_params.tally_grid.size);
-    demo_interactor::finalize(params, state, make_span(result.edep));
+    // Store integrated energy deposition
+    result.edep.assign(edep.begin(), edep.end());
 
     // Store timings
     result.time.push_back(transport_time);
@@ -221,5 +313,117 @@ auto HostKNDemoRunner::operator()(demo_interactor::KNDemoRunArgs args)
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Transport a single track to completion and tally its energy deposition.
+ *
+ * The random number engine for each step is obtained by calling \c make_rng
+ * with the step number.
+ */
+template<class MakeRng>
+void HostKNDemoRunner::transport(const ParamsHostRef&   params,
+                                 const StateHostRef&    state,
+                                 const InitialPointers& initial,
+                                 size_type              max_steps,
+                                 MakeRng&&              make_rng,
+                                 Span<size_type>        alive_counts) const
+{
+    // Storage for track state
+    Real3     position  = {0, 0, 0};
+    Real3     direction = {0, 0, 1};
+    real_type time      = 0;
+    bool      alive     = true;
+
+    // Create and initialize particle view
+    ParticleTrackView particle(params.particle, state.particle, ThreadId{0});
+
+    // Create helper classes
+    StackAllocator<Secondary> allocate_secondaries(state.secondaries);
+    Detector                  detector(params.detector, state.detector);
+    XsCalculator calc_xs(params.tables.xs, params.tables.reals);
+
+    CELER_ASSERT(state.secondaries.capacity() == max_steps);
+    CELER_ASSERT(state.detector.hit_buffer.capacity() == max_steps);
+    CELER_ASSERT(allocate_secondaries.get().size() == 0);
+    CELER_ASSERT(detector.num_hits() == 0);
+
+    // Counters
+    size_type num_steps       = 0;
+    auto      remaining_steps = max_steps;
+
+    particle = initial.particle;
+
+    while (alive && --remaining_steps > 0)
+    {
+        // Get the random number engine for this step
+        auto&& rng = make_rng(num_steps);
+
+        // Increment alive counter
+        CELER_ASSERT(num_steps < alive_counts.size());
+        alive_counts[num_steps]++;
+        ++num_steps;
+
+        // Move to collision
+        demo_interactor::move_to_collision(
+            particle, calc_xs, direction, &position, &time, rng);
+
+        // Hit analysis
+        Hit h;
+        h.pos    = position;
+        h.dir    = direction;
+        h.thread = ThreadId(0);
+        h.time   = time;
+
+        // Check for below energy cutoff
+        if (particle.energy() < units::MevEnergy{0.01})
+        {
+            // Particle is below interaction energy
+            h.energy_deposited = particle.energy();
+
+            // Deposit energy and kill
+            detector.buffer_hit(h);
+            alive = false;
+            continue;
+        }
+
+        // Construct the KN interactor
+        KleinNishinaInteractor interact(
+            params.kn_interactor, particle, direction, allocate_secondaries);
+
+        // Perform interactions - emits a single particle
+        Interaction interaction = interact(rng);
+        CELER_ASSERT(interaction);
+        CELER_ASSERT(interaction.secondaries.size() == 1);
+
+        // Deposit energy from the secondary (all local)
+        {
+            const auto& secondary = interaction.secondaries.front();
+            h.dir                 = secondary.direction;
+            h.energy_deposited    = secondary.energy;
+            detector.buffer_hit(h);
+        }
+
+        // Update the energy and direction in the state from the
+        // interaction
+        direction = interaction.direction;
+        particle.energy(interaction.energy);
+    }
+    CELER_ASSERT(num_steps < max_steps
+                     ? allocate_secondaries.get().size() == num_steps - 1
+                     : allocate_secondaries.get().size() == num_steps);
+    CELER_ASSERT(detector.num_hits() == num_steps);
+
+    // Clear secondaries
+    allocate_secondaries.clear();
+    CELER_ASSERT(allocate_secondaries.get().size() == 0);
+
+    // Bin the tally results from the buffer onto the grid
+    for (auto hit_id : range(Detector::HitId{detector.num_hits()}))
+    {
+        detector.process_hit(hit_id);
+    }
+    detector.clear_buffer();
+}
+
 //---------------------------------------------------------------------------//
 } // namespace demo_interactor
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include "base/Span.hh"
 #include "physics/base/ParticleParams.hh"
 #include "physics/base/ParticleInterface.hh"
 #include "physics/em/detail/KleinNishina.hh"
@@ -20,7 +21,13 @@ namespace demo_interactor
  * Run interactions on the host CPU.
  *
  * This is an analog to the demo_interactor::KNDemoRunner for device simulation
- * but does all the transport directly on the CPU side.
+ * but does all the transport directly on the CPU side. When built with OpenMP,
+ * blocks of tracks are transported in parallel on host threads.
+ *
+ * In reproducible mode, the random numbers for each step are a function of
+ * the seed, track, and step alone, and tracks are grouped in fixed-size
+ * blocks, so the output is bit-identical for any number of threads or
+ * scheduling of blocks.
  */
 class HostKNDemoRunner
 {
@@ -41,6 +48,16 @@ class HostKNDemoRunner
     // Run given number of particles
     result_type operator()(demo_interactor::KNDemoRunArgs args);
 
+  private:
+    // Transport a single track and bin its hits
+    template<class MakeRng>
+    void transport(const ParamsHostRef&       params,
+                   const StateHostRef&        state,
+                   const InitialPointers&     initial,
+                   size_type                  max_steps,
+                   MakeRng&&                  make_rng,
+                   celeritas::Span<size_type> alive_counts) const;
+
   private:
     constSPParticleParams                   pparams_;
     constSPXsGridParams                     xsparams_;
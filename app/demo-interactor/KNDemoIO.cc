@@ -16,13 +16,19 @@ namespace demo_interactor
 //! I/O routines for JSON
 void to_json(nlohmann::json& j, const CudaGridParams& v)
 {
-    j = nlohmann::json{{"block_size", v.block_size}, {"sync", v.sync}};
+    j = nlohmann::json{{"block_size", v.block_size},
+                       {"sync", v.sync},
+                       {"region_alloc", v.region_alloc}};
 }
 
 void from_json(const nlohmann::json& j, CudaGridParams& v)
 {
     j.at("block_size").get_to(v.block_size);
     j.at("sync").get_to(v.sync);
+    if (j.contains("region_alloc"))
+    {
+        j.at("region_alloc").get_to(v.region_alloc);
+    }
 }
 
 void to_json(nlohmann::json& j, const KNDemoRunArgs& v)
@@ -31,7 +37,8 @@ void to_json(nlohmann::json& j, const KNDemoRunArgs& v)
                        {"seed", v.seed},
                        {"num_tracks", v.num_tracks},
                        {"max_steps", v.max_steps},
-                       {"tally_grid", v.tally_grid}};
+                       {"tally_grid", v.tally_grid},
+                       {"reproducible", v.reproducible}};
 }
 
 void from_json(const nlohmann::json& j, KNDemoRunArgs& v)
@@ -41,6 +48,10 @@ void from_json(const nlohmann::json& j, KNDemoRunArgs& v)
     j.at("num_tracks").get_to(v.num_tracks);
     j.at("max_steps").get_to(v.max_steps);
     j.at("tally_grid").get_to(v.tally_grid);
+    if (j.contains("reproducible"))
+    {
+        j.at("reproducible").get_to(v.reproducible);
+    }
 }
 
 void to_json(nlohmann::json& j, const KNDemoResult& v)
@@ -29,6 +29,7 @@ struct KNDemoRunArgs
     size_type    num_tracks;
     size_type    max_steps;
     GridParams   tally_grid;
+    bool         reproducible = false; //!< Independent of thread count
 };
 
 //! Output from a single run
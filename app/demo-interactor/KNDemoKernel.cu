@@ -12,6 +12,7 @@
 #include "base/KernelParamCalculator.cuda.hh"
 #include "physics/base/ParticleTrackView.hh"
 #include "base/StackAllocator.hh"
+#include "base/detail/StackRegionCompactor.t.cuh"
 #include "physics/em/detail/KleinNishinaInteractor.hh"
 #include "random/RngEngine.hh"
 #include "physics/grid/XsCalculator.hh"
@@ -90,12 +91,14 @@ move_kernel(ParamsDeviceRef const params, StateDeviceRef const states)
  * - Allocates and emits a secondary
  * - Kills the secondary, depositing its local energy
  * - Applies the interaction (updating track direction and energy)
+ *
+ * If the secondary storage has private regions, each thread allocates from
+ * its own region instead of the shared stack.
  */
 __global__ void
 interact_kernel(ParamsDeviceRef const params, StateDeviceRef const states)
 {
-    StackAllocator<Secondary> allocate_secondaries(states.secondaries);
-    unsigned int              tid = blockIdx.x * blockDim.x + threadIdx.x;
+    unsigned int tid = blockIdx.x * blockDim.x + threadIdx.x;
 
     // Exit if out of range or already dead
     if (tid >= states.size() || !states.alive[tid])
@@ -127,6 +130,11 @@ interact_kernel(ParamsDeviceRef const params, StateDeviceRef const states)
     }
 
     // Construct RNG and interaction interfaces
+    StackAllocator<Secondary> allocate_secondaries
+        = states.secondaries.num_regions() > 0
+              ? StackAllocator<Secondary>(states.secondaries,
+                                          StackRegionId(tid))
+              : StackAllocator<Secondary>(states.secondaries);
     KleinNishinaInteractor interact(
         params.kn_interactor, particle, h.dir, allocate_secondaries);
 
@@ -226,6 +234,12 @@ void iterate(const CudaGridParams&  opts,
     // Perform the interaction
     CDE_LAUNCH_KERNEL(interact, opts.block_size, states.size(), params, states);
 
+    if (states.secondaries.num_regions() > 0)
+    {
+        // Move the secondaries onto the shared stack in thread order
+        compact_regions(states.secondaries);
+    }
+
     if (opts.sync)
     {
         // Synchronize for granular kernel timing diagnostics
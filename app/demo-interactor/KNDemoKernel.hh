@@ -29,8 +29,9 @@ using celeritas::Ownership;
 //! Kernel thread dimensions
 struct CudaGridParams
 {
-    unsigned int block_size = 256;   //!< Threads per block
-    bool         sync       = false; //!< Call synchronize after every kernel
+    unsigned int block_size   = 256;   //!< Threads per block
+    bool         sync         = false; //!< Call synchronize after every kernel
+    bool         region_alloc = false; //!< Allocate secondaries per thread
 };
 
 template<Ownership W, MemSpace M>
@@ -48,6 +48,9 @@ auto KNDemoRunner::operator()(KNDemoRunArgs args) -> result_type
 {
     CELER_EXPECT(args.energy > 0);
     CELER_EXPECT(args.num_tracks > 0);
+    CELER_VALIDATE(!args.reproducible,
+                   << "reproducible mode is only implemented for the host "
+                      "demo");
 
     // Initialize results
     result_type result;
@@ -73,9 +76,16 @@ auto KNDemoRunner::operator()(KNDemoRunArgs args) -> result_type
     rng_params.seed = args.seed;
     resize(&rng_states, make_const_ref(rng_params), args.num_tracks);
 
-    // Secondary data
+    // Secondary data: each interaction emits a single secondary
     StackAllocatorData<Secondary, Ownership::value, MemSpace::device> secondaries;
-    resize(&secondaries, args.num_tracks);
+    if (launch_params_.region_alloc)
+    {
+        resize(&secondaries, args.num_tracks, args.num_tracks, 1);
+    }
+    else
+    {
+        resize(&secondaries, args.num_tracks);
+    }
 
     // Detector data
     DetectorParamsData detector_params;
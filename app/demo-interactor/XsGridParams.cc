@@ -69,6 +69,16 @@ XsGridParams::XsGridParams(const Input& input)
     host_xs.value = make_builder(&host_data.reals)
                         .insert_back(input.xs.begin(), input.xs.end());
 
+    // Store grid energies to avoid recalculating them during transport
+    celeritas::UniformGrid            log_energy(host_xs.log_energy);
+    std::vector<celeritas::real_type> grid_energy(log_energy.size());
+    for (auto i : celeritas::range(log_energy.size()))
+    {
+        grid_energy[i] = std::exp(log_energy[i]);
+    }
+    host_xs.energy = make_builder(&host_data.reals)
+                         .insert_back(grid_energy.begin(), grid_energy.end());
+
     data_ = celeritas::CollectionMirror<TableData>(std::move(host_data));
 }
 
@@ -15,6 +15,7 @@
 #include <nlohmann/json.hpp>
 
 #include "celeritas_version.h"
+#include "base/CachingAllocatorIO.json.hh"
 #include "comm/Communicator.hh"
 #include "comm/Device.hh"
 #include "comm/DeviceIO.json.hh"
@@ -85,6 +86,7 @@ void run(std::istream& is)
                 {"version", std::string(celeritas_version)},
                 {"device", celeritas::device()},
                 {"kernels", celeritas::kernel_diagnostics()},
+                {"allocator", celeritas::device_allocator().stats()},
             },
         },
     };
@@ -0,0 +1,321 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file host-kn-benchmark.cc
+//---------------------------------------------------------------------------//
+
+#include <cstddef>
+#include <iostream>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+#include <nlohmann/json.hpp>
+
+#include "celeritas_version.h"
+#include "base/CollectionStateStore.hh"
+#include "base/Stopwatch.hh"
+#include "base/StackAllocator.hh"
+#include "comm/Communicator.hh"
+#include "comm/Logger.hh"
+#include "comm/ScopedMpiInit.hh"
+#include "physics/base/ParticleParams.hh"
+#include "physics/base/ParticleTrackView.hh"
+#include "physics/base/Secondary.hh"
+#include "physics/em/detail/KleinNishinaBatchInteractor.hh"
+#include "physics/em/detail/KleinNishinaInteractor.hh"
+#include "random/BufferedRngEngine.hh"
+
+using namespace celeritas;
+using celeritas::detail::KleinNishinaBatchInteractor;
+using celeritas::detail::KleinNishinaInteractor;
+using std::cerr;
+using std::cout;
+using std::endl;
+
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Benchmark options
+struct BenchmarkArgs
+{
+    double       energy{1};       //!< Incident photon energy [MeV]
+    size_type    num_tracks{};    //!< Photons per repetition
+    size_type    repeat{1};       //!< Number of timed repetitions
+    unsigned int seed{12345};     //!< Random number seed
+};
+
+void from_json(const nlohmann::json& j, BenchmarkArgs& v)
+{
+    j.at("energy").get_to(v.energy);
+    j.at("num_tracks").get_to(v.num_tracks);
+    if (j.contains("repeat"))
+    {
+        j.at("repeat").get_to(v.repeat);
+    }
+    if (j.contains("seed"))
+    {
+        j.at("seed").get_to(v.seed);
+    }
+}
+
+void to_json(nlohmann::json& j, const BenchmarkArgs& v)
+{
+    j = nlohmann::json{{"energy", v.energy},
+                       {"num_tracks", v.num_tracks},
+                       {"repeat", v.repeat},
+                       {"seed", v.seed}};
+}
+
+//---------------------------------------------------------------------------//
+//! Timing and a checksum of the outgoing energy for one method
+struct BenchmarkResult
+{
+    double time{0};     //!< Total wall time [s]
+    double rate{0};     //!< Interactions per second
+    double mean_eps{0}; //!< Mean outgoing energy fraction
+};
+
+void to_json(nlohmann::json& j, const BenchmarkResult& v)
+{
+    j = nlohmann::json{
+        {"time", v.time}, {"rate", v.rate}, {"mean_eps", v.mean_eps}};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct particle parameters.
+ */
+std::shared_ptr<ParticleParams> load_params()
+{
+    using namespace celeritas::units;
+    constexpr auto zero   = zero_quantity();
+    constexpr auto stable = ParticleDef::stable_decay_constant();
+
+    return std::make_shared<ParticleParams>(
+        ParticleParams::Input{{"electron",
+                               pdg::electron(),
+                               MevMass{0.5109989461},
+                               ElementaryCharge{-1},
+                               stable},
+                              {"gamma", pdg::gamma(), zero, zero, stable}});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample interactions one track at a time.
+ */
+BenchmarkResult run_scalar(const ParticleParams&               particles,
+                           const detail::KleinNishinaPointers& kn,
+                           const BenchmarkArgs&                args)
+{
+    CollectionStateStore<ParticleStateData, MemSpace::host> track_states(
+        particles, 1);
+    StackAllocatorData<Secondary, Ownership::value, MemSpace::host> secondaries;
+    resize(&secondaries, args.num_tracks);
+    StackAllocatorData<Secondary, Ownership::reference, MemSpace::host>
+        secondaries_ref;
+    secondaries_ref = secondaries;
+
+    ParticleTrackView particle(
+        particles.host_pointers(), track_states.ref(), ThreadId{0});
+    StackAllocator<Secondary> allocate_secondaries(secondaries_ref);
+    const ParticleTrackState  initial{kn.gamma_id,
+                                     units::MevEnergy{args.energy}};
+    const Real3               inc_direction{0, 0, 1};
+
+    std::mt19937    rng(args.seed);
+    BenchmarkResult result;
+    Stopwatch       elapsed_time;
+    for (size_type r = 0; r < args.repeat; ++r)
+    {
+        for (size_type i = 0; i < args.num_tracks; ++i)
+        {
+            particle = initial;
+            KleinNishinaInteractor interact(
+                kn, particle, inc_direction, allocate_secondaries);
+            Interaction interaction = interact(rng);
+            result.mean_eps += interaction.energy.value();
+        }
+        allocate_secondaries.clear();
+    }
+    result.time = elapsed_time();
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample interactions one track at a time using pregenerated random numbers.
+ *
+ * The time includes the bulk generation of the buffer for each repetition.
+ */
+BenchmarkResult run_buffered(const ParticleParams&               particles,
+                             const detail::KleinNishinaPointers& kn,
+                             const BenchmarkArgs&                args)
+{
+    CollectionStateStore<ParticleStateData, MemSpace::host> track_states(
+        particles, 1);
+    StackAllocatorData<Secondary, Ownership::value, MemSpace::host> secondaries;
+    resize(&secondaries, args.num_tracks);
+    StackAllocatorData<Secondary, Ownership::reference, MemSpace::host>
+        secondaries_ref;
+    secondaries_ref = secondaries;
+
+    // Enough values for a typical interaction without falling back
+    RngBufferData<Ownership::value, MemSpace::host> buffer;
+    resize(&buffer, args.num_tracks, 8);
+    RngBufferData<Ownership::reference, MemSpace::host> buffer_ref;
+    buffer_ref = buffer;
+    RngBufferData<Ownership::const_reference, MemSpace::host> buffer_cref;
+    buffer_cref = buffer;
+
+    ParticleTrackView particle(
+        particles.host_pointers(), track_states.ref(), ThreadId{0});
+    StackAllocator<Secondary> allocate_secondaries(secondaries_ref);
+    const ParticleTrackState  initial{kn.gamma_id,
+                                     units::MevEnergy{args.energy}};
+    const Real3               inc_direction{0, 0, 1};
+
+    std::mt19937    fallback_rng(args.seed);
+    BenchmarkResult result;
+    Stopwatch       elapsed_time;
+    for (size_type r = 0; r < args.repeat; ++r)
+    {
+        generate_uniforms(buffer_ref, args.seed, r);
+        for (size_type i = 0; i < args.num_tracks; ++i)
+        {
+            particle = initial;
+            BufferedRngEngine<std::mt19937> rng(
+                buffer_cref, ThreadId{i}, fallback_rng);
+            KleinNishinaInteractor interact(
+                kn, particle, inc_direction, allocate_secondaries);
+            Interaction interaction = interact(rng);
+            result.mean_eps += interaction.energy.value();
+        }
+        allocate_secondaries.clear();
+    }
+    result.time = elapsed_time();
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample interactions in blocks of tracks.
+ */
+BenchmarkResult run_batch(const detail::KleinNishinaPointers& kn,
+                          const BenchmarkArgs&                args)
+{
+    std::vector<real_type> energy(args.num_tracks, args.energy);
+    std::vector<Real3>     direction(args.num_tracks, Real3{0, 0, 1});
+    std::vector<real_type> out_energy(args.num_tracks);
+    std::vector<Real3>     out_direction(args.num_tracks);
+    std::vector<Secondary> electrons(args.num_tracks);
+
+    KleinNishinaBatchInteractor interact(
+        kn, make_span(energy), make_span(direction));
+    const KleinNishinaBatchInteractor::Output out{
+        make_span(out_energy), make_span(out_direction), make_span(electrons)};
+
+    std::mt19937    rng(args.seed);
+    BenchmarkResult result;
+    Stopwatch       elapsed_time;
+    for (size_type r = 0; r < args.repeat; ++r)
+    {
+        interact(rng, out);
+        for (real_type e : out_energy)
+        {
+            result.mean_eps += e;
+        }
+    }
+    result.time = elapsed_time();
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Run, launch, and output.
+ */
+void run(std::istream& is)
+{
+    auto inp  = nlohmann::json::parse(is);
+    auto args = inp.get<BenchmarkArgs>();
+    CELER_VALIDATE(args.energy > 0,
+                   << "invalid energy " << args.energy << " (must be positive)");
+    CELER_VALIDATE(args.num_tracks > 0 && args.repeat > 0,
+                   << "number of tracks and repetitions must be positive");
+
+    auto particles = load_params();
+
+    detail::KleinNishinaPointers kn;
+    kn.model_id    = ModelId{0}; // Unused but needed for error check
+    kn.electron_id = particles->find(pdg::electron());
+    kn.gamma_id    = particles->find(pdg::gamma());
+    kn.inv_electron_mass
+        = 1 / particles->get(kn.electron_id).mass().value();
+    CELER_ASSERT(kn);
+
+    const double num_samples = double(args.num_tracks) * args.repeat;
+    nlohmann::json results;
+    for (std::string method : {"scalar", "buffered", "batch"})
+    {
+        BenchmarkResult result
+            = (method == "scalar")     ? run_scalar(*particles, kn, args)
+              : (method == "buffered") ? run_buffered(*particles, kn, args)
+                                       : run_batch(kn, args);
+        result.rate = num_samples / result.time;
+        result.mean_eps /= num_samples * args.energy;
+        results[method] = result;
+    }
+
+    nlohmann::json outp = {
+        {"input", args},
+        {"block_size", KleinNishinaBatchInteractor::block_size()},
+        {"result", results},
+        {"runtime", {{"version", std::string(celeritas_version)}}},
+    };
+    cout << outp.dump() << endl;
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Execute and run.
+ */
+int main(int argc, char* argv[])
+{
+    ScopedMpiInit scoped_mpi(&argc, &argv);
+    if (ScopedMpiInit::status() == ScopedMpiInit::Status::initialized
+        && Communicator::comm_world().size() > 1)
+    {
+        CELER_LOG(critical) << "This app cannot run in parallel";
+        return EXIT_FAILURE;
+    }
+
+    // Process input arguments
+    std::vector<std::string> args(argv, argv + argc);
+    if (args.size() != 2 || args[1] == "--help" || args[1] == "-h")
+    {
+        cerr << "usage: " << args[0] << " {input}.json" << endl;
+        return EXIT_FAILURE;
+    }
+
+    if (args[1] != "-")
+    {
+        std::ifstream infile(args[1]);
+        if (!infile)
+        {
+            CELER_LOG(critical) << "Failed to open '" << args[1] << "'";
+            return EXIT_FAILURE;
+        }
+        run(infile);
+    }
+    else
+    {
+        // Read input from STDIN
+        run(std::cin);
+    }
+
+    return EXIT_SUCCESS;
+}
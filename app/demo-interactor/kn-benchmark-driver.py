@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# Copyright 2021 UT-Battelle, LLC and other Celeritas Developers.
+# See the top-level COPYRIGHT file for details.
+# SPDX-License-Identifier: (Apache-2.0 OR MIT)
+"""
+Compare scalar, buffered-RNG, and batched host Klein-Nishina sampling rates.
+"""
+import json
+import subprocess
+from os import environ
+from sys import exit
+
+inp = {
+    'energy': 1, # MeV
+    'num_tracks': 64 * 100 + 3,
+    'repeat': 4,
+    'seed': 12345,
+}
+
+exe = environ.get('CELERITAS_DEMO_EXE', './host-kn-benchmark')
+
+print("Input:")
+print(json.dumps(inp, indent=1))
+
+print("Running", exe)
+result = subprocess.run([exe, '-'],
+                        input=json.dumps(inp).encode(),
+                        stdout=subprocess.PIPE)
+
+if result.returncode:
+    print("fatal: run failed with error", result.returncode)
+    exit(result.returncode)
+
+out_text = result.stdout.decode()
+try:
+    out = json.loads(out_text)
+except json.decoder.JSONDecodeError as e:
+    print("error: expected a JSON object but got the following stdout:")
+    print(out_text)
+    print("fatal:", str(e))
+    exit(1)
+
+with open(f'{exe}.out.json', 'w') as f:
+    json.dump(out, f, indent=1)
+
+result = out['result']
+for method in ['scalar', 'buffered', 'batch']:
+    r = result[method]
+    print("{:>8s}: {:.3e} interactions/s (mean eps = {:.4f})".format(
+        method, r['rate'], r['mean_eps']))
+for method in ['buffered', 'batch']:
+    print("{} speedup: {:.2f}".format(
+        method, result[method]['rate'] / result['scalar']['rate']))
+
+# All methods sample the same distribution
+for method in ['buffered', 'batch']:
+    if abs(result[method]['mean_eps'] - result['scalar']['mean_eps']) > 0.01:
+        print(f"fatal: scalar and {method} mean energies differ")
+        exit(1)
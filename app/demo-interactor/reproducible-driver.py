@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+# Copyright 2021 UT-Battelle, LLC and other Celeritas Developers.
+# See the top-level COPYRIGHT file for details.
+# SPDX-License-Identifier: (Apache-2.0 OR MIT)
+"""
+Check that the reproducible host demo gives identical output for different
+numbers of threads.
+"""
+import json
+import subprocess
+from os import environ
+from sys import exit
+
+inp = {
+    'grid_params': {
+        'block_size': 128,
+        'sync': False,
+    },
+    'run': {
+        'seed': 12345,
+        'energy': 10, # MeV
+        # More than one chunk of 256 blocks of 64 tracks, with a partial block
+        'num_tracks': 64 * 300 + 17,
+        'max_steps': 128,
+        'tally_grid': {
+            'size': 1024,
+            'front': -1,
+            'delta': .25,
+        },
+        'reproducible': True,
+    }
+}
+
+exe = environ.get('CELERITAS_DEMO_EXE', './host-demo-interactor')
+
+print("Input:")
+print(json.dumps(inp, indent=1))
+
+def run(num_threads):
+    print("Running", exe, "with", num_threads, "threads")
+    env = dict(environ)
+    env['OMP_NUM_THREADS'] = str(num_threads)
+    result = subprocess.run([exe, '-'],
+                            input=json.dumps(inp).encode(),
+                            stdout=subprocess.PIPE,
+                            env=env)
+    if result.returncode:
+        print("fatal: run failed with error", result.returncode)
+        exit(result.returncode)
+
+    out_text = result.stdout.decode()
+    try:
+        out = json.loads(out_text)
+    except json.decoder.JSONDecodeError as e:
+        print("error: expected a JSON object but got the following stdout:")
+        print(out_text)
+        print("fatal:", str(e))
+        exit(1)
+
+    with open(f'{exe}.reproducible-{num_threads}.out.json', 'w') as f:
+        json.dump(out, f, indent=1)
+    return out['result']
+
+results = {n: run(n) for n in [1, 4]}
+for key in ['alive', 'edep']:
+    if results[1][key] != results[4][key]:
+        print(f"fatal: {key} differs between 1 and 4 threads")
+        exit(1)
+print("Energy deposition is identical for 1 and 4 threads (total",
+      sum(results[1]['edep']), "MeV)")
@@ -29,6 +29,8 @@ inp = {
 }
 
 exe = environ.get('CELERITAS_DEMO_EXE', './demo-interactor')
+if environ.get('CELERITAS_DEMO_REGION_ALLOC'):
+    inp['grid_params']['region_alloc'] = True
 
 print("Input:")
 with open(f'{exe}.inp.json', 'w') as f:
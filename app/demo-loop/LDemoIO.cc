@@ -7,11 +7,52 @@
 //---------------------------------------------------------------------------//
 #include "LDemoIO.hh"
 
+#include "base/Assert.hh"
+#include "base/CollectionMemoryIO.json.hh"
+#include "random/RngCounterIO.json.hh"
+
 namespace demo_loop
 {
+//---------------------------------------------------------------------------//
+/*!
+ * Get a string corresponding to an event split.
+ */
+const char* to_cstring(EventSplit value)
+{
+    static const char* const strings[] = {
+        "block",
+        "cyclic",
+        "dynamic",
+    };
+    CELER_EXPECT(static_cast<unsigned int>(value) * sizeof(const char*)
+                 < sizeof(strings));
+    return strings[static_cast<unsigned int>(value)];
+}
+
 //---------------------------------------------------------------------------//
 //!@{
 //! I/O routines for JSON
+void to_json(nlohmann::json& j, const EventSplit& v)
+{
+    j = to_cstring(v);
+}
+
+void from_json(const nlohmann::json& j, EventSplit& v)
+{
+    const auto str   = j.get<std::string>();
+    bool       found = false;
+    for (auto split :
+         {EventSplit::block, EventSplit::cyclic, EventSplit::dynamic})
+    {
+        if (str == to_cstring(split))
+        {
+            v     = split;
+            found = true;
+        }
+    }
+    CELER_VALIDATE(found, << "invalid event split '" << str << "'");
+}
+
 void to_json(nlohmann::json& j, const LDemoArgs& v)
 {
     j = nlohmann::json{{"geometry_filename", v.geometry_filename},
@@ -19,7 +60,13 @@ void to_json(nlohmann::json& j, const LDemoArgs& v)
                        {"hepmc3_filename", v.hepmc3_filename},
                        {"seed", v.seed},
                        {"max_num_tracks", v.max_num_tracks},
-                       {"max_steps", v.max_steps}};
+                       {"max_steps", v.max_steps},
+                       {"fused_step", v.fused_step},
+                       {"memory_budget", v.memory_budget},
+                       {"count_rng_draws", v.count_rng_draws},
+                       {"event_split", v.event_split},
+                       {"event_batch_size", v.event_batch_size},
+                       {"share_params", v.share_params}};
 }
 
 void from_json(const nlohmann::json& j, LDemoArgs& v)
@@ -30,6 +77,30 @@ void from_json(const nlohmann::json& j, LDemoArgs& v)
     j.at("seed").get_to(v.seed);
     j.at("max_num_tracks").get_to(v.max_num_tracks);
     j.at("max_steps").get_to(v.max_steps);
+    if (j.contains("fused_step"))
+    {
+        j.at("fused_step").get_to(v.fused_step);
+    }
+    if (j.contains("memory_budget"))
+    {
+        j.at("memory_budget").get_to(v.memory_budget);
+    }
+    if (j.contains("count_rng_draws"))
+    {
+        j.at("count_rng_draws").get_to(v.count_rng_draws);
+    }
+    if (j.contains("event_split"))
+    {
+        j.at("event_split").get_to(v.event_split);
+    }
+    if (j.contains("event_batch_size"))
+    {
+        j.at("event_batch_size").get_to(v.event_batch_size);
+    }
+    if (j.contains("share_params"))
+    {
+        j.at("share_params").get_to(v.share_params);
+    }
 }
 
 void to_json(nlohmann::json& j, const LDemoResult& v)
@@ -37,7 +108,19 @@ void to_json(nlohmann::json& j, const LDemoResult& v)
     j = nlohmann::json{{"time", v.time},
                        {"alive", v.alive},
                        {"edep", v.edep},
-                       {"total_time", v.total_time}};
+                       {"total_time", v.total_time},
+                       {"num_ranks", v.num_ranks},
+                       {"num_events", v.num_events},
+                       {"num_primaries", v.num_primaries},
+                       {"events_per_rank", v.events_per_rank},
+                       {"idle_time", v.idle_time},
+                       {"memory",
+                        {{"params", v.params_memory},
+                         {"state", v.state_memory},
+                         {"excluded", v.excluded_memory},
+                         {"bytes_per_track", v.bytes_per_track},
+                         {"max_num_tracks", v.max_num_tracks}}},
+                       {"rng_draws", v.rng_draws}};
 }
 //!@}
 
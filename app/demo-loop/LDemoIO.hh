@@ -7,12 +7,34 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <cstddef>
+#include <map>
+#include <string>
 #include <vector>
 #include <nlohmann/json.hpp>
+#include "base/CollectionMemory.hh"
 #include "base/Types.hh"
+#include "random/RngCounterInterface.hh"
 
 namespace demo_loop
 {
+//---------------------------------------------------------------------------//
+/*!
+ * Assignment of events to MPI processes.
+ *
+ * A block split gives each process a contiguous range of events; a cyclic
+ * split deals the events round-robin, which better balances the load when
+ * the event size is correlated with its position in the input file. A
+ * dynamic split hands out batches of events to processes as they run low on
+ * work.
+ */
+enum class EventSplit
+{
+    block,
+    cyclic,
+    dynamic,
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Input for a single run.
@@ -30,13 +52,21 @@ struct LDemoArgs
     unsigned int seed{};
     size_type    max_num_tracks{};
     size_type    max_steps{};
+    bool         fused_step{false};      //!< Combine pre/along/post-step
+    std::size_t  memory_budget{};        //!< Bytes for params and states
+    bool         count_rng_draws{false}; //!< Tally random draws per model
+
+    // Parallel decomposition
+    EventSplit event_split{EventSplit::cyclic}; //!< Events per process
+    size_type  event_batch_size{1};             //!< Events per request
+    bool       share_params{false};             //!< One params copy per node
 
     //! Whether the run arguments are valid
     explicit operator bool() const
     {
         return !geometry_filename.empty() && !physics_filename.empty()
                && !hepmc3_filename.empty() && max_num_tracks > 0
-               && max_steps > 0;
+               && max_steps > 0 && event_batch_size > 0;
     }
 };
 
@@ -52,8 +82,33 @@ struct LDemoResult
     std::vector<size_type> alive; //!< Num living tracks per step
     std::vector<double>    edep;  //!< Energy deposition along the grid
     double                 total_time = 0; //!< All time
+
+    // Event decomposition
+    int       num_ranks     = 1; //!< Number of MPI processes
+    size_type num_events    = 0; //!< Events transported by all processes
+    size_type num_primaries = 0; //!< Primaries from all events
+
+    std::vector<size_type> events_per_rank; //!< Events on each process
+    std::vector<double>    idle_time;       //!< Time waiting on each process
+
+    // Memory usage
+    celeritas::CollectionMemory params_memory;   //!< Shared problem data
+    celeritas::CollectionMemory state_memory;    //!< Track states
+    std::vector<std::string>    excluded_memory; //!< Params not counted
+
+    double    bytes_per_track = 0; //!< State bytes per track slot
+    size_type max_num_tracks  = 0; //!< Track slots that fit the memory budget
+
+    //! Random draws per interaction for each model (if counted)
+    std::map<std::string, celeritas::RngCounterStats> rng_draws;
 };
 
+// Get a string corresponding to an event split
+const char* to_cstring(EventSplit value);
+
+void to_json(nlohmann::json& j, const EventSplit& value);
+void from_json(const nlohmann::json& j, EventSplit& value);
+
 void to_json(nlohmann::json& j, const LDemoArgs& value);
 void from_json(const nlohmann::json& j, LDemoArgs& value);
 
@@ -16,6 +16,7 @@
 #include "physics/base/PhysicsInterface.hh"
 #include "physics/base/Secondary.hh"
 #include "physics/material/MaterialInterface.hh"
+#include "random/RngCounterInterface.hh"
 #include "random/RngInterface.hh"
 #include "sim/SimInterface.hh"
 
@@ -75,6 +76,18 @@ struct ParamsData
         rng       = other.rng;
         return *this;
     }
+
+    //! Visit each collection and nested group
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        // Geometry and RNG params don't use collections
+        visit("geo_mats", geo_mats);
+        visit("materials", materials);
+        visit("particles", particles);
+        visit("cutoffs", cutoffs);
+        visit("physics", physics);
+    }
 };
 
 //---------------------------------------------------------------------------//
@@ -101,6 +114,9 @@ struct StateData
     Items<real_type>              energy_deposition;
     Items<celeritas::Interaction> interactions;
 
+    // Optional diagnostics
+    celeritas::RngCounterData<W, M> rng_counters;
+
     //! Number of state elements
     CELER_FUNCTION celeritas::size_type size() const
     {
@@ -130,13 +146,36 @@ struct StateData
         step_length       = other.step_length;
         energy_deposition = other.energy_deposition;
         interactions      = other.interactions;
+        if (other.rng_counters)
+        {
+            rng_counters = other.rng_counters;
+        }
         return *this;
     }
+
+    //! Visit each collection and nested group
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("geometry", geometry);
+        visit("materials", materials);
+        visit("particles", particles);
+        visit("physics", physics);
+        visit("rng", rng);
+        visit("sim", sim);
+        visit("secondaries", secondaries);
+        visit("step_length", step_length);
+        visit("energy_deposition", energy_deposition);
+        visit("interactions", interactions);
+        visit("rng_counters", rng_counters);
+    }
 };
 
 using ParamsDeviceRef
     = ParamsData<Ownership::const_reference, MemSpace::device>;
 using StateDeviceRef = StateData<Ownership::reference, MemSpace::device>;
+using ParamsHostRef = ParamsData<Ownership::const_reference, MemSpace::host>;
+using StateHostRef  = StateData<Ownership::reference, MemSpace::host>;
 
 #ifndef __CUDA_ARCH__
 //---------------------------------------------------------------------------//
@@ -0,0 +1,151 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file LDemoKernel.cc
+//---------------------------------------------------------------------------//
+#include "LDemoKernel.hh"
+
+#include "celeritas_config.h"
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
+
+#include "comm/KernelDiagnostics.hh"
+#include "comm/Tracer.hh"
+#include "LDemoLauncher.hh"
+
+using namespace celeritas;
+
+namespace demo_loop
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+int host_thread_id()
+{
+#if CELERITAS_USE_OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Apply a launcher to every track slot on the host.
+ *
+ * Track slots are statically partitioned across OpenMP threads, matching the
+ * first-touch placement of large host state allocations. Each thread samples
+ * from its own engine. The stage timing is recorded in the kernel
+ * diagnostics under the given name, and the work of each thread is added to
+ * the timeline of the global tracer.
+ */
+template<template<MemSpace> class L>
+void launch_host(const char*          name,
+                 const ParamsHostRef& params,
+                 const StateHostRef&  states,
+                 Span<HostRng>        rngs)
+{
+    CELER_EXPECT(rngs.size() >= static_cast<std::size_t>(num_host_rngs()));
+    const auto      stage_id = kernel_diagnostics().insert_host(name);
+    ScopedHostStage record_stage(stage_id, states.size());
+
+    L<MemSpace::host> launch(params, states);
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel
+#endif
+    {
+        ScopedTrace trace_scope(name);
+        HostRng&    rng = rngs[host_thread_id()];
+#if CELERITAS_USE_OPENMP
+#    pragma omp for schedule(static)
+#endif
+        for (size_type i = 0; i < states.size(); ++i)
+        {
+            launch(ThreadId{i}, rng);
+        }
+    }
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+// HOST INTERFACES
+//---------------------------------------------------------------------------//
+/*!
+ * Number of host RNG engines required.
+ */
+int num_host_rngs()
+{
+#if CELERITAS_USE_OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get minimum step length from interactions.
+ */
+void pre_step(const ParamsHostRef& params,
+              const StateHostRef&  states,
+              Span<HostRng>        rngs)
+{
+    launch_host<PreStepLauncher>("pre_step", params, states, rngs);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Propogation, slowing down, and discrete model selection.
+ */
+void along_and_post_step(const ParamsHostRef& params,
+                         const StateHostRef&  states,
+                         Span<HostRng>        rngs)
+{
+    launch_host<AlongAndPostStepLauncher>(
+        "along_and_post_step", params, states, rngs);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Step limiting, propagation, slowing down, and discrete model selection in a
+ * single pass over the tracks.
+ */
+void step(const ParamsHostRef& params,
+          const StateHostRef&  states,
+          Span<HostRng>        rngs)
+{
+    launch_host<StepLauncher>("step", params, states, rngs);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Postprocessing of secondaries and interaction results.
+ */
+void process_interactions(const ParamsHostRef& params,
+                          const StateHostRef&  states)
+{
+    static const auto stage_id
+        = kernel_diagnostics().insert_host("process_interactions");
+    ScopedHostStage record_stage(stage_id, states.size());
+
+    ProcessInteractionsLauncher<MemSpace::host> launch(params, states);
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel
+#endif
+    {
+        ScopedTrace trace_scope("process_interactions");
+#if CELERITAS_USE_OPENMP
+#    pragma omp for schedule(static)
+#endif
+        for (size_type i = 0; i < states.size(); ++i)
+        {
+            launch(ThreadId{i});
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace demo_loop
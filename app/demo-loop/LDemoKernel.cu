@@ -8,10 +8,8 @@
 #include "LDemoKernel.hh"
 
 #include "base/KernelParamCalculator.cuda.hh"
-#include "physics/base/CutoffView.hh"
 #include "random/RngEngine.hh"
-#include "sim/SimTrackView.hh"
-#include "KernelUtils.hh"
+#include "LDemoLauncher.hh"
 
 using namespace celeritas;
 
@@ -32,19 +30,9 @@ pre_step_kernel(ParamsDeviceRef const params, StateDeviceRef const states)
     if (tid.get() >= states.size())
         return;
 
-    GeoTrackView      geo(params.geometry, states.geometry, tid);
-    GeoMaterialView   geo_mat(params.geo_mats, geo.volume_id());
-    MaterialTrackView mat(params.materials, states.materials, tid);
-    ParticleTrackView particle(params.particles, states.particles, tid);
-    PhysicsTrackView  phys(params.physics,
-                          states.physics,
-                          particle.particle_id(),
-                          geo_mat.material_id(),
-                          tid);
-    RngEngine         rng(states.rng, ThreadId(tid));
-
-    // Sample mfp and calculate minimum step (interaction or step-limited)
-    demo_loop::calc_step_limits(geo, geo_mat, mat, particle, phys, rng);
+    PreStepLauncher<MemSpace::device> launch(params, states);
+    RngEngine                         rng(states.rng, tid);
+    launch(tid, rng);
 }
 
 //---------------------------------------------------------------------------//
@@ -59,25 +47,25 @@ __global__ void along_and_post_step_kernel(ParamsDeviceRef const params,
     if (tid.get() >= states.size())
         return;
 
-    GeoTrackView      geo(params.geometry, states.geometry, tid);
-    GeoMaterialView   geo_mat(params.geo_mats, geo.volume_id());
-    ParticleTrackView particle(params.particles, states.particles, tid);
-    PhysicsTrackView  phys(params.physics,
-                          states.physics,
-                          particle.particle_id(),
-                          geo_mat.material_id(),
-                          tid);
-    RngEngine         rng(states.rng, ThreadId(tid));
-
-    // Move particle and determine the actual distance traveled
-    real_type step = demo_loop::propagate(geo, phys);
-
-    // Calculate energy loss over the step length
-    auto eloss = calc_energy_loss(particle, phys, step);
-    states.energy_deposition[tid] += eloss.value();
-
-    // Select the model for the discrete process
-    demo_loop::select_discrete_model(particle, phys, rng, step, eloss);
+    AlongAndPostStepLauncher<MemSpace::device> launch(params, states);
+    RngEngine                                  rng(states.rng, tid);
+    launch(tid, rng);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Fused pre-step, along-step, and post-step stages.
+ */
+__global__ void
+step_kernel(ParamsDeviceRef const params, StateDeviceRef const states)
+{
+    auto tid = celeritas::KernelParamCalculator::thread_id();
+    if (tid.get() >= states.size())
+        return;
+
+    StepLauncher<MemSpace::device> launch(params, states);
+    RngEngine                      rng(states.rng, tid);
+    launch(tid, rng);
 }
 
 //---------------------------------------------------------------------------//
@@ -91,37 +79,8 @@ __global__ void process_interactions_kernel(ParamsDeviceRef const params,
     if (tid.get() >= states.size())
         return;
 
-    GeoTrackView      geo(params.geometry, states.geometry, tid);
-    MaterialTrackView mat(params.materials, states.materials, tid);
-    ParticleTrackView particle(params.particles, states.particles, tid);
-    SimTrackView      sim(states.sim, tid);
-    CutoffView        cutoffs(params.cutoffs, mat.material_id());
-
-    // Update the track state from the interaction
-    const Interaction& result = states.interactions[tid];
-    if (action_killed(result.action))
-    {
-        sim.alive(false);
-    }
-    else if (!action_unchanged(result.action))
-    {
-        particle.energy(result.energy);
-        geo.set_dir(result.direction);
-    }
-
-    // Deposit energy from interaction
-    states.energy_deposition[tid] += result.energy_deposition.value();
-
-    // Kill secondaries with energy below the production threshold and deposit
-    // their energy
-    for (auto& secondary : result.secondaries)
-    {
-        if (secondary.energy < cutoffs.energy(secondary.particle_id))
-        {
-            states.energy_deposition[tid] += secondary.energy.value();
-            secondary = {};
-        }
-    }
+    ProcessInteractionsLauncher<MemSpace::device> launch(params, states);
+    launch(tid);
 }
 
 } // namespace
@@ -159,6 +118,16 @@ void along_and_post_step(const ParamsDeviceRef& params,
     CDL_LAUNCH_KERNEL(along_and_post_step, states.size(), params, states);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Step limiting, propagation, slowing down, and discrete model selection in a
+ * single kernel.
+ */
+void step(const ParamsDeviceRef& params, const StateDeviceRef& states)
+{
+    CDL_LAUNCH_KERNEL(step, states.size(), params, states);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Postprocessing of secondaries and interaction results.
@@ -7,16 +7,39 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <random>
 #include "base/Assert.hh"
+#include "base/Span.hh"
 #include "LDemoInterface.hh"
 
 namespace demo_loop
 {
 //---------------------------------------------------------------------------//
+// DEVICE KERNEL INTERFACES
+//---------------------------------------------------------------------------//
 void pre_step(const ParamsDeviceRef&, const StateDeviceRef&);
 void along_and_post_step(const ParamsDeviceRef&, const StateDeviceRef&);
+void step(const ParamsDeviceRef&, const StateDeviceRef&);
 void process_interactions(const ParamsDeviceRef&, const StateDeviceRef&);
 
+//---------------------------------------------------------------------------//
+// HOST INTERFACES
+//---------------------------------------------------------------------------//
+//! Random number engine for host launches: one is needed per host thread
+using HostRng = std::mt19937;
+
+void pre_step(const ParamsHostRef&,
+              const StateHostRef&,
+              celeritas::Span<HostRng>);
+void along_and_post_step(const ParamsHostRef&,
+                         const StateHostRef&,
+                         celeritas::Span<HostRng>);
+void step(const ParamsHostRef&, const StateHostRef&, celeritas::Span<HostRng>);
+void process_interactions(const ParamsHostRef&, const StateHostRef&);
+
+// Number of host RNG engines required
+int num_host_rngs();
+
 //---------------------------------------------------------------------------//
 #if !CELERITAS_USE_CUDA
 inline void pre_step(const ParamsDeviceRef&, const StateDeviceRef&)
@@ -29,6 +52,11 @@ inline void along_and_post_step(const ParamsDeviceRef&, const StateDeviceRef&)
     CELER_NOT_CONFIGURED("CUDA");
 }
 
+inline void step(const ParamsDeviceRef&, const StateDeviceRef&)
+{
+    CELER_NOT_CONFIGURED("CUDA");
+}
+
 inline void process_interactions(const ParamsDeviceRef&, const StateDeviceRef&)
 {
     CELER_NOT_CONFIGURED("CUDA");
@@ -0,0 +1,270 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file LDemoLauncher.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "physics/base/CutoffView.hh"
+#include "sim/SimTrackView.hh"
+#include "KernelUtils.hh"
+#include "LDemoInterface.hh"
+
+namespace demo_loop
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sample mean free path and calculate physics step limits.
+ *
+ * The launchers in this file contain the per-track work of each stage of the
+ * stepping loop so that the same code can be called from a CUDA kernel or
+ * from a host loop over track slots. Stages that sample random numbers take
+ * the engine as an argument, since device and host use different generators.
+ */
+template<MemSpace M>
+class PreStepLauncher
+{
+  public:
+    //!@{
+    //! Type aliases
+    using ParamsRef = ParamsData<Ownership::const_reference, M>;
+    using StateRef  = StateData<Ownership::reference, M>;
+    //!@}
+
+  public:
+    //! Construct with shared and state data
+    CELER_FUNCTION PreStepLauncher(const ParamsRef& params,
+                                   const StateRef&  states)
+        : params_(params), states_(states)
+    {
+    }
+
+    //! Apply to a single track
+    template<class Rng>
+    inline CELER_FUNCTION void operator()(ThreadId tid, Rng& rng) const;
+
+  private:
+    const ParamsRef& params_;
+    const StateRef&  states_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Propagate and process physical changes to the track along the step and
+ * select the process/model for discrete interaction.
+ */
+template<MemSpace M>
+class AlongAndPostStepLauncher
+{
+  public:
+    //!@{
+    //! Type aliases
+    using ParamsRef = ParamsData<Ownership::const_reference, M>;
+    using StateRef  = StateData<Ownership::reference, M>;
+    //!@}
+
+  public:
+    //! Construct with shared and state data
+    CELER_FUNCTION AlongAndPostStepLauncher(const ParamsRef& params,
+                                            const StateRef&  states)
+        : params_(params), states_(states)
+    {
+    }
+
+    //! Apply to a single track
+    template<class Rng>
+    inline CELER_FUNCTION void operator()(ThreadId tid, Rng& rng) const;
+
+  private:
+    const ParamsRef& params_;
+    const StateRef&  states_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Fused pre-step, along-step, and post-step stages.
+ *
+ * This performs the same operations as \c PreStepLauncher followed by \c
+ * AlongAndPostStepLauncher, but the track views are constructed once and the
+ * intermediate step limits stay in registers rather than making a round trip
+ * through the state data.
+ */
+template<MemSpace M>
+class StepLauncher
+{
+  public:
+    //!@{
+    //! Type aliases
+    using ParamsRef = ParamsData<Ownership::const_reference, M>;
+    using StateRef  = StateData<Ownership::reference, M>;
+    //!@}
+
+  public:
+    //! Construct with shared and state data
+    CELER_FUNCTION StepLauncher(const ParamsRef& params,
+                                const StateRef&  states)
+        : params_(params), states_(states)
+    {
+    }
+
+    //! Apply to a single track
+    template<class Rng>
+    inline CELER_FUNCTION void operator()(ThreadId tid, Rng& rng) const;
+
+  private:
+    const ParamsRef& params_;
+    const StateRef&  states_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Postprocessing of secondaries and interaction results.
+ */
+template<MemSpace M>
+class ProcessInteractionsLauncher
+{
+  public:
+    //!@{
+    //! Type aliases
+    using ParamsRef = ParamsData<Ownership::const_reference, M>;
+    using StateRef  = StateData<Ownership::reference, M>;
+    //!@}
+
+  public:
+    //! Construct with shared and state data
+    CELER_FUNCTION ProcessInteractionsLauncher(const ParamsRef& params,
+                                               const StateRef&  states)
+        : params_(params), states_(states)
+    {
+    }
+
+    //! Apply to a single track
+    inline CELER_FUNCTION void operator()(ThreadId tid) const;
+
+  private:
+    const ParamsRef& params_;
+    const StateRef&  states_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+template<class Rng>
+CELER_FUNCTION void
+PreStepLauncher<M>::operator()(ThreadId tid, Rng& rng) const
+{
+    GeoTrackView      geo(params_.geometry, states_.geometry, tid);
+    GeoMaterialView   geo_mat(params_.geo_mats, geo.volume_id());
+    MaterialTrackView mat(params_.materials, states_.materials, tid);
+    ParticleTrackView particle(params_.particles, states_.particles, tid);
+    PhysicsTrackView  phys(params_.physics,
+                          states_.physics,
+                          particle.particle_id(),
+                          geo_mat.material_id(),
+                          tid);
+
+    // Sample mfp and calculate minimum step (interaction or step-limited)
+    demo_loop::calc_step_limits(geo, geo_mat, mat, particle, phys, rng);
+}
+
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+template<class Rng>
+CELER_FUNCTION void
+AlongAndPostStepLauncher<M>::operator()(ThreadId tid, Rng& rng) const
+{
+    GeoTrackView      geo(params_.geometry, states_.geometry, tid);
+    GeoMaterialView   geo_mat(params_.geo_mats, geo.volume_id());
+    ParticleTrackView particle(params_.particles, states_.particles, tid);
+    PhysicsTrackView  phys(params_.physics,
+                          states_.physics,
+                          particle.particle_id(),
+                          geo_mat.material_id(),
+                          tid);
+
+    // Move particle and determine the actual distance traveled
+    real_type step = demo_loop::propagate(geo, phys);
+
+    // Calculate energy loss over the step length
+    auto eloss = calc_energy_loss(particle, phys, step);
+    states_.energy_deposition[tid] += eloss.value();
+
+    // Select the model for the discrete process
+    demo_loop::select_discrete_model(particle, phys, rng, step, eloss);
+}
+
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+template<class Rng>
+CELER_FUNCTION void
+StepLauncher<M>::operator()(ThreadId tid, Rng& rng) const
+{
+    GeoTrackView      geo(params_.geometry, states_.geometry, tid);
+    GeoMaterialView   geo_mat(params_.geo_mats, geo.volume_id());
+    MaterialTrackView mat(params_.materials, states_.materials, tid);
+    ParticleTrackView particle(params_.particles, states_.particles, tid);
+    PhysicsTrackView  phys(params_.physics,
+                          states_.physics,
+                          particle.particle_id(),
+                          geo_mat.material_id(),
+                          tid);
+
+    // Sample mfp and calculate minimum step (interaction or step-limited)
+    demo_loop::calc_step_limits(geo, geo_mat, mat, particle, phys, rng);
+
+    // Move particle and determine the actual distance traveled
+    real_type step = demo_loop::propagate(geo, phys);
+
+    // Calculate energy loss over the step length
+    auto eloss = calc_energy_loss(particle, phys, step);
+    states_.energy_deposition[tid] += eloss.value();
+
+    // Select the model for the discrete process
+    demo_loop::select_discrete_model(particle, phys, rng, step, eloss);
+}
+
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+CELER_FUNCTION void
+ProcessInteractionsLauncher<M>::operator()(ThreadId tid) const
+{
+    GeoTrackView      geo(params_.geometry, states_.geometry, tid);
+    MaterialTrackView mat(params_.materials, states_.materials, tid);
+    ParticleTrackView particle(params_.particles, states_.particles, tid);
+    SimTrackView      sim(states_.sim, tid);
+    CutoffView        cutoffs(params_.cutoffs, mat.material_id());
+
+    // Update the track state from the interaction
+    const Interaction& result = states_.interactions[tid];
+    if (action_killed(result.action))
+    {
+        sim.alive(false);
+    }
+    else if (!action_unchanged(result.action))
+    {
+        particle.energy(result.energy);
+        geo.set_dir(result.direction);
+    }
+
+    // Deposit energy from interaction
+    states_.energy_deposition[tid] += result.energy_deposition.value();
+
+    // Kill secondaries with energy below the production threshold and deposit
+    // their energy
+    for (auto& secondary : result.secondaries)
+    {
+        if (secondary.energy < cutoffs.energy(secondary.particle_id))
+        {
+            states_.energy_deposition[tid] += secondary.energy.value();
+            secondary = {};
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace demo_loop
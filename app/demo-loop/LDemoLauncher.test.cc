@@ -0,0 +1,254 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file LDemoLauncher.test.cc
+//---------------------------------------------------------------------------//
+#include "LDemoLauncher.hh"
+
+#include <random>
+#include <vector>
+#include "base/CollectionBuilder.hh"
+#include "base/CollectionStateStore.hh"
+#include "base/Range.hh"
+#include "geometry/GeoMaterialParams.hh"
+#include "geometry/GeoParams.hh"
+#include "physics/base/CutoffParams.hh"
+
+#include "celeritas_test.hh"
+#include "physics/base/PhysicsTestBase.hh"
+
+using namespace celeritas;
+using namespace demo_loop;
+using celeritas::units::MevEnergy;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class LDemoLauncherTest : public celeritas_test::PhysicsTestBase
+{
+    using Base = celeritas_test::PhysicsTestBase;
+
+  protected:
+    //!@{
+    //! Type aliases
+    using Rng       = std::mt19937;
+    using ParamsRef = ParamsData<Ownership::const_reference, MemSpace::host>;
+    using StateRef  = StateData<Ownership::reference, MemSpace::host>;
+    using GeoStore  = CollectionStateStore<GeoStateData, MemSpace::host>;
+    using MaterialStore
+        = CollectionStateStore<MaterialStateData, MemSpace::host>;
+    using ParticleStore
+        = CollectionStateStore<ParticleStateData, MemSpace::host>;
+    using PhysicsStore
+        = CollectionStateStore<PhysicsStateData, MemSpace::host>;
+    using EdepStore
+        = StateCollection<real_type, Ownership::value, MemSpace::host>;
+    //!@}
+
+    //! Track states used by the step launchers
+    struct States
+    {
+        GeoStore      geometry;
+        MaterialStore materials;
+        ParticleStore particles;
+        PhysicsStore  physics;
+        EdepStore     energy_deposition;
+        StateRef      ref;
+    };
+
+    //! Tallied results of a step
+    struct StepResult
+    {
+        std::vector<double> pos;
+        std::vector<double> energy;
+        std::vector<double> edep;
+        std::vector<double> step;
+        std::vector<double> mfp;
+        std::vector<int>    model;
+    };
+
+  protected:
+    void SetUp() override
+    {
+        Base::SetUp();
+
+        geometry_ = std::make_shared<GeoParams>(
+            this->test_data_path("geometry", "twoBoxes.gdml").c_str());
+        {
+            // Fill both volumes with the high density material
+            GeoMaterialParams::Input input;
+            input.geometry  = geometry_;
+            input.materials = this->materials();
+            input.volume_to_mat
+                = std::vector<MaterialId>(geometry_->num_volumes(),
+                                          MaterialId{1});
+            geo_mats_ = std::make_shared<GeoMaterialParams>(std::move(input));
+        }
+        {
+            CutoffParams::Input input;
+            input.materials = this->materials();
+            input.particles = this->particles();
+            cutoffs_        = std::make_shared<CutoffParams>(input);
+        }
+
+        params_.geometry  = geometry_->host_pointers();
+        params_.geo_mats  = geo_mats_->host_pointers();
+        params_.materials = this->materials()->host_pointers();
+        params_.particles = this->particles()->host_pointers();
+        params_.cutoffs   = cutoffs_->host_pointers();
+        params_.physics   = this->physics()->host_pointers();
+        CELER_ASSERT(params_);
+    }
+
+    //! Construct and initialize track states
+    void initialize(States* states) const
+    {
+        const size_type size = this->num_tracks();
+        states->geometry     = GeoStore(*geometry_, size);
+        states->materials    = MaterialStore(*this->materials(), size);
+        states->particles    = ParticleStore(*this->particles(), size);
+        states->physics      = PhysicsStore(*this->physics(), size);
+        resize(&states->energy_deposition, size);
+
+        StateRef& ref         = states->ref;
+        ref.geometry          = states->geometry.ref();
+        ref.materials         = states->materials.ref();
+        ref.particles         = states->particles.ref();
+        ref.physics           = states->physics.ref();
+        ref.energy_deposition = states->energy_deposition;
+
+        // Photons and charged particles in every direction from inside the
+        // small box
+        const Real3 dirs[] = {{1, 0, 0},
+                              {-1, 0, 0},
+                              {0, 1, 0},
+                              {0, -1, 0},
+                              {0, 0, 1},
+                              {0, 0, -1}};
+        const ParticleId pids[]
+            = {this->particles()->find("gamma"),
+               this->particles()->find("celeriton"),
+               this->particles()->find("anti-celeriton")};
+        for (auto i : range(size))
+        {
+            ThreadId     tid{i};
+            GeoTrackView geo(params_.geometry, ref.geometry, tid);
+            geo = {{-4 + 0.5 * i, 1, 2}, dirs[i % 6]};
+
+            GeoMaterialView   geo_mat(params_.geo_mats, geo.volume_id());
+            MaterialTrackView mat(params_.materials, ref.materials, tid);
+            mat = {geo_mat.material_id()};
+
+            ParticleTrackView particle(
+                params_.particles, ref.particles, tid);
+            particle = {pids[i % 3], MevEnergy{1.5 + 5 * i}};
+
+            PhysicsTrackView phys(params_.physics,
+                                  ref.physics,
+                                  particle.particle_id(),
+                                  geo_mat.material_id(),
+                                  tid);
+            phys = PhysicsTrackInitializer{};
+
+            ref.energy_deposition[tid] = 0;
+        }
+    }
+
+    //! Tally the track states
+    StepResult tally(const StateRef& states) const
+    {
+        StepResult result;
+        for (auto tid : range(ThreadId{states.size()}))
+        {
+            GeoTrackView      geo(params_.geometry, states.geometry, tid);
+            ParticleTrackView particle(
+                params_.particles, states.particles, tid);
+            result.pos.insert(
+                result.pos.end(), geo.pos().begin(), geo.pos().end());
+            result.energy.push_back(particle.energy().value());
+            result.edep.push_back(states.energy_deposition[tid]);
+
+            // Step and MFP are negative after a track stops or reaches its
+            // interaction point, so read them directly
+            const PhysicsTrackState& phys = states.physics.state[tid];
+            result.step.push_back(phys.step_length);
+            result.mfp.push_back(phys.interaction_mfp);
+            result.model.push_back(
+                phys.model_id ? static_cast<int>(phys.model_id.get()) : -1);
+        }
+        return result;
+    }
+
+    //! One engine per track so that the draws don't depend on stage order
+    std::vector<Rng> make_rngs() const
+    {
+        std::vector<Rng> result;
+        for (auto i : range(this->num_tracks()))
+        {
+            result.emplace_back(12345 + i);
+        }
+        return result;
+    }
+
+    size_type num_tracks() const { return 16; }
+
+    std::shared_ptr<GeoParams>         geometry_;
+    std::shared_ptr<GeoMaterialParams> geo_mats_;
+    std::shared_ptr<CutoffParams>      cutoffs_;
+    ParamsRef                          params_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(LDemoLauncherTest, split_vs_fused)
+{
+    States split;
+    States fused;
+    this->initialize(&split);
+    this->initialize(&fused);
+
+    auto split_rngs = this->make_rngs();
+    auto fused_rngs = this->make_rngs();
+
+    PreStepLauncher<MemSpace::host>          pre_step(params_, split.ref);
+    AlongAndPostStepLauncher<MemSpace::host> along_and_post_step(params_,
+                                                                 split.ref);
+    StepLauncher<MemSpace::host>             step(params_, fused.ref);
+
+    // Step out of the inner box and then out of the world
+    for (int i = 0; i < 2; ++i)
+    {
+        for (auto tid : range(ThreadId{this->num_tracks()}))
+        {
+            pre_step(tid, split_rngs[tid.get()]);
+        }
+        for (auto tid : range(ThreadId{this->num_tracks()}))
+        {
+            along_and_post_step(tid, split_rngs[tid.get()]);
+        }
+        for (auto tid : range(ThreadId{this->num_tracks()}))
+        {
+            step(tid, fused_rngs[tid.get()]);
+        }
+
+        StepResult expected = this->tally(split.ref);
+        StepResult actual   = this->tally(fused.ref);
+        EXPECT_VEC_SOFT_EQ(expected.pos, actual.pos) << "step " << i;
+        EXPECT_VEC_SOFT_EQ(expected.energy, actual.energy) << "step " << i;
+        EXPECT_VEC_SOFT_EQ(expected.edep, actual.edep) << "step " << i;
+        EXPECT_VEC_SOFT_EQ(expected.step, actual.step) << "step " << i;
+        EXPECT_VEC_SOFT_EQ(expected.mfp, actual.mfp) << "step " << i;
+        EXPECT_VEC_EQ(expected.model, actual.model) << "step " << i;
+    }
+
+    // The engines were used identically
+    for (auto i : range(this->num_tracks()))
+    {
+        EXPECT_EQ(split_rngs[i](), fused_rngs[i]()) << "track " << i;
+    }
+}
@@ -0,0 +1,95 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file LDemoParallel.cc
+//---------------------------------------------------------------------------//
+#include "LDemoParallel.hh"
+
+#include <algorithm>
+#include "base/Assert.hh"
+
+using namespace celeritas;
+
+namespace demo_loop
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Keep the primaries of the events assigned to this process.
+ *
+ * The primaries of all events must be given on every process. A block split
+ * keeps a contiguous range of events and a cyclic split keeps every \em n th
+ * event. With a dynamic split all events are kept, since any of them may be
+ * claimed by this process during the run. Event IDs are unchanged so that
+ * results can be compared across different numbers of processes.
+ */
+void select_local_events(EventSplit            split,
+                         const Communicator&   comm,
+                         std::vector<Primary>* primaries)
+{
+    CELER_EXPECT(primaries);
+
+    // Event IDs are assigned sequentially by the reader
+    ull_int num_events = 0;
+    for (const Primary& p : *primaries)
+    {
+        num_events = std::max<ull_int>(num_events, p.event_id.get() + 1);
+    }
+
+    const auto rank     = static_cast<ull_int>(comm.rank());
+    const auto size     = static_cast<ull_int>(comm.size());
+    auto       is_local = [&](const Primary& p) {
+        const ull_int event = p.event_id.get();
+        switch (split)
+        {
+            case EventSplit::block:
+                return event * size / num_events == rank;
+            case EventSplit::cyclic:
+                return event % size == rank;
+            case EventSplit::dynamic:
+                // Events are claimed in batches during the run
+                return true;
+        }
+        CELER_ASSERT_UNREACHABLE();
+    };
+    primaries->erase(
+        std::remove_if(primaries->begin(),
+                       primaries->end(),
+                       [&is_local](const Primary& p) { return !is_local(p); }),
+        primaries->end());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Combine the tallies from all processes.
+ *
+ * Processes step independently, so the per-step tallies are padded to the
+ * largest number of steps taken by any process. The step time is that of the
+ * slowest process, and the living tracks and energy deposition are summed.
+ */
+void reduce_result(const Communicator& comm, LDemoResult* result)
+{
+    CELER_EXPECT(result);
+    CELER_EXPECT(result->alive.size() == result->time.size());
+
+    const auto num_steps = allreduce(comm, Operation::max, result->time.size());
+    result->time.resize(num_steps);
+    result->alive.resize(num_steps);
+    allreduce(comm, Operation::max, make_span(result->time));
+    allreduce(comm, Operation::sum, make_span(result->alive));
+
+    const auto num_bins = allreduce(comm, Operation::max, result->edep.size());
+    result->edep.resize(num_bins);
+    allreduce(comm, Operation::sum, make_span(result->edep));
+
+    result->total_time = allreduce(comm, Operation::max, result->total_time);
+    result->num_ranks       = comm.size();
+    result->events_per_rank = allgather(comm, result->num_events);
+    result->num_events = allreduce(comm, Operation::sum, result->num_events);
+    result->num_primaries
+        = allreduce(comm, Operation::sum, result->num_primaries);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace demo_loop
@@ -0,0 +1,44 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file LDemoParallel.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+#include "base/Span.hh"
+#include "comm/Communicator.hh"
+#include "comm/Operations.hh"
+#include "physics/base/Primary.hh"
+#include "LDemoIO.hh"
+
+namespace demo_loop
+{
+//---------------------------------------------------------------------------//
+// Keep the primaries of the events assigned to this process
+void select_local_events(EventSplit                       split,
+                         const celeritas::Communicator&   comm,
+                         std::vector<celeritas::Primary>* primaries);
+
+// Combine the tallies from all processes
+void reduce_result(const celeritas::Communicator& comm, LDemoResult* result);
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Collect a value from every process.
+ */
+template<class T>
+std::vector<T> allgather(const celeritas::Communicator& comm, T value)
+{
+    std::vector<T> result(comm.size(), T{});
+    result[comm.rank()] = value;
+    allreduce(comm, celeritas::Operation::sum, celeritas::make_span(result));
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace demo_loop
@@ -0,0 +1,177 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file LDemoParallel.test.cc
+//---------------------------------------------------------------------------//
+#include "LDemoParallel.hh"
+
+#include <vector>
+#include "base/Range.hh"
+#include "comm/ScopedMpiInit.hh"
+
+#include "celeritas_test.hh"
+
+using namespace demo_loop;
+using celeritas::Communicator;
+using celeritas::EventId;
+using celeritas::Operation;
+using celeritas::Primary;
+using celeritas::TrackId;
+using celeritas::ull_int;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class LDemoParallelTest : public celeritas::Test
+{
+  protected:
+    void SetUp() override
+    {
+        using celeritas::ScopedMpiInit;
+        if (ScopedMpiInit::status() != ScopedMpiInit::Status::disabled)
+        {
+            comm = Communicator::comm_world();
+        }
+    }
+
+    //! Primaries of events with one to three tracks each
+    static std::vector<Primary> make_primaries(unsigned int num_events)
+    {
+        std::vector<Primary> result;
+        for (auto event : celeritas::range(num_events))
+        {
+            for (auto track : celeritas::range(event % 3 + 1))
+            {
+                Primary p;
+                p.event_id = EventId{event};
+                p.track_id = TrackId{track};
+                result.push_back(p);
+            }
+        }
+        return result;
+    }
+
+    //! Number of primaries kept by all processes
+    int count_all(const std::vector<Primary>& primaries) const
+    {
+        return allreduce(comm, Operation::sum, int(primaries.size()));
+    }
+
+    Communicator comm;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(LDemoParallelTest, block)
+{
+    const unsigned int num_events = 10;
+    const auto         all        = make_primaries(num_events);
+
+    auto primaries = all;
+    select_local_events(EventSplit::block, comm, &primaries);
+
+    // Events are contiguous and belong to this process
+    const ull_int rank = comm.rank();
+    const ull_int size = comm.size();
+    for (auto i : celeritas::range(primaries.size()))
+    {
+        const ull_int event = primaries[i].event_id.get();
+        EXPECT_EQ(rank, event * size / num_events);
+        if (i > 0)
+        {
+            EXPECT_LE(event - primaries[i - 1].event_id.get(), 1);
+        }
+    }
+    EXPECT_EQ(int(all.size()), this->count_all(primaries));
+}
+
+TEST_F(LDemoParallelTest, cyclic)
+{
+    const auto all = make_primaries(10);
+
+    auto primaries = all;
+    select_local_events(EventSplit::cyclic, comm, &primaries);
+
+    for (const Primary& p : primaries)
+    {
+        EXPECT_EQ(comm.rank(), int(p.event_id.get() % comm.size()));
+    }
+    EXPECT_EQ(int(all.size()), this->count_all(primaries));
+}
+
+TEST_F(LDemoParallelTest, few_events)
+{
+    // Some processes have no events
+    const auto all = make_primaries(3);
+    for (auto split : {EventSplit::block, EventSplit::cyclic})
+    {
+        auto primaries = all;
+        select_local_events(split, comm, &primaries);
+        EXPECT_EQ(int(all.size()), this->count_all(primaries))
+            << "for split " << static_cast<int>(split);
+    }
+}
+
+TEST_F(LDemoParallelTest, dynamic)
+{
+    // All events are kept, since any may be claimed during the run
+    const auto all       = make_primaries(10);
+    auto       primaries = all;
+    select_local_events(EventSplit::dynamic, comm, &primaries);
+    EXPECT_EQ(all.size(), primaries.size());
+}
+
+TEST_F(LDemoParallelTest, reduce_result)
+{
+    using size_type = celeritas::size_type;
+
+    // Each process takes one more step and fills one more bin than the last
+    const size_type rank = comm.rank();
+    const size_type size = comm.size();
+    LDemoResult     result;
+    for (auto step : celeritas::range(rank + 1))
+    {
+        result.time.push_back(rank + step);
+        result.alive.push_back(1);
+    }
+    result.edep          = std::vector<double>(rank + 2, 0.5);
+    result.total_time    = rank;
+    result.num_events    = rank + 1;
+    result.num_primaries = 10 * (rank + 1);
+
+    reduce_result(comm, &result);
+
+    // Per-step tallies are padded to the longest run
+    std::vector<double>    expected_time;
+    std::vector<size_type> expected_alive;
+    for (auto step : celeritas::range(size))
+    {
+        expected_time.push_back(size - 1 + step);
+        expected_alive.push_back(size - step);
+    }
+    EXPECT_VEC_EQ(expected_time, result.time);
+    EXPECT_VEC_EQ(expected_alive, result.alive);
+
+    std::vector<double> expected_edep(size + 1, 0.5 * size);
+    for (auto bin : celeritas::range<size_type>(2, size + 1))
+    {
+        expected_edep[bin] = 0.5 * (size + 1 - bin);
+    }
+    EXPECT_VEC_SOFT_EQ(expected_edep, result.edep);
+
+    std::vector<size_type> expected_events_per_rank;
+    for (auto r : celeritas::range(size))
+    {
+        expected_events_per_rank.push_back(r + 1);
+    }
+    EXPECT_EQ(size - 1, result.total_time);
+    EXPECT_EQ(comm.size(), result.num_ranks);
+    EXPECT_VEC_EQ(expected_events_per_rank, result.events_per_rank);
+    EXPECT_EQ(size * (size + 1) / 2, result.num_events);
+    EXPECT_EQ(10 * size * (size + 1) / 2, result.num_primaries);
+}
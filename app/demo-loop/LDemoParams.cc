@@ -7,7 +7,14 @@
 //---------------------------------------------------------------------------//
 #include "LDemoParams.hh"
 
+#include "base/CollectionMirror.hh"
+#include "base/Range.hh"
+#include "comm/BroadcastData.hh"
+#include "comm/Communicator.hh"
 #include "comm/Logger.hh"
+#include "comm/NodeSharedData.hh"
+#include "comm/Operations.hh"
+#include "comm/Tracer.hh"
 #include "io/RootImporter.hh"
 #include "io/ImportData.hh"
 #include "io/EventReader.hh"
@@ -19,19 +26,183 @@
 #include "physics/em/GammaConversionProcess.hh"
 #include "physics/em/PhotoelectricProcess.hh"
 #include "LDemoIO.hh"
+#include "LDemoParallel.hh"
 
 using namespace celeritas;
 
 namespace demo_loop
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+//! How params data built by the first process is stored on the others
+struct Sharing
+{
+    Communicator comm;
+    bool         per_node; //!< One copy per node rather than per process
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the collection data of params built by the first process.
+ *
+ * The params are only needed on the first process. The returned mirror owns
+ * the node-shared or private copy of the data.
+ */
+template<template<Ownership, MemSpace> class P, class Params>
+CollectionMirror<P> share_data(const Sharing& sharing, const Params* params)
+{
+    CELER_EXPECT(sharing.comm.rank() != 0 || params);
+    typename CollectionMirror<P>::HostRef data;
+    if (params)
+    {
+        data = params->host_pointers();
+    }
+
+    if (sharing.per_node)
+    {
+        auto shared = std::make_shared<NodeSharedData<P>>(sharing.comm, data);
+        return CollectionMirror<P>{shared->host_ref(), std::move(shared)};
+    }
+    auto copied = std::make_shared<BroadcastData<P>>(sharing.comm, data);
+    return CollectionMirror<P>{copied->host_ref(), std::move(copied)};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Adopt the materials built by the first process.
+ */
+std::shared_ptr<const MaterialParams>
+share_params(const Sharing& sharing, const MaterialParams* materials)
+{
+    std::vector<std::string> elnames;
+    std::vector<std::string> matnames;
+    if (materials)
+    {
+        for (auto id : range(ElementId{materials->num_elements()}))
+        {
+            elnames.push_back(materials->id_to_label(id));
+        }
+        for (auto id : range(MaterialId{materials->num_materials()}))
+        {
+            matnames.push_back(materials->id_to_label(id));
+        }
+    }
+    broadcast(sharing.comm, &elnames);
+    broadcast(sharing.comm, &matnames);
+
+    return std::make_shared<MaterialParams>(
+        share_data<MaterialParamsData>(sharing, materials),
+        std::move(elnames),
+        std::move(matnames));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Adopt the volume materials built by the first process.
+ */
+std::shared_ptr<const GeoMaterialParams>
+share_params(const Sharing& sharing, const GeoMaterialParams* geo_mats)
+{
+    return std::make_shared<GeoMaterialParams>(
+        share_data<GeoMaterialParamsData>(sharing, geo_mats));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Adopt the particles built by the first process.
+ */
+std::shared_ptr<const ParticleParams>
+share_params(const Sharing& sharing, const ParticleParams* particles)
+{
+    std::vector<std::string> names;
+    std::vector<PDGNumber>   pdg_codes;
+    if (particles)
+    {
+        for (auto id : range(ParticleId{particles->size()}))
+        {
+            names.push_back(particles->id_to_label(id));
+            pdg_codes.push_back(particles->id_to_pdg(id));
+        }
+    }
+    broadcast(sharing.comm, &names);
+    pdg_codes.resize(names.size());
+    broadcast(sharing.comm, make_span(pdg_codes));
+
+    return std::make_shared<ParticleParams>(
+        share_data<ParticleParamsData>(sharing, particles),
+        std::move(names),
+        std::move(pdg_codes));
+}
+
 //---------------------------------------------------------------------------//
-LDemoParams load_params(const LDemoArgs& args)
+/*!
+ * Adopt the cutoffs built by the first process.
+ */
+std::shared_ptr<const CutoffParams>
+share_params(const Sharing& sharing, const CutoffParams* cutoffs)
+{
+    return std::make_shared<CutoffParams>(
+        share_data<CutoffParamsData>(sharing, cutoffs));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Send the types of the imported processes from the first process.
+ *
+ * The physics vectors are only needed to build the physics tables, which the
+ * other processes adopt, so only the process, model, and table types are
+ * sent. They're enough to construct the processes and their models.
+ */
+void broadcast_process_types(const Communicator&         comm,
+                             std::vector<ImportProcess>* processes)
+{
+    processes->resize(broadcast(comm, processes->size()));
+    for (ImportProcess& proc : *processes)
+    {
+        proc.particle_pdg  = broadcast(comm, proc.particle_pdg);
+        proc.process_type  = broadcast(comm, proc.process_type);
+        proc.process_class = broadcast(comm, proc.process_class);
+        proc.models.resize(broadcast(comm, proc.models.size()));
+        broadcast(comm, make_span(proc.models));
+        proc.tables.resize(broadcast(comm, proc.tables.size()));
+        for (ImportPhysicsTable& table : proc.tables)
+        {
+            table.table_type = broadcast(comm, table.table_type);
+            table.x_units    = broadcast(comm, table.x_units);
+            table.y_units    = broadcast(comm, table.y_units);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Load the problem data.
+ *
+ * With multiple processes, only the first one reads the physics input and
+ * builds the params data. The other processes adopt the materials,
+ * particles, cutoffs, and physics tables, and construct only the physics
+ * models. The host data is stored once per node with \c share_params, and
+ * once per process otherwise. Loading is then collective: every process
+ * constructs the same params in the same order. Every process still loads
+ * the geometry, since the VecGeom geometry isn't stored in collections.
+ */
+LDemoParams load_params(const LDemoArgs& args, const Communicator& comm)
 {
     CELER_LOG(status) << "Loading input files";
-    LDemoParams result;
+    const bool    builds = (comm.rank() == 0);
+    const Sharing sharing{comm, args.share_params};
+    LDemoParams   result;
 
     // Load data from ROOT file
-    const auto data = RootImporter(args.physics_filename.c_str())();
+    ImportData data;
+    if (builds)
+    {
+        data = RootImporter(args.physics_filename.c_str())();
+    }
 
     // Load geometry
     {
@@ -40,11 +211,13 @@ LDemoParams load_params(const LDemoArgs& args)
     }
 
     // Load materials
+    if (builds)
     {
         result.materials = MaterialParams::from_import(data);
     }
 
     // Create geometry/material coupling
+    if (builds)
     {
         GeoMaterialParams::Input input;
         input.geometry  = result.geometry;
@@ -64,11 +237,13 @@ LDemoParams load_params(const LDemoArgs& args)
     }
 
     // Construct particle params
+    if (builds)
     {
         result.particles = ParticleParams::from_import(data);
     }
 
     // Construct cutoffs
+    if (builds)
     {
         CutoffParams::Input input;
         input.materials = result.materials;
@@ -76,6 +251,16 @@ LDemoParams load_params(const LDemoArgs& args)
         result.cutoffs  = std::make_shared<CutoffParams>(std::move(input));
     }
 
+    if (comm.size() > 1)
+    {
+        // Adopt the data built by the first process
+        result.materials = share_params(sharing, result.materials.get());
+        result.geo_mats  = share_params(sharing, result.geo_mats.get());
+        result.particles = share_params(sharing, result.particles.get());
+        result.cutoffs   = share_params(sharing, result.cutoffs.get());
+        broadcast_process_types(comm, &data.processes);
+    }
+
     // Load physics: create individual processes with make_shared
     {
         PhysicsParams::Input input;
@@ -90,15 +275,23 @@ LDemoParams load_params(const LDemoArgs& args)
         input.processes.push_back(std::make_shared<EIonizationProcess>(
             result.particles, process_data));
 
-        result.physics = std::make_shared<PhysicsParams>(std::move(input));
-    }
-
-    // Load track initialization data
-    {
-        EventReader read_event(args.hepmc3_filename.c_str(), result.particles);
-        const auto  primaries = read_event();
-
-        // TODO: Initialize TrackInitParams
+        if (comm.size() == 1)
+        {
+            result.physics = std::make_shared<PhysicsParams>(std::move(input));
+        }
+        else
+        {
+            // Build the physics tables once and construct the models of the
+            // same processes everywhere
+            std::shared_ptr<const PhysicsParams> built;
+            if (builds)
+            {
+                built = std::make_shared<PhysicsParams>(input);
+            }
+            result.physics = std::make_shared<PhysicsParams>(
+                std::move(input),
+                share_data<PhysicsParamsData>(sharing, built.get()));
+        }
     }
 
     // Construct RNG params
@@ -110,5 +303,38 @@ LDemoParams load_params(const LDemoArgs& args)
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Load the primaries of the events assigned to this process.
+ *
+ * The first process reads the event file and broadcasts the primaries, so the
+ * file system is accessed only once. Each process then keeps its share of the
+ * events (see \c select_local_events).
+ */
+std::vector<Primary> load_primaries(const LDemoArgs&    args,
+                                    const LDemoParams&  params,
+                                    const Communicator& comm)
+{
+    CELER_EXPECT(params);
+    ScopedTrace trace_scope("load_primaries");
+
+    std::vector<Primary> primaries;
+    if (comm.rank() == 0)
+    {
+        EventReader read_event(args.hepmc3_filename.c_str(), params.particles);
+        primaries = read_event();
+    }
+    primaries.resize(broadcast(comm, primaries.size()));
+    broadcast(comm, make_span(primaries));
+
+    const auto num_primaries = primaries.size();
+    select_local_events(args.event_split, comm, &primaries);
+
+    CELER_LOG_LOCAL(debug) << "Kept " << primaries.size() << " of "
+                           << num_primaries << " primaries for "
+                           << to_cstring(args.event_split) << " event split";
+    return primaries;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace demo_loop
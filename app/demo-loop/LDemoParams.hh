@@ -7,14 +7,21 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <vector>
 #include "geometry/GeoMaterialParams.hh"
 #include "geometry/GeoParams.hh"
 #include "physics/base/CutoffParams.hh"
 #include "physics/base/ParticleParams.hh"
 #include "physics/base/PhysicsParams.hh"
+#include "physics/base/Primary.hh"
 #include "physics/material/MaterialParams.hh"
 #include "random/RngParams.hh"
 
+namespace celeritas
+{
+class Communicator;
+}
+
 namespace demo_loop
 {
 struct LDemoArgs;
@@ -47,8 +54,15 @@ struct LDemoParams
 };
 
 //---------------------------------------------------------------------------//
-// Load params from input arguments
-LDemoParams load_params(const LDemoArgs& args);
+// Load params from input arguments (collective)
+LDemoParams
+load_params(const LDemoArgs& args, const celeritas::Communicator& comm);
+
+// Load the primaries of the events assigned to this process
+std::vector<celeritas::Primary>
+load_primaries(const LDemoArgs&               args,
+               const LDemoParams&             params,
+               const celeritas::Communicator& comm);
 
 //---------------------------------------------------------------------------//
 } // namespace demo_loop
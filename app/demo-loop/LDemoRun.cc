@@ -7,12 +7,26 @@
 //---------------------------------------------------------------------------//
 #include "LDemoRun.hh"
 
+#include <memory>
+#include <random>
+#include <vector>
 #include "base/CollectionStateStore.hh"
+#include "base/Range.hh"
+#include "base/Span.hh"
+#include "base/Stopwatch.hh"
+#include "comm/Communicator.hh"
 #include "comm/Logger.hh"
+#include "comm/Operations.hh"
+#include "comm/Tracer.hh"
 #include "physics/base/ModelInterface.hh"
+#include "physics/em/LivermorePEModel.hh"
+#include "physics/em/RayleighModel.hh"
+#include "physics/em/SeltzerBergerModel.hh"
 #include "LDemoParams.hh"
 #include "LDemoInterface.hh"
 #include "LDemoKernel.hh"
+#include "LDemoParallel.hh"
+#include "LDemoScheduler.hh"
 
 using namespace celeritas;
 
@@ -46,6 +60,28 @@ struct ParamsGetter<P, MemSpace::device>
     }
 };
 
+template<>
+struct ParamsGetter<RayleighModel, MemSpace::host>
+{
+    const RayleighModel& params_;
+
+    auto operator()() const -> decltype(auto)
+    {
+        return params_.host_group();
+    }
+};
+
+template<>
+struct ParamsGetter<RayleighModel, MemSpace::device>
+{
+    const RayleighModel& params_;
+
+    auto operator()() const -> decltype(auto)
+    {
+        return params_.device_group();
+    }
+};
+
 template<MemSpace M, class P>
 decltype(auto) get_pointers(const P& params)
 {
@@ -93,6 +129,7 @@ void launch_models(LDemoParams const& host_params,
     refs.states.direction    = states.geometry.dir;
     refs.states.secondaries  = states.secondaries;
     refs.states.interactions = states.interactions;
+    refs.states.rng_counters = states.rng_counters;
     CELER_ASSERT(refs);
 
     // Loop over physics models IDs and invoke `interact`
@@ -103,16 +140,187 @@ void launch_models(LDemoParams const& host_params,
     }
 }
 
+//---------------------------------------------------------------------------//
+//! Histogram bins for random draws per interaction
+constexpr size_type rng_counter_bins() { return 64; }
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tally the memory used by the data that models own.
+ *
+ * Only collection data is counted. Storage that the models hold outside
+ * collections is listed by model label in the excluded memory.
+ */
+template<MemSpace M>
+void account_model_memory(const PhysicsParams& physics, LDemoResult* result)
+{
+    CollectionMemory& mem = result->params_memory;
+    for (auto model_id : range(ModelId{physics.num_models()}))
+    {
+        const Model& model = physics.model(model_id);
+        if (auto* sb = dynamic_cast<const SeltzerBergerModel*>(&model))
+        {
+            mem("models.seltzer_berger", get_pointers<M>(*sb));
+        }
+        else if (auto* rayl = dynamic_cast<const RayleighModel*>(&model))
+        {
+            mem("models.rayleigh", get_pointers<M>(*rayl));
+        }
+        else if (auto* pe = dynamic_cast<const LivermorePEModel*>(&model))
+        {
+            mem("models.livermore_pe", get_pointers<M>(*pe));
+            result->excluded_memory.push_back(
+                model.label() + ": atomic relaxation data and scratch space");
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Tally the memory used by the params and states.
+ *
+ * State memory scales with the number of track slots, so the cost per slot
+ * gives the largest number of tracks whose states fit in the memory budget
+ * alongside the params.
+ */
+template<MemSpace M>
+void account_memory(const LDemoArgs&                                 args,
+                    const PhysicsParams&                             physics,
+                    ParamsData<Ownership::const_reference, M> const& params,
+                    StateData<Ownership::reference, M> const&        states,
+                    LDemoResult*                                     result)
+{
+    CELER_EXPECT(states.size() > 0);
+    CELER_EXPECT(result);
+
+    result->params_memory("params", params);
+    account_model_memory<M>(physics, result);
+    result->state_memory("state", states);
+    result->bytes_per_track = static_cast<double>(
+                                  result->state_memory.total_bytes(M))
+                              / states.size();
+
+    const std::size_t params_bytes = result->params_memory.total_bytes(M);
+    if (args.memory_budget > params_bytes)
+    {
+        result->max_num_tracks = static_cast<size_type>(
+            (args.memory_budget - params_bytes) / result->bytes_per_track);
+    }
+
+    CELER_LOG(info) << "Params use " << params_bytes << " bytes; states use "
+                    << result->bytes_per_track << " bytes per track";
+}
+
+//---------------------------------------------------------------------------//
+//! Number of distinct events, given primaries grouped by event
+size_type count_events(const std::vector<Primary>& primaries)
+{
+    size_type result = 0;
+    for (auto i : range(primaries.size()))
+    {
+        if (i == 0 || primaries[i].event_id != primaries[i - 1].event_id)
+        {
+            ++result;
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Create a scheduler if events are claimed dynamically.
+ */
+std::unique_ptr<EventScheduler>
+make_scheduler(const LDemoArgs&            args,
+               const Communicator&         comm,
+               const std::vector<Primary>& primaries)
+{
+    if (args.event_split != EventSplit::dynamic)
+    {
+        return nullptr;
+    }
+
+    EventScheduler::Input inp;
+    inp.num_events = count_events(primaries);
+    inp.batch_size = args.event_batch_size;
+    return std::make_unique<EventScheduler>(comm, inp);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wait for all processes to finish their events.
+ *
+ * The idle time of each process is the time spent waiting here for the
+ * slowest process, plus any time spent claiming events.
+ */
+void wait_for_all(const Communicator&   comm,
+                  const EventScheduler* scheduler,
+                  LDemoResult*          result)
+{
+    CELER_EXPECT(result);
+    ScopedTrace trace_scope("wait_for_all");
+
+    Stopwatch get_time;
+    barrier(comm);
+    double idle_time = get_time();
+    if (scheduler)
+    {
+        idle_time += scheduler->request_time();
+    }
+    result->idle_time = allgather(comm, idle_time);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Summarize the random draws per interaction over all processes.
+ *
+ * The histograms are summed before the statistics are calculated so that the
+ * percentiles are those of the combined samples.
+ */
+template<MemSpace M>
+void reduce_rng_draws(const Communicator&                        comm,
+                      const LDemoParams&                         params,
+                      const RngCounterData<Ownership::value, M>& counters,
+                      LDemoResult*                               result)
+{
+    CELER_EXPECT(counters);
+    CELER_EXPECT(result);
+
+    using HostItems = AllItems<ull_int, MemSpace::host>;
+    RngCounterData<Ownership::value, MemSpace::host> host_counters;
+    resize(&host_counters, counters.num_categories(), counters.num_bins);
+    copy_to_host(counters.histogram, host_counters.histogram[HostItems{}]);
+    copy_to_host(counters.total, host_counters.total[HostItems{}]);
+    copy_to_host(counters.max, host_counters.max[HostItems{}]);
+
+    allreduce(comm, Operation::sum, host_counters.histogram[HostItems{}]);
+    allreduce(comm, Operation::sum, host_counters.total[HostItems{}]);
+    allreduce(comm, Operation::max, host_counters.max[HostItems{}]);
+
+    auto stats = calc_rng_counter_stats(host_counters);
+    for (auto model_id : range(ModelId{params.physics->num_models()}))
+    {
+        result->rng_draws[params.physics->model(model_id).label()]
+            = stats[model_id.get()];
+    }
+}
+
 //---------------------------------------------------------------------------//
 } // namespace
 
 //---------------------------------------------------------------------------//
-LDemoResult run_gpu(LDemoArgs args)
+LDemoResult run_gpu(LDemoArgs args, const Communicator& comm)
 {
     CELER_EXPECT(args);
 
     // Load all the problem data
-    LDemoParams params = load_params(args);
+    LDemoParams params = [&args, &comm] {
+        ScopedTrace trace_scope("load_params");
+        return load_params(args, comm);
+    }();
+
+    // Load this process's share of the events
+    const auto primaries = load_primaries(args, params, comm);
 
     // Create param interfaces (TODO unify with sim/TrackInterface)
     ParamsDeviceRef params_ref = build_params_refs<MemSpace::device>(params);
@@ -123,41 +331,135 @@ LDemoResult run_gpu(LDemoArgs args)
     resize(&state_storage,
            build_params_refs<MemSpace::host>(params),
            args.max_num_tracks);
+    if (args.count_rng_draws)
+    {
+        // Tally random draws per interaction for each model
+        resize(&state_storage.rng_counters,
+               params.physics->num_models(),
+               rng_counter_bins());
+    }
     StateDeviceRef states_ref = make_ref(state_storage);
 
+    LDemoResult result;
+    account_memory(args, *params.physics, params_ref, states_ref, &result);
+
+    // Claim events in batches during the run, or transport all local events
+    auto scheduler = make_scheduler(args, comm, primaries);
+    if (!scheduler)
+    {
+        result.num_events    = count_events(primaries);
+        result.num_primaries = primaries.size();
+    }
+
     CELER_NOT_IMPLEMENTED("TODO: stepping loop");
 
-    bool any_alive = true;
+    // Device stages are traced by their (asynchronous) launch time
+    bool      any_alive = true;
+    size_type num_steps = 0;
     while (any_alive)
     {
-        demo_loop::pre_step(params_ref, states_ref);
-        demo_loop::along_and_post_step(params_ref, states_ref);
-        launch_models(params, params_ref, states_ref);
-        demo_loop::process_interactions(params_ref, states_ref);
+        ScopedTrace trace_step("step_iteration", num_steps);
+        if (args.fused_step)
+        {
+            ScopedTrace trace_scope("step", num_steps);
+            demo_loop::step(params_ref, states_ref);
+        }
+        else
+        {
+            {
+                ScopedTrace trace_scope("pre_step", num_steps);
+                demo_loop::pre_step(params_ref, states_ref);
+            }
+            ScopedTrace trace_scope("along_and_post_step", num_steps);
+            demo_loop::along_and_post_step(params_ref, states_ref);
+        }
+        {
+            ScopedTrace trace_scope("interact", num_steps);
+            launch_models(params, params_ref, states_ref);
+        }
+        {
+            ScopedTrace trace_scope("process_interactions", num_steps);
+            demo_loop::process_interactions(params_ref, states_ref);
+        }
         // TODO: Create primaries from secondaries
+        ++num_steps;
+    }
+    wait_for_all(comm, scheduler.get(), &result);
+
+    if (args.count_rng_draws)
+    {
+        reduce_rng_draws(comm, params, state_storage.rng_counters, &result);
     }
+    reduce_result(comm, &result);
+    return result;
 }
 
 //---------------------------------------------------------------------------//
-LDemoResult run_cpu(LDemoArgs args)
+LDemoResult run_cpu(LDemoArgs args, const Communicator& comm)
 {
     CELER_EXPECT(args);
 
     // Load all the problem data
-    LDemoParams params     = load_params(args);
-    auto        params_ref = build_params_refs<MemSpace::host>(params);
+    LDemoParams params = [&args, &comm] {
+        ScopedTrace trace_scope("load_params");
+        return load_params(args, comm);
+    }();
+    auto params_ref = build_params_refs<MemSpace::host>(params);
+
+    // Load this process's share of the events
+    const auto primaries = load_primaries(args, params, comm);
 
     StateData<Ownership::value, MemSpace::host> state_storage;
     resize(&state_storage, build_params_refs<MemSpace::host>(params), 1);
     auto states_ref = make_ref(state_storage);
 
+    LDemoResult result;
+    account_memory(args, *params.physics, params_ref, states_ref, &result);
+
+    // Claim events in batches during the run, or transport all local events
+    auto scheduler = make_scheduler(args, comm, primaries);
+    if (!scheduler)
+    {
+        result.num_events    = count_events(primaries);
+        result.num_primaries = primaries.size();
+    }
+
+    // One random number engine per host thread
+    std::vector<HostRng> rngs;
+    for (auto i : range(num_host_rngs()))
+    {
+        std::seed_seq seeds{args.seed, static_cast<unsigned int>(i)};
+        rngs.emplace_back(seeds);
+    }
+
     CELER_NOT_IMPLEMENTED("TODO: CPU stepping loop");
 
-    bool any_alive = false;
+    bool      any_alive = false;
+    size_type num_steps = 0;
     while (any_alive)
     {
-        launch_models(params, params_ref, states_ref);
+        ScopedTrace trace_step("step_iteration", num_steps);
+        if (args.fused_step)
+        {
+            demo_loop::step(params_ref, states_ref, make_span(rngs));
+        }
+        else
+        {
+            demo_loop::pre_step(params_ref, states_ref, make_span(rngs));
+            demo_loop::along_and_post_step(
+                params_ref, states_ref, make_span(rngs));
+        }
+        {
+            ScopedTrace trace_scope("interact", num_steps);
+            launch_models(params, params_ref, states_ref);
+        }
+        demo_loop::process_interactions(params_ref, states_ref);
+        ++num_steps;
     }
+    wait_for_all(comm, scheduler.get(), &result);
+
+    reduce_result(comm, &result);
+    return result;
 }
 
 //---------------------------------------------------------------------------//
@@ -9,10 +9,15 @@
 
 #include "LDemoIO.hh"
 
+namespace celeritas
+{
+class Communicator;
+}
+
 namespace demo_loop
 {
 //---------------------------------------------------------------------------//
-LDemoResult run_gpu(LDemoArgs args);
+LDemoResult run_gpu(LDemoArgs args, const celeritas::Communicator& comm);
 
 //---------------------------------------------------------------------------//
 } // namespace demo_loop
@@ -0,0 +1,85 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file LDemoScheduler.cc
+//---------------------------------------------------------------------------//
+#include "LDemoScheduler.hh"
+
+#include <algorithm>
+#include "base/Assert.hh"
+#include "base/Stopwatch.hh"
+
+using namespace celeritas;
+
+namespace demo_loop
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with total number of events and batch size.
+ */
+EventScheduler::EventScheduler(const Communicator& comm, const Input& inp)
+    : next_event_(comm), inp_(inp)
+{
+    CELER_EXPECT(inp_.batch_size > 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Claim the next batch of events.
+ *
+ * Once the events are exhausted, an empty range is returned without
+ * communicating.
+ */
+auto EventScheduler::next_batch() -> EventRange
+{
+    if (finished_)
+    {
+        return {};
+    }
+
+    Stopwatch  get_time;
+    const auto first = next_event_.fetch_add(inp_.batch_size);
+    request_time_ += get_time();
+
+    if (first >= inp_.num_events)
+    {
+        finished_ = true;
+        return {};
+    }
+
+    const auto last = std::min<ull_int>(first + inp_.batch_size,
+                                        inp_.num_events);
+    num_events_ += last - first;
+    ++num_batches_;
+    return {EventId(first), EventId(last)};
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the primaries belonging to a range of events.
+ *
+ * The primaries must be sorted by event ID, as they are when read from an
+ * event file.
+ */
+Span<const Primary> select_primaries(Span<const Primary>        primaries,
+                                     EventScheduler::EventRange events)
+{
+    if (events.empty())
+    {
+        return {};
+    }
+
+    auto by_event = [](const Primary& p, EventId id) {
+        return p.event_id < id;
+    };
+    auto first = std::lower_bound(
+        primaries.begin(), primaries.end(), events.front(), by_event);
+    auto last = std::lower_bound(
+        first, primaries.end(), *events.end(), by_event);
+    return {first, last};
+}
+
+//---------------------------------------------------------------------------//
+} // namespace demo_loop
@@ -0,0 +1,85 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file LDemoScheduler.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Range.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "comm/AtomicCounter.hh"
+#include "physics/base/Primary.hh"
+
+namespace demo_loop
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Hand out batches of events to processes on demand.
+ *
+ * The index of the next unclaimed event is a counter shared by all processes,
+ * so a process that runs low on work claims the next batch without waiting
+ * for the others. Because shower sizes vary widely between events, this
+ * balances the load better than a static split.
+ *
+ * Construction is collective over the communicator.
+ */
+class EventScheduler
+{
+  public:
+    //!@{
+    //! Type aliases
+    using size_type  = celeritas::size_type;
+    using EventId    = celeritas::EventId;
+    using EventRange = celeritas::Range<EventId>;
+    //!@}
+
+    //! Construction arguments
+    struct Input
+    {
+        size_type num_events{}; //!< Total number of events
+        size_type batch_size{}; //!< Events claimed per request
+    };
+
+  public:
+    // Construct with total number of events and batch size
+    EventScheduler(const celeritas::Communicator& comm, const Input& inp);
+
+    // Claim the next batch of events (empty when all are claimed)
+    EventRange next_batch();
+
+    //// ACCESSORS ////
+
+    //! Whether all events have been claimed
+    bool finished() const { return finished_; }
+
+    //! Number of events claimed by this process
+    size_type num_events() const { return num_events_; }
+
+    //! Number of batches claimed by this process
+    size_type num_batches() const { return num_batches_; }
+
+    //! Time spent claiming batches [s]
+    double request_time() const { return request_time_; }
+
+  private:
+    celeritas::AtomicCounter next_event_;
+    Input                    inp_;
+    bool                     finished_     = false;
+    size_type                num_events_   = 0;
+    size_type                num_batches_  = 0;
+    double                   request_time_ = 0;
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+// Get the primaries belonging to a range of events
+celeritas::Span<const celeritas::Primary>
+select_primaries(celeritas::Span<const celeritas::Primary> primaries,
+                 EventScheduler::EventRange                events);
+
+//---------------------------------------------------------------------------//
+} // namespace demo_loop
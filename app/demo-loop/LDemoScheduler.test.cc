@@ -0,0 +1,119 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file LDemoScheduler.test.cc
+//---------------------------------------------------------------------------//
+#include "LDemoScheduler.hh"
+
+#include <vector>
+#include "comm/Communicator.hh"
+#include "comm/Operations.hh"
+
+#include "celeritas_test.hh"
+
+using demo_loop::EventScheduler;
+using demo_loop::select_primaries;
+using celeritas::Communicator;
+using celeritas::EventId;
+using celeritas::Operation;
+using celeritas::Primary;
+
+#if CELERITAS_USE_MPI
+#    define TEST_IF_CELERITAS_MPI(name) name
+#else
+#    define TEST_IF_CELERITAS_MPI(name) DISABLED_##name
+#endif
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class EventSchedulerTest : public celeritas::Test
+{
+  protected:
+    using EventRange = EventScheduler::EventRange;
+    using VecEvent   = std::vector<EventId::size_type>;
+
+    //! First and last (exclusive) event of a batch
+    static VecEvent to_vec(const EventRange& batch)
+    {
+        return {batch.front().get(), batch.front().get() + batch.size()};
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(EventSchedulerTest, null)
+{
+    EventScheduler schedule(Communicator{}, {7, 3});
+    EXPECT_FALSE(schedule.finished());
+
+    EXPECT_VEC_EQ((VecEvent{0, 3}), to_vec(schedule.next_batch()));
+    EXPECT_VEC_EQ((VecEvent{3, 6}), to_vec(schedule.next_batch()));
+    EXPECT_VEC_EQ((VecEvent{6, 7}), to_vec(schedule.next_batch()));
+    EXPECT_FALSE(schedule.finished());
+
+    // Exhausted
+    EXPECT_TRUE(schedule.next_batch().empty());
+    EXPECT_TRUE(schedule.finished());
+    EXPECT_TRUE(schedule.next_batch().empty());
+
+    EXPECT_EQ(7, schedule.num_events());
+    EXPECT_EQ(3, schedule.num_batches());
+    EXPECT_LE(0, schedule.request_time());
+}
+
+TEST_F(EventSchedulerTest, TEST_IF_CELERITAS_MPI(world))
+{
+    Communicator comm = Communicator::comm_world();
+
+    // Every event is claimed by exactly one process
+    constexpr unsigned int num_events = 100;
+    constexpr unsigned int batch_size = 3;
+    std::vector<int>       claimed(num_events, 0);
+    {
+        EventScheduler schedule(comm, {num_events, batch_size});
+        for (auto batch = schedule.next_batch(); !batch.empty();
+             batch      = schedule.next_batch())
+        {
+            EXPECT_LE(batch.size(), batch_size);
+            for (EventId event : batch)
+            {
+                ++claimed[event.get()];
+            }
+        }
+        EXPECT_TRUE(schedule.finished());
+
+        int num_local = schedule.num_events();
+        EXPECT_EQ(int(num_events),
+                  allreduce(comm, Operation::sum, num_local));
+    }
+    allreduce(comm, Operation::sum, celeritas::make_span(claimed));
+    EXPECT_EQ(std::vector<int>(num_events, 1), claimed);
+}
+
+TEST_F(EventSchedulerTest, select_primaries)
+{
+    // Primaries of events 0 through 4, with no primaries in event 2
+    std::vector<Primary> primaries;
+    for (unsigned int event : {0, 0, 1, 3, 3, 3, 4})
+    {
+        Primary p;
+        p.event_id = EventId{event};
+        primaries.push_back(p);
+    }
+    auto all = celeritas::make_span(primaries);
+
+    auto batch = select_primaries(all, {EventId{1}, EventId{4}});
+    ASSERT_EQ(4, batch.size());
+    EXPECT_EQ(all.data() + 2, batch.data());
+
+    EXPECT_EQ(2, select_primaries(all, {EventId{0}, EventId{1}}).size());
+    EXPECT_EQ(0, select_primaries(all, {EventId{2}, EventId{3}}).size());
+    EXPECT_EQ(1, select_primaries(all, {EventId{4}, EventId{5}}).size());
+    EXPECT_EQ(0, select_primaries(all, {}).size());
+}
@@ -14,6 +14,7 @@
 #include <nlohmann/json.hpp>
 
 #include "celeritas_version.h"
+#include "base/CachingAllocatorIO.json.hh"
 #include "comm/Communicator.hh"
 #include "comm/Device.hh"
 #include "comm/DeviceIO.json.hh"
@@ -35,8 +36,12 @@ namespace
 //---------------------------------------------------------------------------//
 /*!
  * Run, launch, and output.
+ *
+ * Each process transports its share of the events, and the combined result
+ * is written by the first process. The runtime diagnostics are those of the
+ * first process.
  */
-void run(std::istream& is)
+void run(std::istream& is, const celeritas::Communicator& comm)
 {
     // Read input options
     auto inp = nlohmann::json::parse(is);
@@ -45,7 +50,11 @@ void run(std::istream& is)
     auto run_args = inp.at("run").get<LDemoArgs>();
     CELER_EXPECT(run_args);
 
-    auto result = run_gpu(run_args);
+    auto result = run_gpu(run_args, comm);
+    if (comm.rank() != 0)
+    {
+        return;
+    }
 
     nlohmann::json outp = {
         {"run", run_args},
@@ -56,6 +65,7 @@ void run(std::istream& is)
                 {"version", std::string(celeritas_version)},
                 {"device", celeritas::device()},
                 {"kernels", celeritas::kernel_diagnostics()},
+                {"allocator", celeritas::device_allocator().stats()},
             },
         },
     };
@@ -79,12 +89,6 @@ int main(int argc, char* argv[])
                ? Communicator{}
                : Communicator::comm_world());
 
-    if (comm.size() > 1)
-    {
-        CELER_LOG(critical) << "TODO: this app cannot run in parallel";
-        return EXIT_FAILURE;
-    }
-
     // Process input arguments
     std::vector<std::string> args(argv, argv + argc);
     if (args.size() != 2 || args[1] == "--help" || args[1] == "-h")
@@ -124,7 +128,7 @@ int main(int argc, char* argv[])
 
     try
     {
-        run(*instream);
+        run(*instream, comm);
     }
     catch (const std::exception& e)
     {
@@ -35,11 +35,14 @@ inp = {
         'hepmc3_filename': hepmc3_filename,
         'seed': 12345,
         'max_num_tracks': 128 * 32,
-        'max_steps': 128
+        'max_steps': 128,
+        'event_split': environ.get('CELERITAS_DEMO_EVENT_SPLIT', 'cyclic')
     }
 }
 
 exe = environ.get('CELERITAS_DEMO_EXE', './demo-loop')
+# Optional MPI launch command, e.g. "mpiexec -n 2"
+launcher = environ.get('CELERITAS_DEMO_LAUNCHER', '').split()
 
 print("Input:")
 with open(f'{exe}.inp.json', 'w') as f:
@@ -47,7 +50,7 @@ with open(f'{exe}.inp.json', 'w') as f:
 print(json.dumps(inp, indent=1))
 
 print("Running", exe)
-result = subprocess.run([exe, '-'],
+result = subprocess.run(launcher + [exe, '-'],
                         input=json.dumps(inp).encode(),
                         stdout=subprocess.PIPE)
 if result.returncode:
@@ -8,6 +8,7 @@
 #include "ImageIO.hh"
 
 #include "ImageStore.hh"
+#include "RDemoKernel.hh"
 
 namespace demo_rasterizer
 {
@@ -40,6 +41,14 @@ void to_json(nlohmann::json& j, const ImageStore& v)
                        {"int_size", sizeof(int)}};
 }
 
+void to_json(nlohmann::json& j, const TraceThreadResult& v)
+{
+    j = nlohmann::json{
+        {"num_rays", v.num_rays},
+        {"time", v.time},
+        {"rays_per_sec", v.time > 0 ? v.num_rays / v.time : 0.0}};
+}
+
 //!@}
 //---------------------------------------------------------------------------//
 } // namespace demo_rasterizer
@@ -16,6 +16,7 @@
 namespace demo_rasterizer
 {
 class ImageStore;
+struct TraceThreadResult;
 //---------------------------------------------------------------------------//
 //! Image construction arguments
 struct ImageRunArgs
@@ -30,6 +31,8 @@ void to_json(nlohmann::json& j, const ImageRunArgs& value);
 void from_json(const nlohmann::json& j, ImageRunArgs& value);
 
 void to_json(nlohmann::json& j, const ImageStore& value);
+
+void to_json(nlohmann::json& j, const TraceThreadResult& value);
 //---------------------------------------------------------------------------//
 } // namespace demo_rasterizer
 
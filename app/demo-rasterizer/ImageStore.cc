@@ -17,8 +17,10 @@ namespace demo_rasterizer
 //---------------------------------------------------------------------------//
 /*!
  * Construct with image slice and extents.
+ *
+ * The image is allocated in the memory space where it will be traced.
  */
-ImageStore::ImageStore(ImageRunArgs params)
+ImageStore::ImageStore(ImageRunArgs params, MemSpace m) : memspace_(m)
 {
     CELER_EXPECT(celeritas::is_soft_unit_vector(
         params.rightward_ax, celeritas::SoftEqual<real_type>{}));
@@ -63,25 +65,29 @@ ImageStore::ImageStore(ImageRunArgs params)
     }
 
     // Allocate storage
-    dims_  = {num_y, num_x};
-    image_ = celeritas::DeviceVector<int>(num_y * num_x);
-    CELER_ENSURE(!image_.empty());
+    dims_ = {num_y, num_x};
+    if (memspace_ == MemSpace::device)
+    {
+        image_ = celeritas::DeviceVector<int>(num_y * num_x);
+        CELER_ENSURE(!image_.empty());
+    }
+    else
+    {
+        host_image_.resize(num_y * num_x);
+        CELER_ENSURE(!host_image_.empty());
+    }
 }
 
 //---------------------------------------------------------------------------//
 /*!
- * Access image on host for initializing.
+ * Access image on host for writing.
  */
 ImagePointers ImageStore::host_interface()
 {
-    ImagePointers result;
-
-    result.origin      = origin_;
-    result.down_ax     = down_ax_;
-    result.right_ax    = right_ax_;
-    result.pixel_width = pixel_width_;
-    result.dims        = dims_;
+    CELER_EXPECT(memspace_ == MemSpace::host);
 
+    ImagePointers result = this->base_interface();
+    result.image         = celeritas::make_span(host_image_);
     return result;
 }
 
@@ -91,15 +97,10 @@ ImagePointers ImageStore::host_interface()
  */
 ImagePointers ImageStore::device_interface()
 {
-    ImagePointers result;
-
-    result.origin      = origin_;
-    result.down_ax     = down_ax_;
-    result.right_ax    = right_ax_;
-    result.pixel_width = pixel_width_;
-    result.dims        = dims_;
-    result.image       = image_.device_pointers();
+    CELER_EXPECT(memspace_ == MemSpace::device);
 
+    ImagePointers result = this->base_interface();
+    result.image         = image_.device_pointers();
     return result;
 }
 
@@ -109,10 +110,32 @@ ImagePointers ImageStore::device_interface()
  */
 auto ImageStore::data_to_host() const -> VecInt
 {
+    if (memspace_ == MemSpace::host)
+    {
+        return host_image_;
+    }
+
     VecInt result(dims_[0] * dims_[1]);
     image_.copy_to_host(celeritas::make_span(result));
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the image geometry without the pixel storage.
+ */
+ImagePointers ImageStore::base_interface() const
+{
+    ImagePointers result;
+
+    result.origin      = origin_;
+    result.down_ax     = down_ax_;
+    result.right_ax    = right_ax_;
+    result.pixel_width = pixel_width_;
+    result.dims        = dims_;
+
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace demo_rasterizer
@@ -30,18 +30,19 @@ class ImageStore
     using UInt2     = celeritas::Array<unsigned int, 2>;
     using Real3     = celeritas::Real3;
     using VecInt    = std::vector<int>;
+    using MemSpace  = celeritas::MemSpace;
     //!@}
 
   public:
-    // Construct with defaults
-    explicit ImageStore(ImageRunArgs);
+    // Construct with image slice and the memory space to store it in
+    ImageStore(ImageRunArgs, MemSpace m);
 
     //// DEVICE ACCESSORS ////
 
-    //! Access image on host for initializing
+    // Access image on host for writing
     ImagePointers host_interface();
 
-    //! Access image on device for writing
+    // Access image on device for writing
     ImagePointers device_interface();
 
     //// HOST ACCESSORS ////
@@ -61,6 +62,9 @@ class ImageStore
     //! Dimensions {j, i} of the image
     const UInt2& dims() const { return dims_; }
 
+    //! Memory space in which the image is stored
+    MemSpace memspace() const { return memspace_; }
+
     // Copy out the image to the host
     VecInt data_to_host() const;
 
@@ -70,7 +74,11 @@ class ImageStore
     Real3                        right_ax_;
     real_type                    pixel_width_;
     UInt2                        dims_;
+    MemSpace                     memspace_;
     celeritas::DeviceVector<int> image_;
+    VecInt                       host_image_;
+
+    ImagePointers base_interface() const;
 };
 
 //---------------------------------------------------------------------------//
@@ -0,0 +1,90 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file KernelUtils.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cmath>
+#include "base/Macros.hh"
+#include "geometry/GeoTrackView.hh"
+#include "ImageTrackView.hh"
+
+namespace demo_rasterizer
+{
+//---------------------------------------------------------------------------//
+// INLINE HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Get the volume ID as an integer, or -1 if outside.
+ */
+inline CELER_FUNCTION int geo_id(const celeritas::GeoTrackView& geo)
+{
+    if (geo.is_outside())
+        return -1;
+    return geo.volume_id().get();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Trace a single line of the image from left to right.
+ *
+ * Each pixel is assigned the ID of the volume that occupies the largest
+ * fraction of its width. This is shared by the host and device tracers.
+ */
+inline CELER_FUNCTION void trace_line(const ImagePointers&     image_state,
+                                      ImageTrackView&          image,
+                                      celeritas::GeoTrackView& geo)
+{
+    using celeritas::real_type;
+
+    // Start track at the leftmost point in the requested direction
+    geo = celeritas::GeoTrackInitializer{image.start_pos(), image.start_dir()};
+
+    const real_type max_step = image_state.dims[1] * image_state.pixel_width;
+
+    int       cur_id   = geo_id(geo);
+    real_type geo_dist = std::fmin(geo.next_step(), max_step);
+
+    // Track along each pixel
+    for (unsigned int i = 0; i < image_state.dims[1]; ++i)
+    {
+        real_type pix_dist = image_state.pixel_width;
+        real_type max_dist = 0;
+        int       max_id   = cur_id;
+        while (geo_dist <= pix_dist)
+        {
+            // Move to geometry boundary
+            pix_dist -= geo_dist;
+
+            if (max_id == cur_id)
+            {
+                max_dist += geo_dist;
+            }
+            else if (geo_dist > max_dist)
+            {
+                max_dist = geo_dist;
+                max_id   = cur_id;
+            }
+
+            // Cross surface
+            geo.move_next_step();
+            cur_id   = geo_id(geo);
+            geo_dist = std::fmin(geo.next_step(), max_step);
+        }
+
+        // Move to pixel boundary
+        geo_dist -= pix_dist;
+        if (pix_dist > max_dist)
+        {
+            max_dist = pix_dist;
+            max_id   = cur_id;
+        }
+        image.set_pixel(i, max_id);
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace demo_rasterizer
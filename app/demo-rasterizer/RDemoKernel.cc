@@ -0,0 +1,99 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RDemoKernel.cc
+//---------------------------------------------------------------------------//
+#include "RDemoKernel.hh"
+
+#include "celeritas_config.h"
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
+
+#include "base/CollectionBuilder.hh"
+#include "base/Stopwatch.hh"
+#include "KernelUtils.hh"
+
+using namespace celeritas;
+
+namespace demo_rasterizer
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+int num_host_threads()
+{
+#if CELERITAS_USE_OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+int host_thread_id()
+{
+#if CELERITAS_USE_OPENMP
+    return omp_get_thread_num();
+#else
+    return 0;
+#endif
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+// KERNEL INTERFACE
+//---------------------------------------------------------------------------//
+/*!
+ * Trace an image on host.
+ *
+ * Image lines are dynamically scheduled across the available threads. Each
+ * thread owns (and first touches) a single-track geometry state, so the only
+ * shared data written is the image, whose rows are disjoint between threads.
+ * The pixel layout is identical to the device tracer.
+ */
+VecTraceThreadResult
+trace(const GeoParamsCRefHost& geo_params, const ImagePointers& image)
+{
+    CELER_EXPECT(geo_params);
+    CELER_EXPECT(image);
+
+    VecTraceThreadResult result(num_host_threads());
+    const int            num_lines = image.dims[0];
+
+#if CELERITAS_USE_OPENMP
+#    pragma omp parallel
+#endif
+    {
+        using GeoStateValue = GeoStateData<Ownership::value, MemSpace::host>;
+
+        GeoStateValue geo_state;
+        resize(&geo_state, geo_params, 1);
+        auto geo_state_ref = make_ref(geo_state);
+
+        size_type num_rays = 0;
+        Stopwatch get_time;
+
+#if CELERITAS_USE_OPENMP
+#    pragma omp for schedule(dynamic) nowait
+#endif
+        for (int j = 0; j < num_lines; ++j)
+        {
+            ImageTrackView image_line(image, ThreadId(j));
+            GeoTrackView   geo(geo_params, geo_state_ref, ThreadId{0});
+
+            trace_line(image, image_line, geo);
+            ++num_rays;
+        }
+
+        TraceThreadResult& thread_result = result[host_thread_id()];
+        thread_result.num_rays           = num_rays;
+        thread_result.time               = get_time();
+    }
+
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace demo_rasterizer
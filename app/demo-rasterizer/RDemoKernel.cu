@@ -9,9 +9,7 @@
 
 #include "base/Assert.hh"
 #include "base/KernelParamCalculator.cuda.hh"
-#include "geometry/GeoTrackView.hh"
-#include "ImageTrackView.hh"
-#include <cmath>
+#include "KernelUtils.hh"
 
 using namespace celeritas;
 using namespace demo_rasterizer;
@@ -24,13 +22,6 @@ namespace
 // KERNELS
 //---------------------------------------------------------------------------//
 
-__device__ int geo_id(const GeoTrackView& geo)
-{
-    if (geo.is_outside())
-        return -1;
-    return geo.volume_id().get();
-}
-
 __global__ void trace_kernel(const GeoParamsCRefDevice geo_params,
                              const GeoStateRefDevice   geo_state,
                              const ImagePointers       image_state)
@@ -42,50 +33,7 @@ __global__ void trace_kernel(const GeoParamsCRefDevice geo_params,
     ImageTrackView image(image_state, tid);
     GeoTrackView   geo(geo_params, geo_state, tid);
 
-    // Start track at the leftmost point in the requested direction
-    geo = GeoTrackInitializer{image.start_pos(), image.start_dir()};
-
-    int       cur_id   = geo_id(geo);
-    real_type geo_dist = std::fmin(
-        geo.next_step(), image_state.dims[1] * image_state.pixel_width);
-
-    // Track along each pixel
-    for (unsigned int i = 0; i < image_state.dims[1]; ++i)
-    {
-        real_type pix_dist = image_state.pixel_width;
-        real_type max_dist = 0;
-        int       max_id   = cur_id;
-        while (geo_dist <= pix_dist)
-        {
-            // Move to geometry boundary
-            pix_dist -= geo_dist;
-
-            if (max_id == cur_id)
-            {
-                max_dist += geo_dist;
-            }
-            else if (geo_dist > max_dist)
-            {
-                max_dist = geo_dist;
-                max_id   = cur_id;
-            }
-
-            // Cross surface
-            geo.move_next_step();
-            cur_id   = geo_id(geo);
-            geo_dist = std::fmin(geo.next_step(),
-                                 image_state.dims[1] * image_state.pixel_width);
-        }
-
-        // Move to pixel boundary
-        geo_dist -= pix_dist;
-        if (pix_dist > max_dist)
-        {
-            max_dist = pix_dist;
-            max_id   = cur_id;
-        }
-        image.set_pixel(i, max_id);
-    }
+    trace_line(image_state, image, geo);
 }
 } // namespace
 
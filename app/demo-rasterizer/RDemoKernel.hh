@@ -7,6 +7,8 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <vector>
+#include "base/Assert.hh"
 #include "geometry/GeoInterface.hh"
 #include "ImageInterface.hh"
 
@@ -21,10 +23,40 @@ using GeoParamsCRefDevice
     = celeritas::GeoParamsData<Ownership::const_reference, MemSpace::device>;
 using GeoStateRefDevice
     = celeritas::GeoStateData<Ownership::reference, MemSpace::device>;
+using GeoParamsCRefHost
+    = celeritas::GeoParamsData<Ownership::const_reference, MemSpace::host>;
 
+//---------------------------------------------------------------------------//
+/*!
+ * Throughput of a single host thread during tracing.
+ */
+struct TraceThreadResult
+{
+    celeritas::size_type num_rays = 0; //!< Number of image lines traced
+    double               time     = 0; //!< Wall time spent tracing [s]
+};
+
+//! Per-thread results, indexed by host thread number
+using VecTraceThreadResult = std::vector<TraceThreadResult>;
+
+//---------------------------------------------------------------------------//
+// Trace an image on device
 void trace(const GeoParamsCRefDevice& geo_params,
            const GeoStateRefDevice&   geo_state,
            const ImagePointers&       image);
 
+// Trace an image on host, distributing image lines across threads
+VecTraceThreadResult
+trace(const GeoParamsCRefHost& geo_params, const ImagePointers& image);
+
+//---------------------------------------------------------------------------//
+#if !CELERITAS_USE_CUDA
+inline void
+trace(const GeoParamsCRefDevice&, const GeoStateRefDevice&, const ImagePointers&)
+{
+    CELER_NOT_CONFIGURED("CUDA");
+}
+#endif
+
 //---------------------------------------------------------------------------//
 } // namespace demo_rasterizer
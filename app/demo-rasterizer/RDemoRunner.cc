@@ -14,7 +14,6 @@
 #include "comm/Logger.hh"
 #include "geometry/GeoParams.hh"
 #include "ImageTrackView.hh"
-#include "RDemoKernel.hh"
 
 using namespace celeritas;
 
@@ -34,20 +33,42 @@ RDemoRunner::RDemoRunner(SPConstGeo geometry)
 /*!
  * Trace an image.
  */
-void RDemoRunner::operator()(ImageStore* image) const
+auto RDemoRunner::operator()(ImageStore* image) const -> result_type
 {
     CELER_EXPECT(image);
 
-    CollectionStateStore<GeoStateData, MemSpace::device> geo_state(
-        *geo_params_, image->dims()[0]);
+    result_type result;
+    if (image->memspace() == MemSpace::device)
+    {
+        CollectionStateStore<GeoStateData, MemSpace::device> geo_state(
+            *geo_params_, image->dims()[0]);
 
-    CELER_LOG(status) << "Tracing geometry";
-    Stopwatch get_time;
-    trace(geo_params_->device_pointers(),
-          geo_state.ref(),
-          image->device_interface());
-    CELER_LOG(diagnostic) << color_code('x') << "... " << get_time() << " s"
-                          << color_code(' ');
+        CELER_LOG(status) << "Tracing geometry";
+        Stopwatch get_time;
+        trace(geo_params_->device_pointers(),
+              geo_state.ref(),
+              image->device_interface());
+        CELER_LOG(diagnostic) << color_code('x') << "... " << get_time()
+                              << " s" << color_code(' ');
+    }
+    else
+    {
+        CELER_LOG(status) << "Tracing geometry on host";
+        Stopwatch get_time;
+        result = trace(geo_params_->host_pointers(), image->host_interface());
+        CELER_LOG(diagnostic) << color_code('x') << "... " << get_time()
+                              << " s" << color_code(' ');
+
+        for (auto thread : range(result.size()))
+        {
+            const TraceThreadResult& r = result[thread];
+            CELER_LOG(diagnostic)
+                << "Thread " << thread << " traced " << r.num_rays
+                << " rays in " << r.time << " s ("
+                << (r.time > 0 ? r.num_rays / r.time : 0) << " rays/s)";
+        }
+    }
+    return result;
 }
 
 //---------------------------------------------------------------------------//
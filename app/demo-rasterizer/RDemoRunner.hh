@@ -10,20 +10,25 @@
 #include <memory>
 #include "geometry/GeoParams.hh"
 #include "ImageStore.hh"
+#include "RDemoKernel.hh"
 
 namespace demo_rasterizer
 {
 //---------------------------------------------------------------------------//
 /*!
- * Set up and run rasterization of the given device image.
+ * Set up and run rasterization of the given image.
+ *
+ * The image is traced on device or host depending on where its storage lives.
+ * Host tracing returns the throughput of each thread.
  */
 class RDemoRunner
 {
   public:
     //!@{
     //! Type aliases
-    using SPConstGeo = std::shared_ptr<const celeritas::GeoParams>;
-    using Args       = ImageRunArgs;
+    using SPConstGeo  = std::shared_ptr<const celeritas::GeoParams>;
+    using Args        = ImageRunArgs;
+    using result_type = VecTraceThreadResult;
     //!@}
 
   public:
@@ -31,7 +36,7 @@ class RDemoRunner
     explicit RDemoRunner(SPConstGeo geometry);
 
     // Trace an image
-    void operator()(ImageStore* image) const;
+    result_type operator()(ImageStore* image) const;
 
   private:
     SPConstGeo geo_params_;
@@ -45,17 +45,25 @@ void run(std::istream& is)
     auto geo_params = std::make_shared<GeoParams>(
         inp.at("input").get<std::string>().c_str());
 
-    if (inp.count("cuda_stack_size"))
+    if (inp.count("cuda_stack_size") && celeritas::device())
     {
         GeoParams::set_cuda_stack_size(inp.at("cuda_stack_size").get<int>());
     }
 
+    // Trace on device if available, unless host tracing is requested
+    bool use_device = static_cast<bool>(celeritas::device());
+    if (inp.count("use_device"))
+    {
+        use_device = use_device && inp.at("use_device").get<bool>();
+    }
+
     // Construct image
-    ImageStore image(inp.at("image").get<ImageRunArgs>());
+    ImageStore image(inp.at("image").get<ImageRunArgs>(),
+                     use_device ? MemSpace::device : MemSpace::host);
 
     // Construct runner
     RDemoRunner run(geo_params);
-    run(&image);
+    auto        thread_results = run(&image);
 
     // Get geometry names
     std::vector<std::string> vol_names;
@@ -66,7 +74,7 @@ void run(std::istream& is)
     }
 
     // Write image
-    CELER_LOG(status) << "Transferring image from GPU to disk";
+    CELER_LOG(status) << "Transferring image to disk";
     std::string out_filename = inp.at("output");
     auto        image_data   = image.data_to_host();
     std::ofstream(out_filename, std::ios::binary)
@@ -85,6 +93,7 @@ void run(std::istream& is)
                 {"version", std::string(celeritas_version)},
                 {"device", celeritas::device()},
                 {"kernels", celeritas::kernel_diagnostics()},
+                {"threads", thread_results},
             },
         },
     };
@@ -137,13 +146,14 @@ int main(int argc, char* argv[])
         instream_ptr = &std::cin;
     }
 
-    // Initialize GPU
-    celeritas::activate_device(Device(0));
-
+    // Initialize GPU if available; otherwise trace on the host
+    if (Device::num_devices() > 0)
+    {
+        celeritas::activate_device(Device(0));
+    }
     if (!celeritas::device())
     {
-        CELER_LOG(critical) << "CUDA capability is disabled";
-        return EXIT_FAILURE;
+        CELER_LOG(info) << "CUDA capability is disabled: tracing on host";
     }
 
     try
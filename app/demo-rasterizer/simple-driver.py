@@ -54,3 +54,7 @@ except json.decoder.JSONDecodeError as e:
 print(json.dumps(result, indent=1))
 with open(f'{exe}.out.json', 'w') as f:
     json.dump(result, f)
+
+for (i, t) in enumerate(result['runtime']['threads']):
+    print(f"Thread {i} traced {t['num_rays']} rays "
+          f"at {t['rays_per_sec']:.1f} rays/s")
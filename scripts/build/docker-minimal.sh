@@ -36,6 +36,7 @@ cmake -G Ninja \
   -DCELERITAS_USE_ROOT:BOOL=OFF \
   -DCELERITAS_USE_VecGeom:BOOL=OFF \
   -DCELERITAS_DEBUG:BOOL=ON \
+  -DCELERITAS_SIZE32:BOOL=ON \
   -DCMAKE_BUILD_TYPE:STRING="RelWithDebInfo" \
   -DMEMORYCHECK_COMMAND_OPTIONS="--error-exitcode=1 --leak-check=full" \
   ${SOURCE_DIR}
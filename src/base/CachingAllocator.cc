@@ -0,0 +1,278 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CachingAllocator.cc
+//---------------------------------------------------------------------------//
+#include "CachingAllocator.hh"
+
+#include "celeritas_config.h"
+#if CELERITAS_USE_CUDA
+#    include <cuda_runtime_api.h>
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <ostream>
+#include "Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the memory space of the backend and default options.
+ */
+CachingAllocator::CachingAllocator(MemSpace m)
+    : CachingAllocator(m, Options{})
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the memory space of the backend.
+ */
+CachingAllocator::CachingAllocator(MemSpace m, const Options& opts)
+    : memspace_(m), opts_(opts)
+{
+    CELER_EXPECT(opts_.min_bin_bytes > 0);
+    CELER_EXPECT(opts_.min_bin_bytes <= opts_.max_bin_bytes);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Release cached memory.
+ *
+ * Blocks that are still in use are not freed.
+ */
+CachingAllocator::~CachingAllocator()
+{
+    try
+    {
+        std::lock_guard<std::mutex> scoped_lock(mutex_);
+        this->release_cached_impl();
+    }
+    catch (...)
+    {
+        // Ignore errors (e.g. from a CUDA context that's been torn down)
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a block of at least the given number of bytes.
+ *
+ * A null pointer is returned for zero-byte requests.
+ */
+void* CachingAllocator::allocate(std::size_t bytes)
+{
+    if (bytes == 0)
+        return nullptr;
+
+    const std::size_t block = this->block_size(bytes);
+
+    std::lock_guard<std::mutex> scoped_lock(mutex_);
+    void*                       ptr  = nullptr;
+    auto                        iter = free_blocks_.find(block);
+    if (iter != free_blocks_.end() && !iter->second.empty())
+    {
+        // Reuse a cached block
+        ptr = iter->second.back();
+        iter->second.pop_back();
+        stats_.bytes_cached -= block;
+        ++stats_.num_hits;
+    }
+    else
+    {
+        ptr = this->backend_allocate(block);
+        ++stats_.num_misses;
+        stats_.peak_bytes = std::max(
+            stats_.peak_bytes, stats_.bytes_in_use + stats_.bytes_cached + block);
+    }
+
+    stats_.bytes_in_use += block;
+    used_blocks_.emplace(ptr, block);
+    CELER_ENSURE(ptr);
+    return ptr;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Return a block to the cache.
+ *
+ * Blocks larger than the largest size class (or all blocks, if caching is
+ * disabled) are returned directly to the backend.
+ */
+void CachingAllocator::deallocate(void* ptr)
+{
+    if (!ptr)
+        return;
+
+    std::lock_guard<std::mutex> scoped_lock(mutex_);
+    auto                        iter = used_blocks_.find(ptr);
+    CELER_VALIDATE(iter != used_blocks_.end(),
+                   << "pointer " << ptr << " was not allocated by this cache");
+    const std::size_t block = iter->second;
+    used_blocks_.erase(iter);
+    stats_.bytes_in_use -= block;
+
+    if (opts_.caching && block <= opts_.max_bin_bytes)
+    {
+        free_blocks_[block].push_back(ptr);
+        stats_.bytes_cached += block;
+    }
+    else
+    {
+        this->backend_free(ptr);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Return all cached blocks to the backend.
+ */
+void CachingAllocator::release_cached()
+{
+    std::lock_guard<std::mutex> scoped_lock(mutex_);
+    this->release_cached_impl();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get a snapshot of the allocation statistics.
+ */
+CachingAllocatorStats CachingAllocator::stats() const
+{
+    std::lock_guard<std::mutex> scoped_lock(mutex_);
+    return stats_;
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Get the size class for a request.
+ */
+std::size_t CachingAllocator::block_size(std::size_t bytes) const
+{
+    if (bytes > opts_.max_bin_bytes)
+        return bytes;
+
+    std::size_t result = opts_.min_bin_bytes;
+    while (result < bytes)
+    {
+        result *= 2;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate from the backend, releasing the cache and retrying on failure.
+ *
+ * The mutex must be locked by the caller.
+ */
+void* CachingAllocator::backend_allocate(std::size_t bytes)
+{
+    void* ptr = nullptr;
+    if (memspace_ == MemSpace::host)
+    {
+        ptr = std::malloc(bytes);
+        if (!ptr && stats_.bytes_cached > 0)
+        {
+            this->release_cached_impl();
+            ptr = std::malloc(bytes);
+        }
+        if (!ptr)
+        {
+            throw std::bad_alloc();
+        }
+        return ptr;
+    }
+
+#if CELERITAS_USE_CUDA
+    if (cudaMalloc(&ptr, bytes) != cudaSuccess)
+    {
+        // Clear the error and try again after freeing the cache
+        cudaGetLastError();
+        this->release_cached_impl();
+        CELER_CUDA_CALL(cudaMalloc(&ptr, bytes));
+    }
+#else
+    CELER_NOT_CONFIGURED("CUDA");
+#endif
+    return ptr;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Return a block to the backend.
+ */
+void CachingAllocator::backend_free(void* ptr)
+{
+    if (memspace_ == MemSpace::host)
+    {
+        std::free(ptr);
+        return;
+    }
+    CELER_CUDA_CALL(cudaFree(ptr));
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Free all cached blocks.
+ *
+ * The mutex must be locked by the caller.
+ */
+void CachingAllocator::release_cached_impl()
+{
+    for (auto& size_blocks : free_blocks_)
+    {
+        for (void* ptr : size_blocks.second)
+        {
+            this->backend_free(ptr);
+        }
+    }
+    free_blocks_.clear();
+    stats_.bytes_cached = 0;
+}
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Global allocator used by DeviceAllocation.
+ *
+ * The allocator is never destroyed, since the CUDA runtime may be torn down
+ * before static destructors are called at program exit. Setting the \c
+ * CELER_DISABLE_DEVICE_CACHE environment variable to a nonempty value returns
+ * freed device memory immediately (statistics are still collected).
+ */
+CachingAllocator& device_allocator()
+{
+    static CachingAllocator* const result = [] {
+        CachingAllocator::Options opts;
+        const char* disable = std::getenv("CELER_DISABLE_DEVICE_CACHE");
+        opts.caching        = !(disable && disable[0] != '\0');
+        return new CachingAllocator(MemSpace::device, opts);
+    }();
+    return *result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the statistics to a stream.
+ */
+std::ostream& operator<<(std::ostream& os, const CachingAllocatorStats& s)
+{
+    os << "CachingAllocatorStats{num_hits=" << s.num_hits
+       << ", num_misses=" << s.num_misses
+       << ", bytes_in_use=" << s.bytes_in_use
+       << ", bytes_cached=" << s.bytes_cached
+       << ", peak_bytes=" << s.peak_bytes << '}';
+    return os;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,122 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CachingAllocator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+//! Allocation statistics for a caching allocator
+struct CachingAllocatorStats
+{
+    std::size_t num_hits     = 0; //!< Allocations served from the cache
+    std::size_t num_misses   = 0; //!< Allocations requiring a backend call
+    std::size_t bytes_in_use = 0; //!< Bytes currently handed out
+    std::size_t bytes_cached = 0; //!< Bytes held for reuse
+    std::size_t peak_bytes   = 0; //!< Max bytes obtained from the backend
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Reuse freed memory blocks grouped by size class.
+ *
+ * Requested sizes are rounded up to a power of two (no smaller than \c
+ * min_bin_bytes), and freed blocks are kept in a per-size free list rather
+ * than being returned to the backend. Requests larger than \c max_bin_bytes
+ * are allocated at their exact size and freed immediately. The memory space
+ * selects the backend: \c cudaMalloc for device memory and \c std::malloc for
+ * host memory, which allows the caching behavior to be used and tested in
+ * CPU-only builds.
+ *
+ * If the device backend runs out of memory, the cached blocks are released
+ * and the allocation is retried. All member functions are thread safe.
+ *
+ * The high-water mark \c peak_bytes includes cached blocks, so it reflects
+ * the actual footprint of the process in the given memory space.
+ */
+class CachingAllocator
+{
+  public:
+    //! Construction options
+    struct Options
+    {
+        //! Smallest size class
+        std::size_t min_bin_bytes = 256;
+        //! Largest cached size class
+        std::size_t max_bin_bytes = std::size_t(1) << 28;
+        //! Keep freed blocks for reuse
+        bool caching = true;
+    };
+
+  public:
+    // Construct with the memory space of the backend and default options
+    explicit CachingAllocator(MemSpace m);
+
+    // Construct with the memory space of the backend
+    CachingAllocator(MemSpace m, const Options& opts);
+
+    // Release cached memory
+    ~CachingAllocator();
+
+    //// ALLOCATION ////
+
+    // Get a block of at least the given number of bytes
+    void* allocate(std::size_t bytes);
+
+    // Return a block to the cache
+    void deallocate(void* ptr);
+
+    // Return all cached blocks to the backend
+    void release_cached();
+
+    //// ACCESSORS ////
+
+    //! Memory space of the backend
+    MemSpace memspace() const { return memspace_; }
+
+    //! Construction options
+    const Options& options() const { return opts_; }
+
+    // Get a snapshot of the allocation statistics
+    CachingAllocatorStats stats() const;
+
+  private:
+    using VecPtr = std::vector<void*>;
+
+    MemSpace                                memspace_;
+    Options                                 opts_;
+    mutable std::mutex                      mutex_;
+    std::unordered_map<std::size_t, VecPtr> free_blocks_;
+    std::unordered_map<void*, std::size_t>  used_blocks_;
+    CachingAllocatorStats                   stats_;
+
+    //// HELPER FUNCTIONS ////
+
+    std::size_t block_size(std::size_t bytes) const;
+    void*       backend_allocate(std::size_t bytes);
+    void        backend_free(void* ptr);
+    void        release_cached_impl();
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+// Global allocator used by DeviceAllocation
+CachingAllocator& device_allocator();
+
+// Write the statistics to a stream
+std::ostream& operator<<(std::ostream& os, const CachingAllocatorStats& s);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
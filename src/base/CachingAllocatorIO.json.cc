@@ -0,0 +1,28 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CachingAllocatorIO.json.cc
+//---------------------------------------------------------------------------//
+#include "CachingAllocatorIO.json.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Write allocation statistics out to JSON.
+ */
+void to_json(nlohmann::json& j, const CachingAllocatorStats& stats)
+{
+    j = nlohmann::json{
+        {"num_hits", stats.num_hits},
+        {"num_misses", stats.num_misses},
+        {"bytes_in_use", stats.bytes_in_use},
+        {"bytes_cached", stats.bytes_cached},
+        {"peak_bytes", stats.peak_bytes},
+    };
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
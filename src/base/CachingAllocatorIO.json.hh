@@ -0,0 +1,21 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CachingAllocatorIO.json.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <nlohmann/json.hpp>
+#include "CachingAllocator.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+
+// Write allocation statistics to JSON
+void to_json(nlohmann::json& j, const CachingAllocatorStats& stats);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <type_traits>
 #include "OpaqueId.hh"
 #include "Range.hh"
 #include "Types.hh"
@@ -134,6 +135,11 @@ struct AllItems
  * point to host or device memory, but the MemSpace template argument protects
  * against accidental accesses from the wrong memory space.
  *
+ * Host value storage uses \c HostAllocator, so its data are aligned to \c
+ * host_alignment bytes, large arrays are eligible for transparent huge pages,
+ * and (with OpenMP) large arrays allocated outside a parallel region are
+ * first touched by the threads that process their track slots.
+ *
  * Each Collection object is usually accessed with an ItemRange, which
  * references a
  * contiguous set of elements in the Collection. For example, setup code on the
@@ -194,6 +200,13 @@ class Collection
     template<Ownership W2, MemSpace M2>
     explicit inline Collection(Collection<T, W2, M2, I>& other);
 
+    //! Construct a reference to data owned elsewhere (e.g. shared memory)
+    template<Ownership W2 = W,
+             std::enable_if_t<W2 != Ownership::value, bool> = true>
+    explicit CELER_FUNCTION Collection(SpanT data) : storage_{data}
+    {
+    }
+
     //!@{
     //! Default assignment
     Collection& operator=(const Collection& other) = default;
@@ -0,0 +1,44 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CollectionMemory.cc
+//---------------------------------------------------------------------------//
+#include "CollectionMemory.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Total bytes in all visited collections.
+ */
+std::size_t CollectionMemory::total_bytes() const
+{
+    std::size_t result = 0;
+    for (const Entry& e : entries_)
+    {
+        result += e.bytes;
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Total bytes in visited collections in a memory space.
+ */
+std::size_t CollectionMemory::total_bytes(MemSpace m) const
+{
+    std::size_t result = 0;
+    for (const Entry& e : entries_)
+    {
+        if (e.memspace == m)
+        {
+            result += e.bytes;
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
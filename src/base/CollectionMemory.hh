@@ -0,0 +1,115 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CollectionMemory.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+#include "Collection.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Tally the memory used by the collections in a collection group.
+ *
+ * Collection groups (\c XParamsData, \c XStateData) list their collections
+ * and nested groups in a \c visit_members member function template, which
+ * mirrors the member-wise assignment operator:
+ * \code
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("elements", elements);
+        visit("materials", materials);
+    }
+   \endcode
+ *
+ * Nested members are named with a dot-separated path. Only collection
+ * storage is counted: scalar members, and storage not owned by a collection
+ * (such as VecGeom navigation states), are ignored.
+ *
+ * \code
+    CollectionMemory mem;
+    mem("physics", physics_data);
+    CELER_LOG(info) << "Physics uses " << mem.total_bytes() << " bytes";
+   \endcode
+ */
+class CollectionMemory
+{
+  public:
+    //! Memory used by a single collection
+    struct Entry
+    {
+        std::string name;     //!< Dot-separated path to the collection
+        MemSpace    memspace; //!< Where the data lives
+        size_type   size;     //!< Number of elements
+        std::size_t bytes;    //!< Size of the elements in bytes
+    };
+
+    using VecEntry = std::vector<Entry>;
+
+  public:
+    // Account for a collection
+    template<class T, Ownership W, MemSpace M, class I>
+    inline void operator()(const char* name, const Collection<T, W, M, I>& c);
+
+    // Account for all collections in a nested group
+    template<class G>
+    inline auto operator()(const char* name, const G& group)
+        -> decltype(group.visit_members(std::declval<CollectionMemory&>()));
+
+    //// ACCESSORS ////
+
+    //! All collections visited, in order
+    const VecEntry& entries() const { return entries_; }
+
+    // Total bytes in all visited collections
+    std::size_t total_bytes() const;
+
+    // Total bytes in visited collections in a memory space
+    std::size_t total_bytes(MemSpace m) const;
+
+  private:
+    VecEntry    entries_;
+    std::string prefix_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Account for a collection.
+ */
+template<class T, Ownership W, MemSpace M, class I>
+void CollectionMemory::operator()(const char*                     name,
+                                  const Collection<T, W, M, I>& c)
+{
+    entries_.push_back(
+        {prefix_ + name, M, c.size(), std::size_t(c.size()) * sizeof(T)});
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Account for all collections in a nested group.
+ */
+template<class G>
+auto CollectionMemory::operator()(const char* name, const G& group)
+    -> decltype(group.visit_members(std::declval<CollectionMemory&>()))
+{
+    std::string orig_prefix = prefix_;
+    prefix_ += name;
+    prefix_ += '.';
+    group.visit_members(*this);
+    prefix_ = std::move(orig_prefix);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,38 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CollectionMemoryIO.json.cc
+//---------------------------------------------------------------------------//
+#include "CollectionMemoryIO.json.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Write per-collection and total memory usage out to JSON.
+ */
+void to_json(nlohmann::json& j, const CollectionMemory& mem)
+{
+    auto members = nlohmann::json::array();
+    for (const auto& e : mem.entries())
+    {
+        members.push_back({
+            {"name", e.name},
+            {"memspace", e.memspace == MemSpace::host ? "host" : "device"},
+            {"size", e.size},
+            {"bytes", e.bytes},
+        });
+    }
+
+    j = nlohmann::json{
+        {"members", std::move(members)},
+        {"host_bytes", mem.total_bytes(MemSpace::host)},
+        {"device_bytes", mem.total_bytes(MemSpace::device)},
+        {"total_bytes", mem.total_bytes()},
+    };
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,20 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CollectionMemoryIO.json.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <nlohmann/json.hpp>
+#include "CollectionMemory.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+
+void to_json(nlohmann::json& j, const CollectionMemory& mem);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <memory>
 #include "base/Assert.hh"
 #include "base/Types.hh"
 
@@ -24,6 +25,8 @@ namespace celeritas
  * - Has a boolean operator returning whether it's in a valid state.
  *
  * On assignment, it will copy the data to the device if the GPU is enabled.
+ * The host data can also be stored elsewhere, e.g. in a block broadcast from
+ * another process: the mirror then keeps the storage alive and references it.
  *
  * Example:
  * \code
@@ -60,8 +63,12 @@ class CollectionMirror
     // Construct from host data
     explicit inline CollectionMirror(HostValue&& host);
 
+    // Construct from host data in external storage
+    inline CollectionMirror(const HostRef&              host,
+                            std::shared_ptr<const void> storage);
+
     //! Whether the data is assigned
-    explicit operator bool() const { return static_cast<bool>(host_); }
+    explicit operator bool() const { return static_cast<bool>(host_ref_); }
 
     //! Get host pointers after construction
     const HostRef& host() const
@@ -82,6 +89,7 @@ class CollectionMirror
     HostRef                               host_ref_;
     P<Ownership::value, MemSpace::device> device_;
     DeviceRef                             device_ref_;
+    std::shared_ptr<const void>           storage_;
 };
 
 //---------------------------------------------------------------------------//
@@ -28,5 +28,27 @@ CollectionMirror<P>::CollectionMirror(HostValue&& host)
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from host data in external storage.
+ *
+ * The host reference must point into the storage, which is kept alive for
+ * the lifetime of the mirror.
+ */
+template<template<Ownership, MemSpace> class P>
+CollectionMirror<P>::CollectionMirror(const HostRef&              host,
+                                      std::shared_ptr<const void> storage)
+    : host_ref_(host), storage_(std::move(storage))
+{
+    CELER_EXPECT(host_ref_);
+    CELER_EXPECT(storage_);
+    if (celeritas::device())
+    {
+        // Copy data to device and save reference
+        device_     = host_ref_;
+        device_ref_ = device_;
+    }
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
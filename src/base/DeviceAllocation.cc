@@ -13,6 +13,7 @@
 #endif
 
 #include "Assert.hh"
+#include "CachingAllocator.hh"
 #include "comm/Device.hh"
 
 namespace celeritas
@@ -20,13 +21,13 @@ namespace celeritas
 //---------------------------------------------------------------------------//
 /*!
  * Allocate a buffer with the given number of bytes.
+ *
+ * Memory is obtained from the global caching device allocator.
  */
 DeviceAllocation::DeviceAllocation(size_type bytes) : size_(bytes)
 {
     CELER_EXPECT(celeritas::device());
-    void* ptr = nullptr;
-    CELER_CUDA_CALL(cudaMalloc(&ptr, bytes));
-    data_.reset(static_cast<Byte*>(ptr));
+    data_.reset(static_cast<Byte*>(device_allocator().allocate(bytes)));
 }
 
 //---------------------------------------------------------------------------//
@@ -52,11 +53,10 @@ void DeviceAllocation::copy_to_host(SpanBytes bytes) const
 }
 
 //---------------------------------------------------------------------------//
-//! Deleter frees cuda data
-void DeviceAllocation::CudaFreeDeleter::operator()(
-    CELER_MAYBE_UNUSED Byte* ptr) const
+//! Deleter returns device data to the caching allocator
+void DeviceAllocation::CudaFreeDeleter::operator()(Byte* ptr) const
 {
-    CELER_CUDA_CALL(cudaFree(ptr));
+    device_allocator().deallocate(ptr);
 }
 
 //---------------------------------------------------------------------------//
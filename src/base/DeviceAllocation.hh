@@ -22,6 +22,10 @@ namespace celeritas
  * device memory. It allows Storage classes to allocate and manage device
  * memory without using `thrust`, which requires NVCC and propagates that
  * requirement into all upstream code.
+ *
+ * Memory is drawn from (and returned to) the global \c device_allocator, so
+ * repeatedly constructing temporary allocations of similar sizes does not
+ * incur a \c cudaMalloc / \c cudaFree pair each time.
  */
 class DeviceAllocation
 {
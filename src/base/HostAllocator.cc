@@ -0,0 +1,142 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file HostAllocator.cc
+//---------------------------------------------------------------------------//
+#include "HostAllocator.hh"
+
+#include "celeritas_config.h"
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
+#ifdef __linux__
+#    include <sys/mman.h>
+#endif
+
+#include <cstdlib>
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Whether an environment variable is set to a nonempty value
+bool is_env_set(const char* name)
+{
+    const char* value = std::getenv(name);
+    return value && value[0] != '\0';
+}
+
+#if CELERITAS_USE_OPENMP
+//---------------------------------------------------------------------------//
+/*!
+ * Write to each page of an allocation from the thread that will own it.
+ *
+ * The allocation is divided into contiguous per-thread chunks exactly as a
+ * \c schedule(static) loop over its elements would be.
+ */
+void first_touch(void* ptr, std::size_t bytes, std::size_t page_bytes)
+{
+    if (omp_in_parallel())
+    {
+        // The calling thread owns the data
+        return;
+    }
+
+    char* const     data      = static_cast<char*>(ptr);
+    const long long num_pages = (bytes + page_bytes - 1) / page_bytes;
+#    pragma omp parallel for schedule(static)
+    for (long long i = 0; i < num_pages; ++i)
+    {
+        data[i * page_bytes] = 0;
+    }
+}
+#endif
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Global placement options for host collection storage.
+ *
+ * Setting the \c CELER_DISABLE_HUGE_PAGES or \c CELER_DISABLE_FIRST_TOUCH
+ * environment variables to a nonempty value disables the corresponding
+ * default behavior.
+ */
+HostStorageOptions& host_storage_options()
+{
+    static HostStorageOptions result = [] {
+        HostStorageOptions opts;
+        if (is_env_set("CELER_DISABLE_HUGE_PAGES"))
+        {
+            opts.huge_page_bytes = 0;
+        }
+        if (is_env_set("CELER_DISABLE_FIRST_TOUCH"))
+        {
+            opts.first_touch_bytes = 0;
+        }
+        return opts;
+    }();
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate aligned host memory using the global placement options.
+ *
+ * A null pointer is returned for zero-byte requests.
+ */
+void* host_allocate(std::size_t bytes)
+{
+    if (bytes == 0)
+        return nullptr;
+
+    const HostStorageOptions& opts = host_storage_options();
+
+    const bool huge = opts.huge_page_bytes > 0
+                      && bytes >= opts.huge_page_bytes;
+    std::size_t alignment = host_alignment;
+    if (huge)
+    {
+        // Pad to whole huge pages so that the tail is eligible as well
+        alignment = opts.huge_page_bytes;
+        bytes     = (bytes + alignment - 1) / alignment * alignment;
+    }
+
+    void* ptr = nullptr;
+    if (posix_memalign(&ptr, alignment, bytes) != 0)
+    {
+        throw std::bad_alloc();
+    }
+
+#ifdef MADV_HUGEPAGE
+    if (huge)
+    {
+        // Advice is best-effort: failure (e.g. THP disabled) is harmless
+        madvise(ptr, bytes, MADV_HUGEPAGE);
+    }
+#endif
+
+#if CELERITAS_USE_OPENMP
+    if (opts.first_touch_bytes > 0 && bytes >= opts.first_touch_bytes)
+    {
+        first_touch(ptr, bytes, huge ? alignment : 4096);
+    }
+#endif
+    return ptr;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Free memory from host_allocate.
+ */
+void host_deallocate(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
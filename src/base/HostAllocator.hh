@@ -0,0 +1,111 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file HostAllocator.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <new>
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+//! Minimum alignment in bytes of all host collection allocations
+constexpr std::size_t host_alignment = 64;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Placement policy for large host allocations.
+ *
+ * Allocations of at least \c huge_page_bytes are aligned to (and padded to a
+ * multiple of) that size and advised to be backed by transparent huge pages
+ * where the OS supports it. Allocations of at least \c first_touch_bytes that
+ * are made outside of an OpenMP parallel region have their pages touched by
+ * the OpenMP threads using a static partition, so that on NUMA systems the
+ * i'th fraction of an array indexed by track slot resides on the node of the
+ * thread that processes those slots under \c schedule(static). A zero value
+ * disables the corresponding behavior.
+ *
+ * The options are global and should be changed only during setup, before
+ * data is allocated.
+ */
+struct HostStorageOptions
+{
+    //! Minimum allocation size for huge page alignment and advice
+    std::size_t huge_page_bytes = std::size_t(2) << 20;
+    //! Minimum allocation size for threaded first touch
+    std::size_t first_touch_bytes = std::size_t(4) << 20;
+};
+
+//---------------------------------------------------------------------------//
+// Global placement options for host collection storage
+HostStorageOptions& host_storage_options();
+
+// Allocate aligned host memory using the global placement options
+void* host_allocate(std::size_t bytes);
+
+// Free memory from host_allocate
+void host_deallocate(void* ptr) noexcept;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Standard-library allocator for aligned, NUMA-aware host storage.
+ *
+ * This is the allocator used by host-value \c Collection storage. All
+ * allocations are aligned to at least \c host_alignment bytes so that
+ * vectorized loops over collection data never straddle a cache line at the
+ * start of an array.
+ */
+template<class T>
+class HostAllocator
+{
+  public:
+    //!@{
+    //! Type aliases
+    using value_type = T;
+    //!@}
+
+  public:
+    HostAllocator() = default;
+
+    //! Construct from an allocator of another type
+    template<class U>
+    HostAllocator(const HostAllocator<U>&) noexcept
+    {
+    }
+
+    //! Allocate space for the given number of elements
+    T* allocate(std::size_t count)
+    {
+        if (count > std::numeric_limits<std::size_t>::max() / sizeof(T))
+        {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(host_allocate(count * sizeof(T)));
+    }
+
+    //! Free an allocation
+    void deallocate(T* ptr, std::size_t) noexcept { host_deallocate(ptr); }
+};
+
+//!@{
+//! All host allocators are interchangeable
+template<class T, class U>
+bool operator==(const HostAllocator<T>&, const HostAllocator<U>&)
+{
+    return true;
+}
+
+template<class T, class U>
+bool operator!=(const HostAllocator<T>&, const HostAllocator<U>&)
+{
+    return false;
+}
+//!@}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -85,6 +85,16 @@ namespace celeritas
  * These separate kernel launches are needed as grid-level synchronization
  * points.
  *
+ * Allocating from the single shared size is a contention point when many
+ * threads allocate simultaneously, and the resulting order of the data
+ * depends on timing. If the data has private allocation regions, a stack
+ * allocator constructed with a \c StackRegionId instead bump-allocates from
+ * that region. Assigning one region per thread (or per thread block) removes
+ * the contention, and assigning one per thread makes the final order
+ * reproducible. After the allocating kernel completes, host code calls \c
+ * compact_regions to append the region data to the shared stack, where it is
+ * accessible through \c get() as usual.
+ *
  * \todo Instead of returning a pointer, return IdRange<T>. Rename
  * StackAllocatorData to StackAllocation and have it look like a collection so
  * that *it* will provide access to the data. Better yet, have a
@@ -108,6 +118,10 @@ class StackAllocator
     // Construct with shared data
     explicit inline CELER_FUNCTION StackAllocator(const Pointers& data);
 
+    // Construct to allocate from a private region
+    inline CELER_FUNCTION
+    StackAllocator(const Pointers& data, StackRegionId region);
+
     // Total storage capacity (always safe)
     inline CELER_FUNCTION size_type capacity() const;
 
@@ -132,9 +146,13 @@ class StackAllocator
 
   private:
     const Pointers& data_;
+    StackRegionId   region_;
 
     //// HELPER FUNCTIONS ////
 
+    inline CELER_FUNCTION result_type allocate_shared(size_type count);
+    inline CELER_FUNCTION result_type allocate_region(size_type count);
+
     using SizeId    = ItemId<size_type>;
     using StorageId = ItemId<T>;
     static CELER_CONSTEXPR_FUNCTION SizeId size_id() { return SizeId{0}; }
@@ -21,6 +21,19 @@ CELER_FUNCTION StackAllocator<T>::StackAllocator(const Pointers& shared)
     CELER_EXPECT(shared);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct to allocate from the given private region.
+ */
+template<class T>
+CELER_FUNCTION
+StackAllocator<T>::StackAllocator(const Pointers& shared, StackRegionId region)
+    : data_(shared), region_(region)
+{
+    CELER_EXPECT(shared);
+    CELER_EXPECT(region < shared.num_regions());
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get the maximum number of values that can be allocated.
@@ -35,16 +48,21 @@ CELER_FUNCTION auto StackAllocator<T>::capacity() const -> size_type
 /*!
  * Clear the stack allocator.
  *
- * This sets the size to zero. It should ideally *only* be called by a single
- * thread (though multiple threads resetting it should also be OK), but
- * *cannot be used in the same kernel that is allocating or viewing it*. This
- * is because the access times between different threads or thread-blocks is
- * indeterminate inside of a single kernel.
+ * This sets the size of the stack and of any private regions to zero. It
+ * should ideally *only* be called by a single thread (though multiple threads
+ * resetting it should also be OK), but *cannot be used in the same kernel
+ * that is allocating or viewing it*. This is because the access times between
+ * different threads or thread-blocks is indeterminate inside of a single
+ * kernel.
  */
 template<class T>
 CELER_FUNCTION void StackAllocator<T>::clear()
 {
     data_.size[this->size_id()] = 0;
+    for (size_type r = 0; r < data_.num_regions(); ++r)
+    {
+        data_.region_size[SizeId{r}] = 0;
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -52,7 +70,8 @@ CELER_FUNCTION void StackAllocator<T>::clear()
  * Allocate space for a given number of items.
  *
  * Returns NULL if allocation failed due to out-of-memory. Ensures that the
- * shared size reflects the amount of data allocated.
+ * shared size (or the region size, if constructed with a region) reflects the
+ * amount of data allocated.
  */
 template<class T>
 CELER_FUNCTION auto StackAllocator<T>::operator()(size_type count)
@@ -60,6 +79,62 @@ CELER_FUNCTION auto StackAllocator<T>::operator()(size_type count)
 {
     CELER_EXPECT(count > 0);
 
+    if (region_)
+    {
+        return this->allocate_region(count);
+    }
+    return this->allocate_shared(count);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the number of items currently present.
+ *
+ * This value may not be meaningful (may be less than "actual" size) if
+ * called in the same kernel as other threads that are allocating.
+ */
+template<class T>
+CELER_FUNCTION auto StackAllocator<T>::size() const -> size_type
+{
+    size_type result = data_.size[this->size_id()];
+    CELER_ENSURE(result <= this->capacity());
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * View all allocated data.
+ *
+ * This cannot be called while any running kernel could be modifiying the size.
+ */
+template<class T>
+CELER_FUNCTION auto StackAllocator<T>::get() -> Span<value_type>
+{
+    return data_.storage[ItemRange<T>{StorageId{0}, StorageId{this->size()}}];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * View all allocated data (const).
+ *
+ * This cannot be called while any running kernel could be modifiying the size.
+ */
+template<class T>
+CELER_FUNCTION auto StackAllocator<T>::get() const -> Span<const value_type>
+{
+    return data_.storage[ItemRange<T>{StorageId{0}, StorageId{this->size()}}];
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate space from the shared stack.
+ */
+template<class T>
+CELER_FUNCTION auto StackAllocator<T>::allocate_shared(size_type count)
+    -> result_type
+{
     // Atomic add 'count' to the shared size
     size_type start = atomic_add(&data_.size[this->size_id()], count);
     if (CELER_UNLIKELY(start + count > data_.storage.size()))
@@ -100,41 +175,38 @@ CELER_FUNCTION auto StackAllocator<T>::operator()(size_type count)
 
 //---------------------------------------------------------------------------//
 /*!
- * Get the number of items currently present.
+ * Allocate space from this thread's private region.
  *
- * This value may not be meaningful (may be less than "actual" size) if
- * called in the same kernel as other threads that are allocating.
+ * The region size is incremented atomically so that a region may be shared
+ * by a block of threads, and overflow is handled as for the shared stack.
  */
 template<class T>
-CELER_FUNCTION auto StackAllocator<T>::size() const -> size_type
+CELER_FUNCTION auto StackAllocator<T>::allocate_region(size_type count)
+    -> result_type
 {
-    size_type result = data_.size[this->size_id()];
-    CELER_ENSURE(result <= this->capacity());
-    return result;
-}
+    const size_type region_capacity = data_.region_capacity();
+    size_type*      region_size
+        = &data_.region_size[ItemId<size_type>{region_.get()}];
 
-//---------------------------------------------------------------------------//
-/*!
- * View all allocated data.
- *
- * This cannot be called while any running kernel could be modifiying the size.
- */
-template<class T>
-CELER_FUNCTION auto StackAllocator<T>::get() -> Span<value_type>
-{
-    return data_.storage[ItemRange<T>{StorageId{0}, StorageId{this->size()}}];
-}
+    size_type start = atomic_add(region_size, count);
+    if (CELER_UNLIKELY(start + count > region_capacity))
+    {
+        if (start <= region_capacity)
+        {
+            // Restore the actual allocated size of this region
+            *region_size = start;
+        }
+        return nullptr;
+    }
 
-//---------------------------------------------------------------------------//
-/*!
- * View all allocated data (const).
- *
- * This cannot be called while any running kernel could be modifiying the size.
- */
-template<class T>
-CELER_FUNCTION auto StackAllocator<T>::get() const -> Span<const value_type>
-{
-    return data_.storage[ItemRange<T>{StorageId{0}, StorageId{this->size()}}];
+    // Initialize the data at the newly "allocated" address
+    StorageId   first{region_.get() * region_capacity + start};
+    value_type* result = new (&data_.region_storage[first]) value_type;
+    for (size_type i = 1; i < count; ++i)
+    {
+        new (&data_.region_storage[StorageId{first.get() + i}]) value_type;
+    }
+    return result;
 }
 
 //---------------------------------------------------------------------------//
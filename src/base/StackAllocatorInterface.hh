@@ -11,13 +11,23 @@
 #include "CollectionAlgorithms.hh"
 #include "CollectionBuilder.hh"
 #include "Macros.hh"
+#include "OpaqueId.hh"
 #include "Types.hh"
+#include "detail/StackRegionCompactor.hh"
 
 namespace celeritas
 {
+//---------------------------------------------------------------------------//
+//! Index of a private allocation region (e.g. per thread or per block)
+using StackRegionId = OpaqueId<struct StackRegion>;
+
 //---------------------------------------------------------------------------//
 /*!
  * Storage for a stack and its dynamic size.
+ *
+ * The stack can optionally have a number of equally sized private "regions"
+ * for contention-free allocation, with separate storage that is later
+ * compacted onto the end of the shared stack with \c compact_regions.
  */
 template<class T, Ownership W, MemSpace M>
 struct StackAllocatorData
@@ -25,6 +35,9 @@ struct StackAllocatorData
     celeritas::Collection<T, W, M>         storage; //!< Allocated capacity
     celeritas::Collection<size_type, W, M> size;    //!< Stored size
 
+    celeritas::Collection<T, W, M>         region_storage; //!< Region capacity
+    celeritas::Collection<size_type, W, M> region_size;    //!< Region sizes
+
     // Whether the interface is initialized
     explicit inline CELER_FUNCTION operator bool() const
     {
@@ -34,15 +47,38 @@ struct StackAllocatorData
     //! Total capacity of stack
     CELER_FUNCTION size_type capacity() const { return storage.size(); }
 
+    //! Number of private allocation regions (zero if unused)
+    CELER_FUNCTION size_type num_regions() const { return region_size.size(); }
+
+    //! Capacity of each private allocation region
+    CELER_FUNCTION size_type region_capacity() const
+    {
+        return this->num_regions() > 0
+                   ? region_storage.size() / this->num_regions()
+                   : 0;
+    }
+
     //! Assign from another stack
     template<Ownership W2, MemSpace M2>
     StackAllocatorData& operator=(StackAllocatorData<T, W2, M2>& other)
     {
         CELER_EXPECT(other);
-        storage = other.storage;
-        size    = other.size;
+        storage        = other.storage;
+        size           = other.size;
+        region_storage = other.region_storage;
+        region_size    = other.region_size;
         return *this;
     }
+
+    //! Visit each collection and nested group
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("storage", storage);
+        visit("size", size);
+        visit("region_storage", region_storage);
+        visit("region_size", region_size);
+    }
 };
 
 //---------------------------------------------------------------------------//
@@ -59,5 +95,56 @@ resize(StackAllocatorData<T, Ownership::value, M>* data, size_type capacity)
     celeritas::fill(size_type(0), &data->size);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Resize a stack allocator with private allocation regions in host code.
+ */
+template<class T, MemSpace M>
+inline void resize(StackAllocatorData<T, Ownership::value, M>* data,
+                   size_type                                   capacity,
+                   size_type                                   num_regions,
+                   size_type                                   region_capacity)
+{
+    CELER_EXPECT(num_regions > 0);
+    CELER_EXPECT(region_capacity > 0);
+    resize(data, capacity);
+    make_builder(&data->region_storage).resize(num_regions * region_capacity);
+    make_builder(&data->region_size).resize(num_regions);
+    celeritas::fill(size_type(0), &data->region_size);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move all region-allocated items onto the end of the shared stack.
+ *
+ * This must be called from host code after the kernels that allocate from the
+ * regions have completed. Items are appended to the stack in order of region
+ * (and in allocation order within a region), so the result is independent of
+ * thread timing if each region is used by a single thread. The regions are
+ * emptied afterward. The new size of the stack is returned.
+ *
+ * The prefix sum of the region sizes and the copy are done in a single pass:
+ * a host loop for host data, or one kernel launch for device data, which
+ * requires the compactor to be instantiated for \c T in a CUDA file (see
+ * \c detail/StackRegionCompactor.t.cuh).
+ *
+ * Pointers returned by region allocation continue to refer to the region
+ * storage, which is only overwritten by the next round of allocations.
+ */
+template<class T, MemSpace M>
+inline size_type
+compact_regions(const StackAllocatorData<T, Ownership::reference, M>& data)
+{
+    CELER_EXPECT(data);
+    CELER_EXPECT(data.num_regions() > 0);
+
+    detail::CompactedSize result = detail::RegionCompactor<T, M>{data}();
+    CELER_VALIDATE(result.end <= data.capacity(),
+                   << "insufficient capacity (" << data.capacity()
+                   << ") to compact " << result.end - result.start
+                   << " region items onto a stack of size " << result.start);
+    return result.end;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -14,8 +14,13 @@
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
-#if CELERITAS_USE_CUDA
-//! Standard type for container sizes, optimized for GPU use.
+#if CELERITAS_USE_CUDA || CELERITAS_SIZE32
+/*!
+ * Standard type for container sizes, optimized for GPU use.
+ *
+ * Host-only builds can opt in with \c CELERITAS_SIZE32 to halve the size of
+ * indices and ranges and to share the device layout of params data.
+ */
 using size_type = unsigned int;
 #else
 using size_type = std::size_t;
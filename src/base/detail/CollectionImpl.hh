@@ -10,6 +10,7 @@
 #include <vector>
 #include "base/Assert.hh"
 #include "base/DeviceVector.hh"
+#include "base/HostAllocator.hh"
 #include "base/Span.hh"
 #include "base/Types.hh"
 
@@ -125,11 +126,11 @@ struct CollectionStorageValidator<Ownership::value>
 };
 
 //---------------------------------------------------------------------------//
-//! Storage implementation for managed host data
+//! Storage implementation for managed host data (aligned, NUMA-aware)
 template<class T>
 struct CollectionStorage<T, Ownership::value, MemSpace::host>
 {
-    using type = std::vector<T>;
+    using type = std::vector<T, HostAllocator<T>>;
     type data;
 };
 
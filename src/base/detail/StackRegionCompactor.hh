@@ -0,0 +1,103 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file StackRegionCompactor.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Assert.hh"
+#include "base/Collection.hh"
+#include "base/Range.hh"
+#include "base/Types.hh"
+
+namespace celeritas
+{
+template<class T, Ownership W, MemSpace M>
+struct StackAllocatorData;
+
+namespace detail
+{
+//---------------------------------------------------------------------------//
+//! Stack size before compaction and the size needed to hold all regions
+struct CompactedSize
+{
+    size_type start;
+    size_type end;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Append region data to the shared stack in a single pass.
+ *
+ * The region sizes are summed to check the capacity, then an exclusive prefix
+ * sum of the region sizes gives the destination of each region's items, which
+ * are copied as the sum is computed. If the stack has insufficient capacity,
+ * the data is left unchanged. Otherwise the stack size is updated and the
+ * regions are emptied.
+ */
+template<class T, MemSpace M>
+struct RegionCompactor;
+
+//! Compact on host
+template<class T>
+struct RegionCompactor<T, MemSpace::host>
+{
+    const StackAllocatorData<T, Ownership::reference, MemSpace::host>& data;
+
+    CompactedSize operator()() const
+    {
+        using SizeId  = ItemId<size_type>;
+        using ItemIdT = ItemId<T>;
+
+        const size_type region_capacity = data.region_capacity();
+        size_type&      size            = data.size[SizeId{0}];
+
+        CompactedSize result{size, size};
+        for (auto r : range(data.num_regions()))
+        {
+            result.end += data.region_size[SizeId{r}];
+        }
+        if (result.end > data.capacity())
+        {
+            return result;
+        }
+
+        size_type dst = result.start;
+        for (auto r : range(data.num_regions()))
+        {
+            size_type& region_size = data.region_size[SizeId{r}];
+            CELER_ASSERT(region_size <= region_capacity);
+            for (auto i : range(region_size))
+            {
+                data.storage[ItemIdT{dst++}]
+                    = data.region_storage[ItemIdT{r * region_capacity + i}];
+            }
+            region_size = 0;
+        }
+        size = result.end;
+        return result;
+    }
+};
+
+//! Compact on device with a single kernel launch
+template<class T>
+struct RegionCompactor<T, MemSpace::device>
+{
+    const StackAllocatorData<T, Ownership::reference, MemSpace::device>& data;
+
+    CompactedSize operator()() const;
+};
+
+#if !CELERITAS_USE_CUDA
+template<class T>
+CompactedSize RegionCompactor<T, MemSpace::device>::operator()() const
+{
+    CELER_NOT_CONFIGURED("CUDA");
+}
+#endif
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
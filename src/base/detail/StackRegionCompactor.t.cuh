@@ -0,0 +1,127 @@
+//---------------------------------*-CUDA-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file StackRegionCompactor.t.cuh
+//---------------------------------------------------------------------------//
+#include "StackRegionCompactor.hh"
+
+#include <cub/block/block_reduce.cuh>
+#include <cub/block/block_scan.cuh>
+#include "base/DeviceVector.hh"
+#include "base/StackAllocatorInterface.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Number of threads in the single compaction block
+constexpr unsigned int compact_block_size = 256;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Scan the region sizes and gather the region items with a single block.
+ *
+ * Each thread handles one region per pass over the regions. The first pass
+ * sums the region sizes to check the capacity; the second computes the
+ * destination of each region with a block-wide exclusive scan, carrying the
+ * running total between chunks of regions, and copies the region's items.
+ */
+template<class T>
+__global__ void compact_regions_kernel(
+    const StackAllocatorData<T, Ownership::reference, MemSpace::device> data,
+    CompactedSize* result)
+{
+    using SizeId      = ItemId<size_type>;
+    using ItemIdT     = ItemId<T>;
+    using BlockScan   = cub::BlockScan<size_type, compact_block_size>;
+    using BlockReduce = cub::BlockReduce<size_type, compact_block_size>;
+
+    __shared__ union
+    {
+        typename BlockScan::TempStorage   scan;
+        typename BlockReduce::TempStorage reduce;
+    } temp_storage;
+    __shared__ size_type total;
+
+    const size_type num_regions     = data.num_regions();
+    const size_type region_capacity = data.region_capacity();
+    const size_type start           = data.size[SizeId{0}];
+
+    // Sum the region sizes
+    size_type local = 0;
+    for (size_type r = threadIdx.x; r < num_regions; r += compact_block_size)
+    {
+        local += data.region_size[SizeId{r}];
+    }
+    local = BlockReduce(temp_storage.reduce).Sum(local);
+    if (threadIdx.x == 0)
+    {
+        total   = local;
+        *result = {start, start + local};
+    }
+    __syncthreads();
+    if (start + total > data.capacity())
+    {
+        // Insufficient capacity: leave the stack and regions unchanged
+        return;
+    }
+
+    // Place and copy each region's items
+    size_type offset = start;
+    for (size_type chunk = 0; chunk < num_regions; chunk += compact_block_size)
+    {
+        const size_type r     = chunk + threadIdx.x;
+        size_type       count = 0;
+        if (r < num_regions)
+        {
+            count = data.region_size[SizeId{r}];
+        }
+
+        size_type dst;
+        size_type chunk_total;
+        __syncthreads();
+        BlockScan(temp_storage.scan).ExclusiveSum(count, dst, chunk_total);
+        dst += offset;
+        for (size_type i = 0; i < count; ++i)
+        {
+            data.storage[ItemIdT{dst + i}]
+                = data.region_storage[ItemIdT{r * region_capacity + i}];
+        }
+        if (r < num_regions)
+        {
+            data.region_size[SizeId{r}] = 0;
+        }
+        offset += chunk_total;
+    }
+
+    if (threadIdx.x == 0)
+    {
+        data.size[SizeId{0}] = start + total;
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+template<class T>
+CompactedSize RegionCompactor<T, MemSpace::device>::operator()() const
+{
+    DeviceVector<CompactedSize> result(1);
+    compact_regions_kernel<T><<<1, compact_block_size>>>(
+        data, result.device_pointers().data());
+    CELER_CUDA_CHECK_ERROR();
+
+    CompactedSize host_result;
+    result.copy_to_host(Span<CompactedSize>(&host_result, 1));
+    return host_result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,383 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AsyncLogHandler.cc
+//---------------------------------------------------------------------------//
+#include "AsyncLogHandler.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include "base/Assert.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Unique identifier for each handler instance
+unsigned int next_handler_uid()
+{
+    static std::atomic<unsigned int> uid{0};
+    return ++uid;
+}
+
+//---------------------------------------------------------------------------//
+//! Most recently used buffer of the calling thread
+struct ThreadBufferCache
+{
+    unsigned int uid    = 0;
+    void*        buffer = nullptr;
+};
+
+thread_local ThreadBufferCache tl_buffer_cache;
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Buffers and flusher thread shared by copies of a handler.
+ */
+struct AsyncLogHandler::State
+{
+    //// TYPES ////
+
+    struct Message
+    {
+        ull_int     seq;
+        Provenance  prov;
+        LogLevel    lev;
+        std::string msg;
+    };
+
+    struct ThreadBuffer
+    {
+        std::thread::id      owner;
+        std::mutex           mutex;
+        std::vector<Message> messages;
+    };
+
+    using Key   = std::tuple<std::string, int, LogLevel>;
+    using Clock = std::chrono::steady_clock;
+
+    //// DATA ////
+
+    LogHandler           handle;
+    Options              opts;
+    unsigned int         uid;
+    std::atomic<ull_int> next_seq{0};
+
+    // Per-thread buffers
+    std::mutex                                 buffers_mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+
+    // Flush requests
+    std::mutex              flush_mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    ull_int                 requested = 0;
+    ull_int                 completed = 0;
+    bool                    stop      = false;
+
+    // Owned by the flusher thread
+    std::map<Key, size_type> counts;
+    Clock::time_point        counts_start;
+    std::vector<Message>     pending;
+    std::atomic<size_type>   num_suppressed{0};
+
+    std::thread flusher;
+
+    //// FUNCTIONS ////
+
+    State(LogHandler handle, Options opts);
+    ~State();
+
+    ThreadBuffer& thread_buffer();
+    void          flush();
+    void          run();
+    void          write_pending();
+    void          reset_counts();
+    void write(const Provenance& prov, LogLevel lev, const std::string& msg);
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Start the flusher thread.
+ */
+AsyncLogHandler::State::State(LogHandler handle_, Options opts_)
+    : handle(std::move(handle_))
+    , opts(opts_)
+    , uid(next_handler_uid())
+    , counts_start(Clock::now())
+{
+    flusher = std::thread([this] { this->run(); });
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write remaining messages and report suppressed ones.
+ */
+AsyncLogHandler::State::~State()
+{
+    {
+        std::lock_guard<std::mutex> scoped_lock(flush_mutex);
+        stop = true;
+    }
+    wake.notify_one();
+    flusher.join();
+    this->reset_counts();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the buffer for the calling thread, creating it if needed.
+ */
+auto AsyncLogHandler::State::thread_buffer() -> ThreadBuffer&
+{
+    ThreadBufferCache& cache = tl_buffer_cache;
+    if (cache.uid == uid)
+    {
+        return *static_cast<ThreadBuffer*>(cache.buffer);
+    }
+
+    std::lock_guard<std::mutex> scoped_lock(buffers_mutex);
+    const auto                  this_thread = std::this_thread::get_id();
+    ThreadBuffer*               result      = nullptr;
+    for (const auto& buf : buffers)
+    {
+        if (buf->owner == this_thread)
+        {
+            result = buf.get();
+            break;
+        }
+    }
+    if (!result)
+    {
+        buffers.push_back(std::make_unique<ThreadBuffer>());
+        result        = buffers.back().get();
+        result->owner = this_thread;
+    }
+    cache = {uid, result};
+    return *result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wake the flusher thread and wait for it to write all buffered messages.
+ */
+void AsyncLogHandler::State::flush()
+{
+    if (std::this_thread::get_id() == flusher.get_id())
+    {
+        // Called by the wrapped handler: waiting would deadlock
+        return;
+    }
+
+    const std::chrono::duration<real_type> interval(opts.flush_interval);
+
+    std::unique_lock<std::mutex> lock(flush_mutex);
+    const ull_int                target = ++requested;
+    wake.notify_one();
+    while (completed < target)
+    {
+        done.wait_for(lock, interval);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write messages at each flush interval or request until stopped.
+ */
+void AsyncLogHandler::State::run()
+{
+    const std::chrono::duration<real_type> interval(opts.flush_interval);
+
+    std::unique_lock<std::mutex> lock(flush_mutex);
+    while (true)
+    {
+        wake.wait_for(
+            lock, interval, [this] { return stop || requested != completed; });
+        const bool    stopping = stop;
+        const ull_int target   = requested;
+
+        lock.unlock();
+        this->write_pending();
+        lock.lock();
+
+        completed = target;
+        done.notify_all();
+        if (stopping)
+            break;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Collect the messages of all threads and write them in order.
+ */
+void AsyncLogHandler::State::write_pending()
+{
+    {
+        std::lock_guard<std::mutex> scoped_lock(buffers_mutex);
+        for (const auto& buf : buffers)
+        {
+            std::lock_guard<std::mutex> buf_lock(buf->mutex);
+            pending.insert(pending.end(),
+                           std::make_move_iterator(buf->messages.begin()),
+                           std::make_move_iterator(buf->messages.end()));
+            buf->messages.clear();
+        }
+    }
+    std::sort(pending.begin(),
+              pending.end(),
+              [](const Message& a, const Message& b) { return a.seq < b.seq; });
+
+    const std::chrono::duration<real_type> repeat_interval(
+        opts.repeat_interval);
+    if (Clock::now() - counts_start >= repeat_interval)
+    {
+        this->reset_counts();
+    }
+
+    for (const Message& m : pending)
+    {
+        if (opts.max_repeats > 0 && m.lev < LogLevel::error)
+        {
+            size_type& count = counts[Key{m.prov.file, m.prov.line, m.lev}];
+            if (count++ >= opts.max_repeats)
+            {
+                if (count == opts.max_repeats + 1)
+                {
+                    this->write(m.prov,
+                                m.lev,
+                                "Suppressing further repeated messages");
+                }
+                ++num_suppressed;
+                continue;
+            }
+        }
+        this->write(m.prov, m.lev, m.msg);
+    }
+    pending.clear();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Report the messages suppressed since the last reset and clear the counts.
+ */
+void AsyncLogHandler::State::reset_counts()
+{
+    for (const auto& key_count : counts)
+    {
+        if (key_count.second <= opts.max_repeats)
+            continue;
+
+        const Key&         key = key_count.first;
+        std::ostringstream os;
+        os << "Suppressed " << key_count.second - opts.max_repeats
+           << " repeated messages";
+        this->write(
+            {std::get<0>(key), std::get<1>(key)}, std::get<2>(key), os.str());
+    }
+    counts.clear();
+    counts_start = Clock::now();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Pass a single message to the wrapped handler.
+ */
+void AsyncLogHandler::State::write(const Provenance&  prov,
+                                   LogLevel           lev,
+                                   const std::string& msg)
+{
+    try
+    {
+        handle(prov, lev, msg);
+    }
+    catch (const std::exception& e)
+    {
+        std::cerr << "An error occurred writing a log message: " << e.what()
+                  << std::endl;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with the handler that writes messages.
+ */
+AsyncLogHandler::AsyncLogHandler(LogHandler handle)
+    : AsyncLogHandler(std::move(handle), Options{})
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with handler and options.
+ */
+AsyncLogHandler::AsyncLogHandler(LogHandler handle, Options opts)
+{
+    CELER_EXPECT(handle);
+    CELER_EXPECT(opts.flush_interval > 0);
+    CELER_EXPECT(opts.repeat_interval > 0);
+    state_ = std::make_shared<State>(std::move(handle), opts);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Buffer a message for the calling thread.
+ */
+void AsyncLogHandler::operator()(Provenance  prov,
+                                 LogLevel    lev,
+                                 std::string msg) const
+{
+    CELER_EXPECT(state_);
+
+    State::ThreadBuffer& buf = state_->thread_buffer();
+    {
+        std::lock_guard<std::mutex> scoped_lock(buf.mutex);
+        buf.messages.push_back(
+            {state_->next_seq++, std::move(prov), lev, std::move(msg)});
+    }
+    if (lev >= LogLevel::error)
+    {
+        state_->flush();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write all messages logged so far.
+ */
+void AsyncLogHandler::flush() const
+{
+    CELER_EXPECT(state_);
+    state_->flush();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of messages dropped by the rate limit.
+ *
+ * This only includes messages that have been flushed.
+ */
+size_type AsyncLogHandler::num_suppressed() const
+{
+    CELER_EXPECT(state_);
+    return state_->num_suppressed;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,81 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AsyncLogHandler.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <memory>
+#include <string>
+#include "base/Types.hh"
+#include "LoggerTypes.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Log handler that writes messages on a background thread.
+ *
+ * Each thread that logs a message appends it to its own buffer, which costs
+ * an uncontended lock and a move of the formatted string. A flusher thread
+ * periodically collects the buffered messages of all threads and passes them
+ * to the wrapped handler one at a time, so messages from different threads
+ * never interleave and the wrapped handler needs no synchronization.
+ * Messages are written in approximately the order they were logged.
+ *
+ * Repeated messages from the same source line (e.g. per-track warnings) are
+ * rate-limited: after \c max_repeats messages from one file, line, and
+ * level within a \c repeat_interval, further ones are dropped and counted.
+ * The number dropped is reported and the counts are reset at the end of each
+ * interval (and when the handler is destroyed). Messages at \c error level
+ * or higher are never dropped.
+ *
+ * Messages at \c error level or higher are flushed before the logging call
+ * returns, so they are not lost if the program then aborts.
+ *
+ * Copies of the handler share the same buffers and flusher thread, which
+ * stops (after writing all pending messages) when the last copy is
+ * destroyed. It can therefore be used directly as a \c LogHandler:
+ * \code
+   world_logger() = Logger(comm, AsyncLogHandler(my_handler));
+ * \endcode
+ */
+class AsyncLogHandler
+{
+  public:
+    //! Construction options
+    struct Options
+    {
+        //! Maximum messages written per source line and level (0 for no limit)
+        size_type max_repeats = 16;
+        //! Time after which the repeated message counts are reset [s]
+        real_type repeat_interval = 10;
+        //! Maximum time between flushes [s]
+        real_type flush_interval = 0.1;
+    };
+
+  public:
+    // Construct with the handler that writes messages
+    explicit AsyncLogHandler(LogHandler handle);
+
+    // Construct with handler and options
+    AsyncLogHandler(LogHandler handle, Options opts);
+
+    // Buffer a message for the calling thread
+    void operator()(Provenance prov, LogLevel lev, std::string msg) const;
+
+    // Write all messages logged so far
+    void flush() const;
+
+    // Number of messages dropped by the rate limit
+    size_type num_suppressed() const;
+
+  private:
+    struct State;
+    std::shared_ptr<State> state_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,100 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AtomicCounter.cc
+//---------------------------------------------------------------------------//
+#include "AtomicCounter.hh"
+
+#include "celeritas_config.h"
+#if CELERITAS_USE_MPI
+#    include <mpi.h>
+#endif
+
+#include "base/Assert.hh"
+#include "detail/MpiTypes.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a zero count.
+ *
+ * The first process owns the counter. A passive-target access epoch is opened
+ * for the lifetime of the counter so that each increment only needs a flush.
+ */
+AtomicCounter::AtomicCounter(const Communicator& comm) : comm_(comm)
+{
+    if (!comm_)
+        return;
+
+#if CELERITAS_USE_MPI
+    const bool  owner = (comm_.rank() == 0);
+    value_type* base  = nullptr;
+    CELER_MPI_CALL(MPI_Win_allocate(owner ? sizeof(value_type) : 0,
+                                    sizeof(value_type),
+                                    MPI_INFO_NULL,
+                                    comm_.mpi_comm(),
+                                    &base,
+                                    &win_));
+    if (owner)
+    {
+        *base = 0;
+    }
+    CELER_MPI_CALL(MPI_Win_lock_all(MPI_MODE_NOCHECK, win_));
+    CELER_MPI_CALL(MPI_Win_sync(win_));
+    CELER_MPI_CALL(MPI_Barrier(comm_.mpi_comm()));
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Free the window.
+ *
+ * Errors are ignored since this is called during cleanup.
+ */
+AtomicCounter::~AtomicCounter()
+{
+#if CELERITAS_USE_MPI
+    if (win_ != detail::MpiWinNull())
+    {
+        MPI_Win_unlock_all(win_);
+        MPI_Win_free(&win_);
+    }
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add to the count and return the previous value.
+ *
+ * This is atomic with respect to calls from all processes.
+ */
+auto AtomicCounter::fetch_add(value_type increment) -> value_type
+{
+    if (!comm_)
+    {
+        value_type result = local_;
+        local_ += increment;
+        return result;
+    }
+
+    value_type result = 0;
+#if CELERITAS_USE_MPI
+    CELER_MPI_CALL(MPI_Fetch_and_op(&increment,
+                                    &result,
+                                    detail::MpiType<value_type>::get(),
+                                    0,
+                                    0,
+                                    MPI_SUM,
+                                    win_));
+    CELER_MPI_CALL(MPI_Win_flush(0, win_));
+#else
+    CELER_NOT_CONFIGURED("MPI");
+#endif
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,67 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AtomicCounter.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Types.hh"
+#include "Communicator.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Integer counter shared by all processes in a communicator.
+ *
+ * The counter is stored in an MPI window on the first process and is
+ * incremented with one-sided atomic operations, so no process has to service
+ * the requests of the others. With a null communicator the counter is local.
+ *
+ * Construction and destruction are collective over the communicator.
+ *
+ * \code
+    AtomicCounter next_event(comm);
+    for (auto event = next_event.fetch_add(1); event < num_events;
+         event = next_event.fetch_add(1))
+    {
+        transport(event);
+    }
+   \endcode
+ */
+class AtomicCounter
+{
+  public:
+    //!@{
+    //! Type aliases
+    using value_type = ull_int;
+    //!@}
+
+  public:
+    // Construct with a zero count (collective)
+    explicit AtomicCounter(const Communicator& comm);
+
+    // Free the window (collective)
+    ~AtomicCounter();
+
+    //!@{
+    //! Prevent copying and moving
+    AtomicCounter(const AtomicCounter&) = delete;
+    AtomicCounter& operator=(const AtomicCounter&) = delete;
+    //!@}
+
+    // Add to the count and return the previous value
+    value_type fetch_add(value_type increment);
+
+  private:
+    using MpiWin = detail::MpiWin;
+
+    Communicator comm_;
+    MpiWin       win_   = detail::MpiWinNull();
+    value_type   local_ = 0; //!< Count with a null communicator
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
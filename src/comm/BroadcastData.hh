@@ -0,0 +1,106 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BroadcastData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+#include "base/Collection.hh"
+#include "base/HostAllocator.hh"
+#include "Communicator.hh"
+#include "Operations.hh"
+#include "detail/SharedCollectionImpl.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Copy of a host collection group built by the first process.
+ *
+ * The first process of the communicator copies the collections of its group
+ * into a single block of memory, which is broadcast to every other process.
+ * Every process gets the group's scalar data and a \c const_reference group
+ * that points into its own copy of the block, so the original data can be
+ * discarded. The data passed by processes other than the first is ignored and
+ * may be empty.
+ *
+ * The group must list all of its collections in both overloads of
+ * \c visit_members, and its \c const_reference instantiation must be
+ * trivially copyable.
+ *
+ * Construction is collective over the communicator.
+ */
+template<template<Ownership, MemSpace> class P>
+class BroadcastData
+{
+  public:
+    //!@{
+    //! Type aliases
+    using HostRef = P<Ownership::const_reference, MemSpace::host>;
+    //!@}
+
+  public:
+    // Copy the first process's data to every process (collective)
+    BroadcastData(const Communicator& comm, const HostRef& data);
+
+    //! Access the copied data
+    const HostRef& host_ref() const { return host_ref_; }
+
+    //! Memory in bytes
+    std::size_t size() const { return memory_.size(); }
+
+  private:
+    std::vector<char, HostAllocator<char>> memory_;
+    HostRef                                host_ref_;
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the first process's data to every process.
+ */
+template<template<Ownership, MemSpace> class P>
+BroadcastData<P>::BroadcastData(const Communicator& comm, const HostRef& data)
+{
+    static_assert(std::is_trivially_copyable<HostRef>::value,
+                  "Broadcast collection groups must be trivially copyable");
+
+    const bool is_root = (comm.rank() == 0);
+    if (is_root)
+    {
+        CELER_EXPECT(data);
+        detail::SharedLayoutCalculator calc;
+        data.visit_members(calc);
+        memory_.resize(calc.bytes);
+
+        host_ref_ = data;
+        detail::SharedCollectionCopier copy{memory_.data(), memory_.size()};
+        host_ref_.visit_members(copy);
+        CELER_ASSERT(copy.offset == memory_.size());
+    }
+
+    // Send scalars and collection sizes, with addresses in the first
+    // process's memory, followed by the collections in a single block
+    host_ref_ = broadcast(comm, host_ref_);
+    const auto root_base
+        = broadcast(comm, reinterpret_cast<std::uintptr_t>(memory_.data()));
+    memory_.resize(broadcast(comm, memory_.size()));
+    broadcast(comm, make_span(memory_));
+
+    if (!is_root)
+    {
+        detail::SharedCollectionRebaser rebase{
+            root_base, memory_.data(), memory_.size()};
+        host_ref_.visit_members(rebase);
+    }
+    CELER_ENSURE(host_ref_);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
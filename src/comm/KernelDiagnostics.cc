@@ -7,6 +7,11 @@
 //---------------------------------------------------------------------------//
 #include "KernelDiagnostics.hh"
 
+#include "celeritas_config.h"
+#if CELERITAS_USE_OPENMP
+#    include <omp.h>
+#endif
+
 #include <iostream>
 #include "base/Macros.hh"
 #include "base/Range.hh"
@@ -15,6 +20,85 @@
 
 namespace celeritas
 {
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Number of host threads that a parallel loop would use
+unsigned int num_host_threads()
+{
+#if CELERITAS_USE_OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Register a host stage by name.
+ *
+ * Calling this again with the same name returns the existing key.
+ */
+auto KernelDiagnostics::insert_host(const char* name) -> key_type
+{
+    CELER_EXPECT(name);
+    auto iter_inserted = host_keys_.insert({name, key_type{this->size()}});
+    if (iter_inserted.second)
+    {
+        // First time this stage was added
+        value_type diag;
+        diag.name = name;
+        diag.host = true;
+        values_.push_back(std::move(diag));
+    }
+
+    CELER_ENSURE(keys_.size() + host_keys_.size() == values_.size());
+    CELER_ENSURE(iter_inserted.first->second < this->size());
+    return iter_inserted.first->second;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record a completed host stage.
+ */
+void KernelDiagnostics::launch_host(key_type     key,
+                                    unsigned int num_tracks,
+                                    unsigned int num_host_threads,
+                                    double       time)
+{
+    CELER_EXPECT(key < this->size());
+    CELER_EXPECT(time >= 0);
+    value_type& diag = values_[key.get()];
+    CELER_ASSERT(diag.host);
+    ++diag.num_launches;
+    diag.max_num_threads = std::max(num_tracks, diag.max_num_threads);
+    diag.num_tracks += num_tracks;
+    diag.time += time;
+    diag.num_host_threads
+        = std::max(num_host_threads, diag.num_host_threads);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Start timing a stage that processes this many tracks.
+ */
+ScopedHostStage::ScopedHostStage(key_type key, unsigned int num_tracks)
+    : key_(key), num_tracks_(num_tracks)
+{
+    CELER_EXPECT(key_ < kernel_diagnostics().size());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record the elapsed time.
+ */
+ScopedHostStage::~ScopedHostStage()
+{
+    kernel_diagnostics().launch_host(
+        key_, num_tracks_, num_host_threads(), elapsed_());
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * In debug mode, log a message about an impending launch.
@@ -56,14 +140,18 @@ std::ostream& operator<<(std::ostream& os, const KernelDiagnostics& kd)
         const auto& diag = kd.at(KernelDiagnostics::key_type{kernel_idx});
         // clang-format off
         os << "{\n"
-            "  name: \""          << diag.name            << "\",\n"
-            "  block_size: "      << diag.block_size      << ",\n"
-            "  num_regs: "        << diag.num_regs        << ",\n"
-            "  const_mem: "       << diag.const_mem       << ",\n"
-            "  local_mem: "       << diag.local_mem       << ",\n"
-            "  occupancy: "       << diag.occupancy       << ",\n"
-            "  num_launches: "    << diag.num_launches    << ",\n"
-            "  max_num_threads: " << diag.max_num_threads << "\n"
+            "  name: \""           << diag.name             << "\",\n"
+            "  host: "             << diag.host             << ",\n"
+            "  block_size: "       << diag.block_size       << ",\n"
+            "  num_regs: "         << diag.num_regs         << ",\n"
+            "  const_mem: "        << diag.const_mem        << ",\n"
+            "  local_mem: "        << diag.local_mem        << ",\n"
+            "  occupancy: "        << diag.occupancy        << ",\n"
+            "  num_launches: "     << diag.num_launches     << ",\n"
+            "  max_num_threads: "  << diag.max_num_threads  << ",\n"
+            "  num_tracks: "       << diag.num_tracks       << ",\n"
+            "  time: "             << diag.time             << ",\n"
+            "  num_host_threads: " << diag.num_host_threads << "\n"
             "}";
         // clang-format on
     }
@@ -10,20 +10,30 @@
 #include <celeritas_config.h>
 #include <algorithm>
 #include <iosfwd>
+#include <string>
 #include <unordered_map>
 #include <vector>
 #include "base/Assert.hh"
 #include "base/OpaqueId.hh"
+#include "base/Stopwatch.hh"
 
 namespace celeritas
 {
 //---------------------------------------------------------------------------//
-//! Properties for a single kernel.
+/*!
+ * Properties for a single kernel.
+ *
+ * Host stages (loops over track slots on the CPU) are recorded with the same
+ * properties as device kernels so that output from CPU and GPU runs can be
+ * compared directly. The CUDA attributes are zero for host stages, and the
+ * timing and host thread count are zero for device kernels.
+ */
 struct KernelProperties
 {
     std::string  name;
     unsigned int block_size = 0;
     unsigned int device_id  = 0;
+    bool         host       = false; //!< Whether this is a host stage
 
     int         num_regs  = 0; //!< Number of registers per thread
     std::size_t const_mem = 0; //!< Amount of constant memory (per thread) [b]
@@ -32,6 +42,10 @@ struct KernelProperties
 
     unsigned int num_launches    = 0; //!< Number of times launched
     unsigned int max_num_threads = 0; //!< Highest number of threads used
+    ull_int      num_tracks      = 0; //!< Total threads (tracks) launched
+
+    double       time             = 0; //!< Accumulated wall time [s]
+    unsigned int num_host_threads = 0; //!< Most host threads active
 };
 
 //---------------------------------------------------------------------------//
@@ -61,6 +75,9 @@ class KernelDiagnostics
     inline key_type
     insert(F func_ptr, const char* name, unsigned int block_size);
 
+    // Register a host stage by name
+    key_type insert_host(const char* name);
+
     //! Number of kernel diagnostics available
     size_type size() const { return values_.size(); }
 
@@ -72,10 +89,19 @@ class KernelDiagnostics
     // Mark that a kernel was launched with this many threads
     inline void launch(key_type key, unsigned int num_threads);
 
+    // Record a completed host stage
+    void launch_host(key_type     key,
+                     unsigned int num_tracks,
+                     unsigned int num_host_threads,
+                     double       time);
+
   private:
     // Map of kernel function address to kernel IDs
     std::unordered_map<std::uintptr_t, key_type> keys_;
 
+    // Map of host stage names to kernel IDs
+    std::unordered_map<std::string, key_type> host_keys_;
+
     // Kernel diagnostics
     std::vector<value_type> values_;
 
@@ -83,6 +109,49 @@ class KernelDiagnostics
     void log_launch(value_type& diag, unsigned int num_threads);
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Record the wall time of a host stage over track slots.
+ *
+ * The stage is registered with the global kernel diagnostics at construction
+ * and its timing is recorded when the scope ends. The key should be obtained
+ * once with \c insert_host and saved, like a \c KernelParamCalculator.
+ * Host stages must be recorded from outside any OpenMP parallel region.
+ *
+ * \code
+    static const auto stage_id = kernel_diagnostics().insert_host("pre_step");
+    ScopedHostStage record_stage(stage_id, states.size());
+    #pragma omp parallel for
+    for (size_type i = 0; i < states.size(); ++i) { ... }
+   \endcode
+ */
+class ScopedHostStage
+{
+  public:
+    //!@{
+    //! Type aliases
+    using key_type = KernelDiagnostics::key_type;
+    //!@}
+
+  public:
+    // Start timing a stage that processes this many tracks
+    ScopedHostStage(key_type key, unsigned int num_tracks);
+
+    // Record the elapsed time
+    ~ScopedHostStage();
+
+    //!@{
+    //! Prevent copying and moving
+    ScopedHostStage(const ScopedHostStage&) = delete;
+    ScopedHostStage& operator=(const ScopedHostStage&) = delete;
+    //!@}
+
+  private:
+    key_type     key_;
+    unsigned int num_tracks_;
+    Stopwatch    elapsed_;
+};
+
 //---------------------------------------------------------------------------//
 // FREE FUNCTIONS
 //---------------------------------------------------------------------------//
@@ -114,6 +183,7 @@ void KernelDiagnostics::launch(key_type key, unsigned int num_threads)
     value_type& diag = values_[key.get()];
     ++diag.num_launches;
     diag.max_num_threads = std::max(num_threads, diag.max_num_threads);
+    diag.num_tracks += num_threads;
 #if CELERITAS_DEBUG
     this->log_launch(diag, num_threads);
 #endif
@@ -159,7 +229,7 @@ KernelDiagnostics::insert(F func, const char* name, unsigned int block_size)
         values_.push_back(std::move(diag));
     }
 
-    CELER_ENSURE(keys_.size() == values_.size());
+    CELER_ENSURE(keys_.size() + host_keys_.size() == values_.size());
     CELER_ENSURE(iter_inserted.first->second < this->size());
     return iter_inserted.first->second;
 }
@@ -21,8 +21,12 @@ void to_json(nlohmann::json& j, const KernelDiagnostics& kd)
     for (auto kernel_idx : range(kd.size()))
     {
         const auto& diag = kd.at(KernelDiagnostics::key_type{kernel_idx});
+        // Throughput is only available for timed (host) stages
+        const double throughput = diag.time > 0 ? diag.num_tracks / diag.time
+                                                : 0;
         j.emplace_back(nlohmann::json::object({
             {"name", diag.name},
+            {"memspace", diag.host ? "host" : "device"},
             {"block_size", diag.block_size},
             {"num_regs", diag.num_regs},
             {"const_mem", diag.const_mem},
@@ -30,6 +34,10 @@ void to_json(nlohmann::json& j, const KernelDiagnostics& kd)
             {"occupancy", diag.occupancy},
             {"num_launches", diag.num_launches},
             {"max_num_threads", diag.max_num_threads},
+            {"num_tracks", diag.num_tracks},
+            {"time", diag.time},
+            {"num_host_threads", diag.num_host_threads},
+            {"throughput", throughput},
         }));
     }
 }
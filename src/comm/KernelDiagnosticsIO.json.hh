@@ -14,7 +14,7 @@ namespace celeritas
 {
 //---------------------------------------------------------------------------//
 
-// Write device diagnostics to JSON
+// Write device and host kernel diagnostics to JSON
 void to_json(nlohmann::json& j, const KernelDiagnostics& diagnostics);
 
 //---------------------------------------------------------------------------//
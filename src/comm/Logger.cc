@@ -15,6 +15,7 @@
 #include "base/Assert.hh"
 #include "base/ColorUtils.hh"
 #include "base/Range.hh"
+#include "AsyncLogHandler.hh"
 #include "Communicator.hh"
 #include "ScopedMpiInit.hh"
 
@@ -75,6 +76,18 @@ class LocalHandler
     int rank_;
 };
 
+//---------------------------------------------------------------------------//
+//! Write from a background thread if the CELER_LOG_ASYNC variable is set
+LogHandler make_handler(LogHandler handle)
+{
+    const char* async = std::getenv("CELER_LOG_ASYNC");
+    if (async && async[0] != '\0')
+    {
+        return AsyncLogHandler(std::move(handle));
+    }
+    return handle;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace
 
@@ -125,7 +138,8 @@ Logger::Logger(const Communicator& comm,
  * Parallel-enabled logger: print only on "main" process.
  *
  * Setting the "CELER_LOG" environment variable to "debug", "info", "error",
- * etc. will change the default log level.
+ * etc. will change the default log level. Setting "CELER_LOG_ASYNC" to a
+ * nonempty value writes messages from a background thread.
  */
 Logger& world_logger()
 {
@@ -134,7 +148,7 @@ Logger& world_logger()
         ScopedMpiInit::status() != ScopedMpiInit::Status::disabled
             ? Communicator::comm_world()
             : Communicator{},
-        &default_global_handler,
+        make_handler(&default_global_handler),
         "CELER_LOG");
     return logger;
 }
@@ -144,7 +158,8 @@ Logger& world_logger()
  * Serial logger: print on *every* process that calls it.
  *
  * Setting the "CELER_LOG_LOCAL" environment variable to "debug", "info",
- * "error", etc. will change the default log level.
+ * "error", etc. will change the default log level. "CELER_LOG_ASYNC" applies
+ * as for the world logger.
  */
 Logger& self_logger()
 {
@@ -154,9 +169,10 @@ Logger& self_logger()
         ScopedMpiInit::status() != ScopedMpiInit::Status::disabled
             ? Communicator::comm_world()
             : Communicator{},
-        ScopedMpiInit::status() != ScopedMpiInit::Status::disabled
-            ? LocalHandler{Communicator::comm_world()}
-            : LogHandler{&default_global_handler},
+        make_handler(
+            ScopedMpiInit::status() != ScopedMpiInit::Status::disabled
+                ? LocalHandler{Communicator::comm_world()}
+                : LogHandler{&default_global_handler}),
         "CELER_LOG_LOCAL");
     return logger;
 }
@@ -23,7 +23,8 @@
  * parallel.
  *
  * The logger will only format and print messages. It is not responsible
- * for cleaning up the state or exiting an app.
+ * for cleaning up the state or exiting an app. If the level is filtered out,
+ * the streamed expressions are not evaluated at all.
  *
  * \code
  CELER_LOG(debug) << "Don't print this in general";
@@ -31,9 +32,12 @@
  CELER_LOG(critical) << "Caught a fatal exception: " << e.what();
  * \endcode
  */
-#define CELER_LOG(LEVEL)                              \
-    ::celeritas::world_logger()({__FILE__, __LINE__}, \
-                                ::celeritas::LogLevel::LEVEL)
+#define CELER_LOG(LEVEL)                                                  \
+    !::celeritas::world_logger().enabled(::celeritas::LogLevel::LEVEL)    \
+        ? (void)0                                                         \
+        : ::celeritas::detail::LogVoidify()                               \
+              & ::celeritas::world_logger()({__FILE__, __LINE__},         \
+                                            ::celeritas::LogLevel::LEVEL)
 
 //---------------------------------------------------------------------------//
 /*!
@@ -42,9 +46,12 @@
  * Like \c CELER_LOG but for code paths that may only happen on a single
  * process. Use sparingly.
  */
-#define CELER_LOG_LOCAL(LEVEL)                       \
-    ::celeritas::self_logger()({__FILE__, __LINE__}, \
-                               ::celeritas::LogLevel::LEVEL)
+#define CELER_LOG_LOCAL(LEVEL)                                           \
+    !::celeritas::self_logger().enabled(::celeritas::LogLevel::LEVEL)    \
+        ? (void)0                                                        \
+        : ::celeritas::detail::LogVoidify()                              \
+              & ::celeritas::self_logger()({__FILE__, __LINE__},         \
+                                           ::celeritas::LogLevel::LEVEL)
 
 namespace celeritas
 {
@@ -61,6 +68,9 @@ class Communicator;
  * different one, you can call \code
    world_logger = Logger(Communicator::comm_world(), my_handler);
  * \endcode
+ *
+ * Wrap the handler in an \c AsyncLogHandler to write messages from a
+ * background thread.
  */
 class Logger
 {
@@ -73,6 +83,9 @@ class Logger
     // Create a logger that flushes its contents when it destructs
     inline detail::LoggerMessage operator()(Provenance prov, LogLevel lev);
 
+    //! Whether messages at the given level are written
+    bool enabled(LogLevel lev) const { return handle_ && lev >= min_level_; }
+
     //! Set the minimum logging verbosity
     void level(LogLevel lev) { min_level_ = lev; }
 
@@ -91,7 +104,7 @@ class Logger
 detail::LoggerMessage Logger::operator()(Provenance prov, LogLevel lev)
 {
     LogHandler* handle = nullptr;
-    if (handle_ && lev >= min_level_)
+    if (this->enabled(lev))
     {
         handle = &handle_;
     }
@@ -0,0 +1,127 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file NodeSharedData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include "base/Collection.hh"
+#include "Communicator.hh"
+#include "NodeSharedMemory.hh"
+#include "Operations.hh"
+#include "detail/SharedCollectionImpl.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Host collection group built by one process and stored once per node.
+ *
+ * The first process of the communicator copies the collections of its group
+ * into a single block of memory. The first process on every other node
+ * receives the block by broadcast into node-shared memory, which the other
+ * processes on the node map without allocating anything. Every process gets
+ * the group's scalar data and a \c const_reference group that points into
+ * the shared memory, so the original data can be discarded. Use
+ * \c BroadcastData instead for a private copy on each process.
+ *
+ * The group must list all of its collections in both overloads of
+ * \c visit_members, and its \c const_reference instantiation must be
+ * trivially copyable. The data passed by processes other than the first is
+ * ignored and may be empty.
+ *
+ * Construction and destruction are collective over the communicator.
+ */
+template<template<Ownership, MemSpace> class P>
+class NodeSharedData
+{
+  public:
+    //!@{
+    //! Type aliases
+    using HostRef = P<Ownership::const_reference, MemSpace::host>;
+    //!@}
+
+  public:
+    // Copy the first process's data to every node (collective)
+    NodeSharedData(const Communicator& comm, const HostRef& data);
+
+    //! Access the shared data
+    const HostRef& host_ref() const { return host_ref_; }
+
+    //! Shared memory in bytes
+    std::size_t size() const { return memory_.size(); }
+
+  private:
+    NodeSharedMemory memory_;
+    HostRef          host_ref_;
+
+    static std::size_t calc_bytes(const HostRef& data);
+};
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the first process's data to every node.
+ */
+template<template<Ownership, MemSpace> class P>
+NodeSharedData<P>::NodeSharedData(const Communicator& comm,
+                                  const HostRef&      data)
+    : memory_(comm, broadcast(comm, comm.rank() == 0 ? calc_bytes(data) : 0))
+{
+    static_assert(std::is_trivially_copyable<HostRef>::value,
+                  "Shared collection groups must be trivially copyable");
+
+    const bool is_root = (comm.rank() == 0);
+    char*      base    = static_cast<char*>(memory_.data());
+    if (is_root)
+    {
+        CELER_EXPECT(data);
+        host_ref_ = data;
+        detail::SharedCollectionCopier copy{base, memory_.size()};
+        host_ref_.visit_members(copy);
+        CELER_ASSERT(copy.offset == memory_.size());
+    }
+
+    // Send scalars and collection sizes, with addresses in the first
+    // process's memory, to the other processes
+    host_ref_ = broadcast(comm, host_ref_);
+    const auto root_base
+        = broadcast(comm, reinterpret_cast<std::uintptr_t>(base));
+
+    // Fill the memory of the other nodes: the collections are laid out
+    // identically, so the whole block is sent at once
+    if (memory_.writer())
+    {
+        broadcast(memory_.writer_comm(), Span<char>{base, memory_.size()});
+    }
+    memory_.fence();
+
+    if (!is_root)
+    {
+        detail::SharedCollectionRebaser rebase{
+            root_base, base, memory_.size()};
+        host_ref_.visit_members(rebase);
+    }
+    CELER_ENSURE(host_ref_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the shared memory needed to store the data.
+ */
+template<template<Ownership, MemSpace> class P>
+std::size_t NodeSharedData<P>::calc_bytes(const HostRef& data)
+{
+    detail::SharedLayoutCalculator calc;
+    data.visit_members(calc);
+    return calc.bytes;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
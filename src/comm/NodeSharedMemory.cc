@@ -0,0 +1,125 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file NodeSharedMemory.cc
+//---------------------------------------------------------------------------//
+#include "NodeSharedMemory.hh"
+
+#include "celeritas_config.h"
+#if CELERITAS_USE_MPI
+#    include <mpi.h>
+#endif
+
+#include "base/Assert.hh"
+#include "base/HostAllocator.hh"
+#include "Operations.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate the writer's requested size on each node.
+ *
+ * Only the size requested by the writer is used. The processes of each node,
+ * and the writers of all nodes, share communicators split from the given
+ * one, which are freed with the memory. The writers are ordered by their
+ * rank in the given communicator.
+ */
+NodeSharedMemory::NodeSharedMemory(const Communicator& comm, std::size_t bytes)
+{
+    if (!comm)
+    {
+        data_ = bytes > 0 ? host_allocate(bytes) : nullptr;
+        size_ = bytes;
+        return;
+    }
+
+#if CELERITAS_USE_MPI
+    MPI_Comm node_comm;
+    CELER_MPI_CALL(MPI_Comm_split_type(comm.mpi_comm(),
+                                       MPI_COMM_TYPE_SHARED,
+                                       comm.rank(),
+                                       MPI_INFO_NULL,
+                                       &node_comm));
+    node_comm_ = Communicator{node_comm};
+    size_      = broadcast(node_comm_, bytes);
+
+    MPI_Comm writer_comm;
+    CELER_MPI_CALL(MPI_Comm_split(comm.mpi_comm(),
+                                  this->writer() ? 0 : MPI_UNDEFINED,
+                                  comm.rank(),
+                                  &writer_comm));
+    if (writer_comm != MPI_COMM_NULL)
+    {
+        writer_comm_ = Communicator{writer_comm};
+    }
+
+    void* base = nullptr;
+    CELER_MPI_CALL(MPI_Win_allocate_shared(this->writer() ? size_ : 0,
+                                           1,
+                                           MPI_INFO_NULL,
+                                           node_comm,
+                                           &base,
+                                           &win_));
+
+    // Map the writer's segment
+    MPI_Aint writer_size = 0;
+    int      disp_unit   = 0;
+    CELER_MPI_CALL(
+        MPI_Win_shared_query(win_, 0, &writer_size, &disp_unit, &data_));
+    CELER_ASSERT(static_cast<std::size_t>(writer_size) == size_);
+
+    // Open a passive epoch so that memory can be synchronized in fence
+    CELER_MPI_CALL(MPI_Win_lock_all(MPI_MODE_NOCHECK, win_));
+#else
+    CELER_NOT_CONFIGURED("MPI");
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Free the memory.
+ *
+ * Errors are ignored since this is called during cleanup.
+ */
+NodeSharedMemory::~NodeSharedMemory()
+{
+    if (!node_comm_)
+    {
+        host_deallocate(data_);
+        return;
+    }
+
+#if CELERITAS_USE_MPI
+    MPI_Win_unlock_all(win_);
+    MPI_Win_free(&win_);
+    if (writer_comm_)
+    {
+        MPI_Comm writer_comm = writer_comm_.mpi_comm();
+        MPI_Comm_free(&writer_comm);
+    }
+    MPI_Comm node_comm = node_comm_.mpi_comm();
+    MPI_Comm_free(&node_comm);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Wait for the writer to finish filling the memory.
+ */
+void NodeSharedMemory::fence()
+{
+    if (!node_comm_)
+        return;
+
+#if CELERITAS_USE_MPI
+    CELER_MPI_CALL(MPI_Win_sync(win_));
+    CELER_MPI_CALL(MPI_Barrier(node_comm_.mpi_comm()));
+    CELER_MPI_CALL(MPI_Win_sync(win_));
+#endif
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
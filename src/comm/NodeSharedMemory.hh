@@ -0,0 +1,77 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file NodeSharedMemory.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include "Communicator.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Memory allocated once per node and mapped by every process on it.
+ *
+ * The processes of the communicator are grouped by shared-memory node, and
+ * the first process on each node (the "writer") allocates an MPI-3 shared
+ * window that the other processes map into their address spaces. The writer
+ * fills the memory, then all processes call \c fence, after which the data
+ * should be treated as read-only. The writers of all nodes are connected by a
+ * separate communicator so that they can receive data without the other
+ * processes allocating any. With a null communicator the memory is a private
+ * allocation.
+ *
+ * Construction, \c fence, and destruction are collective over the
+ * communicator.
+ */
+class NodeSharedMemory
+{
+  public:
+    // Allocate the writer's requested size on each node (collective)
+    NodeSharedMemory(const Communicator& comm, std::size_t bytes);
+
+    // Free the memory (collective)
+    ~NodeSharedMemory();
+
+    //!@{
+    //! Prevent copying and moving
+    NodeSharedMemory(const NodeSharedMemory&) = delete;
+    NodeSharedMemory& operator=(const NodeSharedMemory&) = delete;
+    //!@}
+
+    // Wait for the writer to finish filling the memory (collective)
+    void fence();
+
+    //// ACCESSORS ////
+
+    //! Whether this process fills the memory for its node
+    bool writer() const { return node_comm_.rank() == 0; }
+
+    //! Processes on this node
+    const Communicator& node_comm() const { return node_comm_; }
+
+    //! Writers of all nodes (null if not a writer)
+    const Communicator& writer_comm() const { return writer_comm_; }
+
+    //! Start of the memory (in this process's address space)
+    void* data() const { return data_; }
+
+    //! Size of the memory in bytes
+    std::size_t size() const { return size_; }
+
+  private:
+    using MpiWin = detail::MpiWin;
+
+    Communicator node_comm_;
+    Communicator writer_comm_;
+    MpiWin       win_  = detail::MpiWinNull();
+    void*        data_ = nullptr;
+    std::size_t  size_ = 0;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -7,7 +7,10 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <string>
 #include <type_traits>
+#include <vector>
+#include "base/Collection.hh"
 #include "base/Span.hh"
 #include "Communicator.hh"
 
@@ -49,6 +52,36 @@ inline void allreduce(const Communicator& comm, Operation op, Span<T, N> data);
 template<class T, std::enable_if_t<std::is_fundamental<T>::value, T*> = nullptr>
 inline T allreduce(const Communicator& comm, Operation op, const T src);
 
+//---------------------------------------------------------------------------//
+// Copy trivially copyable data from the root process to all others
+template<class T, std::size_t N>
+inline void broadcast(const Communicator& comm, Span<T, N> data, int root = 0);
+
+//---------------------------------------------------------------------------//
+// Copy a trivially copyable value from the root process and return it
+template<class T,
+         std::enable_if_t<std::is_trivially_copyable<T>::value, T*> = nullptr>
+inline T broadcast(const Communicator& comm, T value, int root = 0);
+
+//---------------------------------------------------------------------------//
+// Copy a host collection from the root process to all others
+template<class T, class I>
+inline void
+broadcast(const Communicator&                                   comm,
+          Collection<T, Ownership::value, MemSpace::host, I>* data,
+          int                                                   root = 0);
+
+//---------------------------------------------------------------------------//
+// Copy a string from the root process to all others
+inline void
+broadcast(const Communicator& comm, std::string* data, int root = 0);
+
+//---------------------------------------------------------------------------//
+// Copy a vector of strings from the root process to all others
+inline void broadcast(const Communicator&       comm,
+                      std::vector<std::string>* data,
+                      int                       root = 0);
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
 
@@ -8,12 +8,14 @@
 #include "Operations.hh"
 
 #include <algorithm>
+#include <climits>
 #include "celeritas_config.h"
 #if CELERITAS_USE_MPI
 #    include <mpi.h>
 #endif
 
 #include "base/Assert.hh"
+#include "base/CollectionBuilder.hh"
 #include "base/Macros.hh"
 #include "detail/MpiTypes.hh"
 
@@ -108,5 +110,102 @@ T allreduce(const Communicator& comm, Operation op, const T src)
     return dst;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Copy trivially copyable data from the root process to all others.
+ *
+ * The data is sent as raw bytes, so all processes must share a data
+ * representation. The destination must already have the same size on all
+ * processes. Large arrays are sent in chunks since MPI counts are \c int.
+ */
+template<class T, std::size_t N>
+void broadcast(const Communicator& comm, Span<T, N> data, int root)
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Broadcast data must be trivially copyable");
+    if (!comm)
+        return;
+
+    CELER_EXPECT(root >= 0 && root < comm.size());
+    auto*       bytes     = reinterpret_cast<char*>(data.data());
+    std::size_t remaining = data.size() * sizeof(T);
+    while (remaining > 0)
+    {
+        const int count = static_cast<int>(
+            std::min<std::size_t>(remaining, INT_MAX));
+        CELER_MPI_CALL(
+            MPI_Bcast(bytes, count, MPI_BYTE, root, comm.mpi_comm()));
+        bytes += count;
+        remaining -= count;
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy a trivially copyable value from the root process and return it.
+ */
+template<class T,
+         std::enable_if_t<std::is_trivially_copyable<T>::value, T*>>
+T broadcast(const Communicator& comm, T value, int root)
+{
+    broadcast(comm, Span<T, 1>{&value, 1}, root);
+    return value;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy a host collection from the root process to all others.
+ *
+ * The collection on the other processes is resized to match the root, so
+ * params data built or loaded once can be adopted by every process without
+ * rebuilding it. The items must be trivially copyable: this excludes nested
+ * collections but includes \c ItemRange and \c OpaqueId references into
+ * other collections, which remain valid when those are also broadcast.
+ */
+template<class T, class I>
+void broadcast(const Communicator&                                   comm,
+               Collection<T, Ownership::value, MemSpace::host, I>* data,
+               int                                                   root)
+{
+    CELER_EXPECT(data);
+    const size_type size = broadcast(comm, data->size(), root);
+    if (comm.rank() != root)
+    {
+        make_builder(data).resize(size);
+    }
+    broadcast(comm, (*data)[AllItems<T, MemSpace::host>{}], root);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy a string from the root process to all others.
+ */
+void broadcast(const Communicator& comm, std::string* data, int root)
+{
+    CELER_EXPECT(data);
+    data->resize(broadcast(comm, data->size(), root));
+    if (!data->empty())
+    {
+        broadcast(comm, Span<char>{&data->front(), data->size()}, root);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy a vector of strings, such as the names of params items, from the root
+ * process to all others.
+ */
+void broadcast(const Communicator&       comm,
+               std::vector<std::string>* data,
+               int                       root)
+{
+    CELER_EXPECT(data);
+    data->resize(broadcast(comm, data->size(), root));
+    for (std::string& s : *data)
+    {
+        broadcast(comm, &s, root);
+    }
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -0,0 +1,363 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file Tracer.cc
+//---------------------------------------------------------------------------//
+#include "Tracer.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include "celeritas_config.h"
+#if CELERITAS_USE_MPI
+#    include <mpi.h>
+#endif
+
+#include "base/Assert.hh"
+#include "base/Macros.hh"
+#include "base/Range.hh"
+#include "Communicator.hh"
+#include "ScopedMpiInit.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Unique identifier for each tracer instance
+unsigned int next_tracer_uid()
+{
+    static std::atomic<unsigned int> uid{0};
+    return ++uid;
+}
+
+//---------------------------------------------------------------------------//
+//! Most recently used buffer of the calling thread
+struct ThreadBufferCache
+{
+    unsigned int uid    = 0;
+    void*        buffer = nullptr;
+};
+
+thread_local ThreadBufferCache tl_buffer_cache;
+
+//---------------------------------------------------------------------------//
+//! Whether MPI has been finalized
+bool mpi_finalized()
+{
+    int result = 1;
+    CELER_MPI_CALL(MPI_Finalized(&result));
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+//! Write a string as a quoted JSON value
+void write_json_string(std::ostream& os, const char* str)
+{
+    os << '"';
+    for (const char* c = str; *c != '\0'; ++c)
+    {
+        switch (*c)
+        {
+            case '"':
+                os << "\\\"";
+                break;
+            case '\\':
+                os << "\\\\";
+                break;
+            case '\n':
+                os << "\\n";
+                break;
+            default:
+                os << *c;
+        }
+    }
+    os << '"';
+}
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct disabled.
+ */
+Tracer::Tracer() : uid_(next_tracer_uid()), start_(Clock::now()) {}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct and enable with options.
+ */
+Tracer::Tracer(Options opts)
+    : enabled_(true)
+    , opts_(std::move(opts))
+    , uid_(next_tracer_uid())
+    , start_(Clock::now())
+{
+    CELER_EXPECT(opts_.capacity > 0);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the trace file if requested.
+ *
+ * With more than one MPI process, the rank is appended to the filename. The
+ * rank is looked up now if MPI is still active, otherwise the rank found when
+ * an event was last recorded is used.
+ */
+Tracer::~Tracer()
+{
+    if (!enabled_ || opts_.filename.empty())
+        return;
+
+    try
+    {
+        {
+            std::lock_guard<std::mutex> scoped_lock(mutex_);
+            this->resolve_rank();
+        }
+        std::string filename = opts_.filename;
+        if (size_ > 1)
+        {
+            filename += '.' + std::to_string(rank_);
+        }
+        std::ofstream outf(filename);
+        if (outf)
+        {
+            this->write(outf);
+        }
+    }
+    catch (...)
+    {
+        // Ignore errors during shutdown
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record a complete event on the calling thread.
+ */
+void Tracer::record(const char* name,
+                    size_type   step,
+                    TimePoint   begin,
+                    TimePoint   end)
+{
+    CELER_EXPECT(name);
+    if (!enabled_)
+        return;
+
+    if (CELER_UNLIKELY(!rank_resolved_.load(std::memory_order_relaxed)))
+    {
+        std::lock_guard<std::mutex> scoped_lock(mutex_);
+        this->resolve_rank();
+    }
+
+    ThreadBuffer& buf    = this->thread_buffer();
+    buf.events[buf.next] = {name, step, begin, end};
+    if (++buf.next == buf.events.size())
+    {
+        buf.next = 0;
+    }
+    ++buf.count;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of threads that have recorded events.
+ */
+size_type Tracer::num_threads() const
+{
+    std::lock_guard<std::mutex> scoped_lock(mutex_);
+    return buffers_.size();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of events currently stored.
+ */
+size_type Tracer::num_events() const
+{
+    std::lock_guard<std::mutex> scoped_lock(mutex_);
+    size_type                   result = 0;
+    for (const auto& buf : buffers_)
+    {
+        result += std::min<ull_int>(buf->count, buf->events.size());
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Number of events overwritten because a buffer was full.
+ */
+size_type Tracer::num_dropped() const
+{
+    std::lock_guard<std::mutex> scoped_lock(mutex_);
+    size_type                   result = 0;
+    for (const auto& buf : buffers_)
+    {
+        if (buf->count > buf->events.size())
+        {
+            result += buf->count - buf->events.size();
+        }
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Write the timeline in the Chrome trace-event format.
+ *
+ * Each event is written as a "complete" event with its start time and
+ * duration in microseconds relative to the construction of the tracer. The
+ * process ID is the MPI rank, and each thread is labeled by the order in which
+ * it first recorded an event. The step number, if any, is an event argument.
+ */
+void Tracer::write(std::ostream& os) const
+{
+    std::lock_guard<std::mutex> scoped_lock(mutex_);
+
+    auto to_us = [this](TimePoint t) {
+        return std::chrono::duration<double, std::micro>(t - start_).count();
+    };
+
+    const auto orig_flags     = os.flags();
+    const auto orig_precision = os.precision();
+    os << std::fixed << std::setprecision(3);
+
+    os << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    for (auto tid : range(buffers_.size()))
+    {
+        const ThreadBuffer& buf = *buffers_[tid];
+
+        // Label the thread
+        os << (tid == 0 ? "" : ",")
+           << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << rank_
+           << ",\"tid\":" << tid << ",\"args\":{\"name\":\"thread " << tid
+           << "\"}}";
+
+        // Write events from oldest to newest
+        const size_type capacity   = buf.events.size();
+        const size_type num_stored = std::min<ull_int>(buf.count, capacity);
+        const size_type first      = buf.count > capacity ? buf.next : 0;
+        for (auto i : range(num_stored))
+        {
+            const Event& e = buf.events[(first + i) % capacity];
+            os << ",\n{\"name\":";
+            write_json_string(os, e.name);
+            os << ",\"cat\":\"celeritas\",\"ph\":\"X\",\"pid\":" << rank_
+               << ",\"tid\":" << tid << ",\"ts\":" << to_us(e.begin)
+               << ",\"dur\":" << to_us(e.end) - to_us(e.begin);
+            if (e.step != no_step())
+            {
+                os << ",\"args\":{\"step\":" << e.step << '}';
+            }
+            os << '}';
+        }
+    }
+    os << "\n]}\n";
+
+    os.flags(orig_flags);
+    os.precision(orig_precision);
+}
+
+//---------------------------------------------------------------------------//
+// PRIVATE HELPER FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Get the ring buffer for the calling thread, allocating it if needed.
+ *
+ * The most recently used buffer is cached in thread-local storage so that
+ * repeated events from a thread don't need to acquire the lock.
+ */
+auto Tracer::thread_buffer() -> ThreadBuffer&
+{
+    ThreadBufferCache& cache = tl_buffer_cache;
+    if (cache.uid == uid_)
+    {
+        return *static_cast<ThreadBuffer*>(cache.buffer);
+    }
+
+    std::lock_guard<std::mutex> scoped_lock(mutex_);
+    const auto                  this_thread = std::this_thread::get_id();
+    ThreadBuffer*               result      = nullptr;
+    for (const auto& buf : buffers_)
+    {
+        if (buf->owner == this_thread)
+        {
+            result = buf.get();
+            break;
+        }
+    }
+    if (!result)
+    {
+        auto buf   = std::make_unique<ThreadBuffer>();
+        buf->owner = this_thread;
+        buf->events.resize(opts_.capacity);
+        result = buf.get();
+        buffers_.push_back(std::move(buf));
+    }
+
+    cache.uid    = uid_;
+    cache.buffer = result;
+    return *result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Look up the MPI rank that labels the output, if MPI is active.
+ *
+ * The lock must be held by the caller.
+ */
+void Tracer::resolve_rank()
+{
+    switch (ScopedMpiInit::status())
+    {
+        case ScopedMpiInit::Status::disabled:
+            // Always a single process
+            rank_resolved_ = true;
+            return;
+        case ScopedMpiInit::Status::uninitialized:
+            return;
+        case ScopedMpiInit::Status::initialized:
+            if (mpi_finalized())
+                return;
+    }
+
+    Communicator comm = Communicator::comm_world();
+    rank_             = comm.rank();
+    size_             = comm.size();
+    rank_resolved_    = true;
+}
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Global tracer.
+ *
+ * Tracing is enabled by setting the \c CELER_TRACE_FILE environment variable
+ * to the path of the output file, which is written at program exit.
+ */
+Tracer& tracer()
+{
+    static const std::unique_ptr<Tracer> result = [] {
+        const char* filename = std::getenv("CELER_TRACE_FILE");
+        if (!filename || filename[0] == '\0')
+        {
+            return std::make_unique<Tracer>();
+        }
+        Tracer::Options opts;
+        opts.filename = filename;
+        return std::make_unique<Tracer>(std::move(opts));
+    }();
+    return *result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
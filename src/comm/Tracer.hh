@@ -0,0 +1,207 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file Tracer.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "base/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Record a timeline of named, timed events for each host thread.
+ *
+ * Each thread that records an event is assigned its own ring buffer,
+ * preallocated at its first event, so recording takes no lock and never
+ * allocates. When a buffer is full, its oldest events are overwritten. The
+ * timeline is written in the Chrome trace-event JSON format, which can be
+ * viewed with \c chrome://tracing or https://ui.perfetto.dev .
+ *
+ * Event names must be string literals (or otherwise outlive the tracer),
+ * since only the pointer is stored. The timeline should be written only after
+ * all threads have stopped recording.
+ */
+class Tracer
+{
+  public:
+    //!@{
+    //! Type aliases
+    using Clock     = std::chrono::steady_clock;
+    using TimePoint = Clock::time_point;
+    //!@}
+
+    //! Construction options
+    struct Options
+    {
+        //! Events stored per thread
+        size_type capacity = 1 << 16;
+        //! Trace file written at destruction (none if empty)
+        std::string filename;
+    };
+
+    //! Sentinel for events that don't belong to a step
+    static constexpr size_type no_step() { return size_type(-1); }
+
+  public:
+    // Construct disabled
+    Tracer();
+
+    // Construct and enable with options
+    explicit Tracer(Options opts);
+
+    // Write the trace file if requested
+    ~Tracer();
+
+    //! Whether events are being recorded
+    bool enabled() const { return enabled_; }
+
+    // Record a complete event on the calling thread
+    void
+    record(const char* name, size_type step, TimePoint begin, TimePoint end);
+
+    //// ACCESSORS ////
+
+    // Number of threads that have recorded events
+    size_type num_threads() const;
+
+    // Number of events currently stored
+    size_type num_events() const;
+
+    // Number of events overwritten because a buffer was full
+    size_type num_dropped() const;
+
+    //// OUTPUT ////
+
+    // Write the timeline in the Chrome trace-event format
+    void write(std::ostream& os) const;
+
+  private:
+    struct Event
+    {
+        const char* name;
+        size_type   step;
+        TimePoint   begin;
+        TimePoint   end;
+    };
+
+    struct ThreadBuffer
+    {
+        std::thread::id    owner;
+        std::vector<Event> events;
+        size_type          next  = 0; //!< Index of the next slot to write
+        ull_int            count = 0; //!< Total events ever recorded
+    };
+
+    bool                                       enabled_ = false;
+    Options                                    opts_;
+    unsigned int                               uid_;
+    TimePoint                                  start_;
+    int                                        rank_ = 0;
+    int                                        size_ = 1;
+    std::atomic<bool>                          rank_resolved_{false};
+    mutable std::mutex                         mutex_;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers_;
+
+    //// HELPER FUNCTIONS ////
+
+    ThreadBuffer& thread_buffer();
+    void          resolve_rank();
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record the duration of the enclosing scope in the global tracer.
+ *
+ * When tracing is disabled, this only costs a check of a boolean.
+ *
+ * \code
+    {
+        ScopedTrace trace("pre_step", step);
+        launch_pre_step(...);
+    }
+   \endcode
+ */
+class ScopedTrace
+{
+  public:
+    // Start an event that isn't associated with a step
+    explicit inline ScopedTrace(const char* name);
+
+    // Start an event for a given step
+    inline ScopedTrace(const char* name, size_type step);
+
+    // Record the event
+    inline ~ScopedTrace();
+
+    //!@{
+    //! Prevent copying and moving
+    ScopedTrace(const ScopedTrace&) = delete;
+    ScopedTrace& operator=(const ScopedTrace&) = delete;
+    //!@}
+
+  private:
+    Tracer*           tracer_;
+    const char*       name_;
+    size_type         step_;
+    Tracer::TimePoint begin_;
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+// Global tracer, enabled by the CELER_TRACE_FILE environment variable
+Tracer& tracer();
+
+//---------------------------------------------------------------------------//
+// INLINE DEFINITIONS
+//---------------------------------------------------------------------------//
+/*!
+ * Start an event that isn't associated with a step.
+ */
+ScopedTrace::ScopedTrace(const char* name)
+    : ScopedTrace(name, Tracer::no_step())
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Start an event for a given step.
+ */
+ScopedTrace::ScopedTrace(const char* name, size_type step)
+    : tracer_(nullptr), name_(name), step_(step)
+{
+    Tracer& t = tracer();
+    if (t.enabled())
+    {
+        tracer_ = &t;
+        begin_  = Tracer::Clock::now();
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Record the event.
+ */
+ScopedTrace::~ScopedTrace()
+{
+    if (tracer_)
+    {
+        tracer_->record(name_, step_, begin_, Tracer::Clock::now());
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
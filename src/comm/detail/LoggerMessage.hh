@@ -61,6 +61,20 @@ class LoggerMessage
     std::unique_ptr<std::ostream> os_;
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Discard the result of a log stream expression.
+ *
+ * This lets the logging macros skip the whole stream expression with the
+ * conditional operator, which requires both branches to be \c void. The \c &
+ * operator binds more loosely than \c << so it applies to the full
+ * expression.
+ */
+struct LogVoidify
+{
+    void operator&(const LoggerMessage&) {}
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Write the object to the stream if applicable.
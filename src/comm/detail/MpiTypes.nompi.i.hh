@@ -40,6 +40,16 @@ constexpr inline MpiComm MpiCommWorld()
     return {1};
 }
 
+struct MpiWin
+{
+    int value_;
+};
+
+constexpr inline MpiWin MpiWinNull()
+{
+    return {0};
+}
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
@@ -0,0 +1,140 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SharedCollectionImpl.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include "base/Assert.hh"
+#include "base/Collection.hh"
+#include "base/HostAllocator.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+//! Round up to the alignment of host collection storage
+inline std::size_t align_shared_offset(std::size_t offset)
+{
+    return (offset + host_alignment - 1) / host_alignment * host_alignment;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the size of a block holding all collections of a group.
+ */
+struct SharedLayoutCalculator
+{
+    std::size_t bytes = 0;
+
+    template<class T, class I>
+    void operator()(
+        const char*,
+        const Collection<T, Ownership::const_reference, MemSpace::host, I>& c)
+    {
+        bytes = align_shared_offset(bytes) + std::size_t(c.size()) * sizeof(T);
+    }
+
+    template<class G>
+    auto operator()(const char*, const G& group) -> decltype(
+        group.visit_members(std::declval<SharedLayoutCalculator&>()))
+    {
+        group.visit_members(*this);
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy each collection of a group into a block and point to it.
+ *
+ * The collections are reassigned in place through the mutable overload of the
+ * group's \c visit_members.
+ */
+struct SharedCollectionCopier
+{
+    char*       base;
+    std::size_t size;
+    std::size_t offset = 0;
+
+    template<class T, class I>
+    void operator()(
+        const char*,
+        Collection<T, Ownership::const_reference, MemSpace::host, I>& c)
+    {
+        using CollectionT
+            = Collection<T, Ownership::const_reference, MemSpace::host, I>;
+
+        offset    = align_shared_offset(offset);
+        auto  src = c[AllItems<T, MemSpace::host>{}];
+        auto* dst = reinterpret_cast<T*>(base + offset);
+        CELER_ASSERT(offset + src.size() * sizeof(T) <= size);
+        if (!src.empty())
+        {
+            std::memcpy(dst, src.data(), src.size() * sizeof(T));
+        }
+        c = CollectionT{{dst, src.size()}};
+        offset += src.size() * sizeof(T);
+    }
+
+    template<class G>
+    auto operator()(const char*, G& group) -> decltype(
+        group.visit_members(std::declval<SharedCollectionCopier&>()))
+    {
+        group.visit_members(*this);
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Translate collection addresses from a block in another process's memory.
+ *
+ * Each collection must lie inside the source block, which has the same size
+ * as the destination.
+ */
+struct SharedCollectionRebaser
+{
+    std::uintptr_t src_base;
+    char*          dst_base;
+    std::size_t    size;
+
+    template<class T, class I>
+    void operator()(
+        const char*,
+        Collection<T, Ownership::const_reference, MemSpace::host, I>& c)
+    {
+        using CollectionT
+            = Collection<T, Ownership::const_reference, MemSpace::host, I>;
+
+        auto src  = c[AllItems<T, MemSpace::host>{}];
+        auto addr = reinterpret_cast<std::uintptr_t>(src.data());
+        if (src.empty())
+        {
+            // Empty collections may have a null address
+            c = CollectionT{};
+            return;
+        }
+        CELER_ASSERT(addr >= src_base
+                     && addr - src_base + src.size() * sizeof(T) <= size);
+        const auto* dst = reinterpret_cast<const T*>(dst_base
+                                                     + (addr - src_base));
+        c               = CollectionT{{dst, src.size()}};
+    }
+
+    template<class G>
+    auto operator()(const char*, G& group) -> decltype(
+        group.visit_members(std::declval<SharedCollectionRebaser&>()))
+    {
+        group.visit_members(*this);
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -113,6 +113,16 @@ struct GeoStateData
         vgnext    = other.vgnext;
         return *this;
     }
+
+    //! Visit each collection and nested group
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("pos", pos);
+        visit("dir", dir);
+        visit("next_step", next_step);
+        // VecGeom navigation states aren't stored in collections
+    }
 };
 
 //---------------------------------------------------------------------------//
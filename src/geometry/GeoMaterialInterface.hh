@@ -39,6 +39,20 @@ struct GeoMaterialParamsData
         materials = other.materials;
         return *this;
     }
+
+    //! Visit each collection and nested group
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("materials", materials);
+    }
+
+    //! Visit each collection and nested group for modification
+    template<class F>
+    void visit_members(F&& visit)
+    {
+        visit("materials", materials);
+    }
 };
 
 //---------------------------------------------------------------------------//
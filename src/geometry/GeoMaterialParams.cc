@@ -38,5 +38,16 @@ GeoMaterialParams::GeoMaterialParams(Input input)
     CELER_ENSURE(data_);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from data built elsewhere, e.g. on another process.
+ */
+GeoMaterialParams::GeoMaterialParams(
+    CollectionMirror<GeoMaterialParamsData> data)
+    : data_(std::move(data))
+{
+    CELER_EXPECT(data_);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
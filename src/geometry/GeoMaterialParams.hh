@@ -43,6 +43,9 @@ class GeoMaterialParams
     // Construct from geometry and material params
     explicit GeoMaterialParams(Input);
 
+    // Construct from data built elsewhere
+    explicit GeoMaterialParams(CollectionMirror<GeoMaterialParamsData> data);
+
     //! Access material properties on the host
     const HostRef& host_pointers() const { return data_.host(); }
 
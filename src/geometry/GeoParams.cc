@@ -20,6 +20,7 @@
 
 #include "comm/Device.hh"
 #include "comm/Logger.hh"
+#include "comm/Tracer.hh"
 #include "GeoInterface.hh"
 #include "detail/ScopedTimeAndRedirect.hh"
 
@@ -33,6 +34,7 @@ GeoParams::GeoParams(const char* gdml_filename)
 {
     CELER_LOG(info) << "Loading from GDML at " << gdml_filename;
     {
+        ScopedTrace                   trace_scope("GeoParams::load_gdml");
         detail::ScopedTimeAndRedirect time_and_output_;
         constexpr bool                validate_xml_schema = false;
         vgdml::Frontend::Load(gdml_filename, validate_xml_schema);
@@ -40,6 +42,7 @@ GeoParams::GeoParams(const char* gdml_filename)
 
     CELER_LOG(status) << "Initializing tracking information";
     {
+        ScopedTrace                   trace_scope("GeoParams::init_bboxes");
         detail::ScopedTimeAndRedirect time_and_output_;
         vecgeom::ABBoxManager::Instance().InitABBoxesForCompleteGeometry();
     }
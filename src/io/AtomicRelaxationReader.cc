@@ -10,6 +10,7 @@
 #include <fstream>
 #include <sstream>
 #include "base/SoftEqual.hh"
+#include "comm/Tracer.hh"
 
 namespace celeritas
 {
@@ -61,6 +62,7 @@ AtomicRelaxationReader::result_type
 AtomicRelaxationReader::operator()(AtomicNumber atomic_number) const
 {
     CELER_EXPECT(atomic_number > 0 && atomic_number < 101);
+    ScopedTrace trace_scope("AtomicRelaxationReader");
 
     // EADL does not provide transition data for Z < 6
     result_type result;
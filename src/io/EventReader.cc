@@ -8,6 +8,7 @@
 #include "EventReader.hh"
 
 #include "base/ArrayUtils.hh"
+#include "comm/Tracer.hh"
 #include "physics/base/Units.hh"
 #include "HepMC3/GenEvent.h"
 #include "HepMC3/ReaderFactory.h"
@@ -37,6 +38,8 @@ EventReader::~EventReader() = default;
  */
 EventReader::result_type EventReader::operator()()
 {
+    ScopedTrace trace_scope("EventReader");
+
     result_type result;
     int         event_id = -1;
 
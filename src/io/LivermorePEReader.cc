@@ -12,6 +12,7 @@
 #include "base/Assert.hh"
 #include "base/Macros.hh"
 #include "base/Types.hh"
+#include "comm/Tracer.hh"
 
 namespace celeritas
 {
@@ -52,6 +53,7 @@ LivermorePEReader::result_type
 LivermorePEReader::operator()(AtomicNumber atomic_number) const
 {
     CELER_EXPECT(atomic_number > 0 && atomic_number < 101);
+    ScopedTrace trace_scope("LivermorePEReader");
 
     result_type result;
     std::string Z = std::to_string(atomic_number);
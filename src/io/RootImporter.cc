@@ -19,6 +19,7 @@
 #include "base/Assert.hh"
 #include "base/Range.hh"
 #include "comm/Logger.hh"
+#include "comm/Tracer.hh"
 #include "physics/base/Units.hh"
 #include "ImportParticle.hh"
 
@@ -47,6 +48,8 @@ RootImporter::~RootImporter() = default;
  */
 ImportData RootImporter::operator()()
 {
+    ScopedTrace trace_scope("RootImporter");
+
     std::unique_ptr<TTree> tree_data(root_input_->Get<TTree>(tree_name()));
     CELER_ASSERT(tree_data);
     CELER_ASSERT(tree_data->GetEntries() == 1);
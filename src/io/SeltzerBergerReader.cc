@@ -11,6 +11,7 @@
 #include <sstream>
 #include "base/Assert.hh"
 #include "base/Range.hh"
+#include "comm/Tracer.hh"
 
 namespace celeritas
 {
@@ -54,6 +55,7 @@ SeltzerBergerReader::result_type
 SeltzerBergerReader::operator()(AtomicNumber atomic_number) const
 {
     CELER_EXPECT(atomic_number > 0);
+    ScopedTrace trace_scope("SeltzerBergerReader");
 
     result_type result;
 
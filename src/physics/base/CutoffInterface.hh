@@ -68,6 +68,20 @@ struct CutoffParamsData
 
         return *this;
     }
+
+    //! Visit each collection and nested group
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("cutoffs", cutoffs);
+    }
+
+    //! Visit each collection and nested group for modification
+    template<class F>
+    void visit_members(F&& visit)
+    {
+        visit("cutoffs", cutoffs);
+    }
 };
 
 //---------------------------------------------------------------------------//
@@ -108,5 +108,18 @@ CutoffParams::CutoffParams(const Input& input)
     CELER_ENSURE(this->host_pointers().cutoffs.size() == cutoffs_size);
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from data built elsewhere, e.g. on another process.
+ */
+CutoffParams::CutoffParams(CollectionMirror<CutoffParamsData> data)
+    : data_(std::move(data))
+{
+    CELER_EXPECT(data_);
+    CELER_EXPECT(this->host_pointers().cutoffs.size()
+                 == this->host_pointers().num_materials
+                        * this->host_pointers().num_particles);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
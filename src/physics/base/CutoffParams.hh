@@ -74,6 +74,9 @@ class CutoffParams
     // Construct with cutoff input data
     explicit CutoffParams(const Input& input);
 
+    // Construct from data built elsewhere
+    explicit CutoffParams(CollectionMirror<CutoffParamsData> data);
+
     // Access cutoffs on host
     inline CutoffView get(MaterialId material) const;
 
@@ -10,6 +10,7 @@
 #include "base/Span.hh"
 #include "base/StackAllocator.hh"
 #include "base/Types.hh"
+#include "random/RngCounterInterface.hh"
 #include "random/RngInterface.hh"
 #include "physics/material/MaterialInterface.hh"
 #include "physics/base/CutoffInterface.hh"
@@ -79,6 +80,9 @@ struct ModelInteractStateRefs
 
     AllocatorRef<Secondary> secondaries;
 
+    //! Optional tallies of random draws per interaction [model]
+    RngCounterData<Ownership::reference, M> rng_counters;
+
     //// METHODS ////
 
     //! True if assigned
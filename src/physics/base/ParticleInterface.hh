@@ -79,6 +79,20 @@ struct ParticleParamsData
         particles = other.particles;
         return *this;
     }
+
+    //! Visit each collection and nested group
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("particles", particles);
+    }
+
+    //! Visit each collection and nested group for modification
+    template<class F>
+    void visit_members(F&& visit)
+    {
+        visit("particles", particles);
+    }
 };
 
 //---------------------------------------------------------------------------//
@@ -141,6 +155,13 @@ struct ParticleStateData
         state = other.state;
         return *this;
     }
+
+    //! Visit each collection and nested group
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("state", state);
+    }
 };
 
 //---------------------------------------------------------------------------//
@@ -11,6 +11,7 @@
 
 #include "base/Assert.hh"
 #include "base/CollectionBuilder.hh"
+#include "base/Range.hh"
 #include "io/ImportData.hh"
 
 namespace celeritas
@@ -112,5 +113,37 @@ ParticleParams::ParticleParams(const Input& input)
     CELER_ENSURE(this->host_pointers().particles.size() == input.size());
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from data and metadata built elsewhere.
+ *
+ * This adopts data from another \c ParticleParams, e.g. one constructed on
+ * a different process.
+ */
+ParticleParams::ParticleParams(CollectionMirror<ParticleParamsData> data,
+                               std::vector<std::string>             names,
+                               std::vector<PDGNumber>               pdg_codes)
+    : data_(std::move(data))
+{
+    CELER_EXPECT(data_);
+    CELER_EXPECT(names.size() == pdg_codes.size());
+    CELER_EXPECT(this->host_pointers().particles.size() == names.size());
+
+    md_.reserve(names.size());
+    for (auto id : range(ParticleId{names.size()}))
+    {
+        // Add host metadata
+        bool inserted;
+        std::tie(std::ignore, inserted)
+            = name_to_id_.insert({names[id.get()], id});
+        CELER_ASSERT(inserted);
+        std::tie(std::ignore, inserted)
+            = pdg_to_id_.insert({pdg_codes[id.get()], id});
+        CELER_ASSERT(inserted);
+
+        md_.push_back({std::move(names[id.get()]), pdg_codes[id.get()]});
+    }
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
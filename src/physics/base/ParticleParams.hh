@@ -69,6 +69,11 @@ class ParticleParams
     // Construct with a vector of particle definitions
     explicit ParticleParams(const Input& defs);
 
+    // Construct from data and metadata built elsewhere
+    ParticleParams(CollectionMirror<ParticleParamsData> data,
+                   std::vector<std::string>             names,
+                   std::vector<PDGNumber>               pdg_codes);
+
     //// HOST ACCESSORS ////
 
     //! Number of particle definitions
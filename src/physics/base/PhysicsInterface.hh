@@ -159,6 +159,20 @@ struct HardwiredModels
         eplusgg_params        = other.eplusgg_params;
         return *this;
     }
+
+    //! Visit each collection and nested group
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("livermore_pe_data", livermore_pe_data);
+    }
+
+    //! Visit each collection and nested group for modification
+    template<class F>
+    void visit_members(F&& visit)
+    {
+        visit("livermore_pe_data", livermore_pe_data);
+    }
 };
 
 //---------------------------------------------------------------------------//
@@ -246,6 +260,38 @@ struct PhysicsParamsData
 
         return *this;
     }
+
+    //! Visit each collection and nested group
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("reals", reals);
+        visit("model_ids", model_ids);
+        visit("value_grids", value_grids);
+        visit("value_grid_ids", value_grid_ids);
+        visit("process_ids", process_ids);
+        visit("value_tables", value_tables);
+        visit("energy_loss", energy_loss);
+        visit("model_groups", model_groups);
+        visit("process_groups", process_groups);
+        visit("hardwired", hardwired);
+    }
+
+    //! Visit each collection and nested group for modification
+    template<class F>
+    void visit_members(F&& visit)
+    {
+        visit("reals", reals);
+        visit("model_ids", model_ids);
+        visit("value_grids", value_grids);
+        visit("value_grid_ids", value_grid_ids);
+        visit("process_ids", process_ids);
+        visit("value_tables", value_tables);
+        visit("energy_loss", energy_loss);
+        visit("model_groups", model_groups);
+        visit("process_groups", process_groups);
+        visit("hardwired", hardwired);
+    }
 };
 
 //---------------------------------------------------------------------------//
@@ -320,6 +366,14 @@ struct PhysicsStateData
         per_process_xs = other.per_process_xs;
         return *this;
     }
+
+    //! Visit each collection and nested group
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("state", state);
+        visit("per_process_xs", per_process_xs);
+    }
 };
 
 //---------------------------------------------------------------------------//
@@ -14,6 +14,7 @@
 #include "base/Range.hh"
 #include "base/VectorUtils.hh"
 #include "comm/Logger.hh"
+#include "comm/Tracer.hh"
 #include "ParticleParams.hh"
 #include "physics/em/EPlusGGModel.hh"
 #include "physics/em/LivermorePEModel.hh"
@@ -59,6 +60,31 @@ PhysicsParams::PhysicsParams(Input inp) : processes_(std::move(inp.processes))
     data_ = CollectionMirror<PhysicsParamsData>{std::move(host_data)};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct models and adopt tables built elsewhere.
+ *
+ * The data must have been built, e.g. on another process, from the same
+ * processes in the same order, so that the model IDs refer to the models
+ * constructed here. The options are unused.
+ */
+PhysicsParams::PhysicsParams(Input                               inp,
+                             CollectionMirror<PhysicsParamsData> data)
+    : processes_(std::move(inp.processes)), data_(std::move(data))
+{
+    CELER_EXPECT(!processes_.empty());
+    CELER_EXPECT(std::all_of(processes_.begin(),
+                             processes_.end(),
+                             [](const SPConstProcess& p) { return bool(p); }));
+    CELER_EXPECT(inp.particles);
+    CELER_EXPECT(data_);
+    CELER_EXPECT(this->host_pointers().process_groups.size()
+                 == inp.particles->size());
+
+    // Emit models for associated proceses
+    models_ = this->build_models();
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get the list of process IDs that apply to a particle type.
@@ -269,6 +295,7 @@ void PhysicsParams::build_xs(const Options&        opts,
                              HostValue*            data) const
 {
     CELER_EXPECT(*data);
+    ScopedTrace trace_scope("PhysicsParams::build_xs");
 
     using UPGridBuilder = Process::UPConstGridBuilder;
 
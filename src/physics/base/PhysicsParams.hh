@@ -91,6 +91,9 @@ class PhysicsParams
     // Construct with processes and helper classes
     explicit PhysicsParams(Input);
 
+    // Construct models and adopt tables built elsewhere
+    PhysicsParams(Input, CollectionMirror<PhysicsParamsData> data);
+
     //// HOST ACCESSORS ////
 
     //! Number of models
@@ -23,6 +23,10 @@ namespace celeritas
  * The EADL radiative and non-radiative transition data is used to simulate the
  * emission of fluorescence photons and (optionally) Auger electrons given an
  * initial shell vacancy created by a primary process.
+ *
+ * If the cascade outcomes are precomputed, the full set of secondaries is
+ * sampled from the initial subshell's outcome table with a single draw, and
+ * no vacancy stack is used.
  */
 class AtomicRelaxation
 {
@@ -76,6 +80,10 @@ class AtomicRelaxation
     template<class Engine>
     inline CELER_FUNCTION TransitionId
     sample_transition(const AtomicRelaxSubshell& shell, Engine& rng);
+
+    template<class Engine>
+    inline CELER_FUNCTION result_type
+    sample_outcome(const AtomicRelaxSubshell& shell, Engine& rng);
 };
 
 //---------------------------------------------------------------------------//
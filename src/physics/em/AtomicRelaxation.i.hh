@@ -7,6 +7,7 @@
 //---------------------------------------------------------------------------//
 
 #include "base/MiniStack.hh"
+#include "random/distributions/AliasDistribution.hh"
 
 namespace celeritas
 {
@@ -51,6 +52,14 @@ template<class Engine>
 CELER_FUNCTION AtomicRelaxation::result_type
 AtomicRelaxation::operator()(Engine& rng)
 {
+    const AtomicRelaxElement& el = shared_.elements[el_id_.get()];
+    if (shell_id_ < el.shells.size()
+        && !el.shells[shell_id_.get()].outcomes.empty())
+    {
+        // Sample the entire cascade from the precomputed outcomes
+        return this->sample_outcome(el.shells[shell_id_.get()], rng);
+    }
+
     MiniStack<SubshellId> vacancies(vacancies_);
 
     // The sampled shell ID might be outside the available data, in which case
@@ -74,8 +83,7 @@ AtomicRelaxation::operator()(Engine& rng)
         if (!vacancy_id)
             continue;
 
-        // Sample a transition (TODO: refactor to use Selector but with
-        // "remainder")
+        // Sample a transition
         const AtomicRelaxSubshell& shell
             = shared_.elements[el_id_.get()].shells[vacancy_id.get()];
         const TransitionId trans_id = this->sample_transition(shell, rng);
@@ -124,25 +132,59 @@ AtomicRelaxation::operator()(Engine& rng)
 /*!
  * Sample an atomic transition.
  *
- * TODO: refactor to use a Selector-like algorithm that allows a "remainder"
- * that indicates "not sampled".
+ * The last bin of the alias table is the "remainder" that indicates no
+ * transition was sampled.
  */
 template<class Engine>
 inline CELER_FUNCTION auto
 AtomicRelaxation::sample_transition(const AtomicRelaxSubshell& shell,
                                     Engine& rng) -> TransitionId
 {
-    real_type accum = -generate_canonical(rng);
-    for (size_type i = 0; i < shell.transitions.size(); ++i)
-    {
-        accum += shell.transitions[i].probability;
-        if (accum > 0)
-            return TransitionId{i};
-    }
+    CELER_ASSERT(shell.transition_alias.size()
+                 == shell.transitions.size() + 1);
+    AliasDistribution sample_bin(shell.transition_alias);
+    size_type         idx = sample_bin(rng);
+    if (idx < shell.transitions.size())
+        return TransitionId{idx};
 
     // No transition was sampled: skip to the next vacancy
     return {};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the secondaries from a precomputed cascade outcome.
+ *
+ * Products below the production thresholds of the current material are not
+ * created, but their energy is still accounted for in the outcome energy.
+ */
+template<class Engine>
+inline CELER_FUNCTION auto
+AtomicRelaxation::sample_outcome(const AtomicRelaxSubshell& shell,
+                                 Engine& rng) -> result_type
+{
+    CELER_ASSERT(shell.outcome_alias.size() == shell.outcomes.size());
+    AliasDistribution         sample_bin(shell.outcome_alias);
+    const AtomicRelaxOutcome& outcome = shell.outcomes[sample_bin(rng)];
+
+    result_type result;
+    result.energy = outcome.energy;
+    for (const AtomicRelaxProduct& product : outcome.products)
+    {
+        const real_type cutoff = (product.particle == shared_.electron_id)
+                                     ? electron_cutoff_
+                                     : gamma_cutoff_;
+        if (product.energy < cutoff)
+            continue;
+
+        CELER_ASSERT(result.count < secondaries_.size());
+        Secondary& secondary  = secondaries_[result.count++];
+        secondary.direction   = sample_direction_(rng);
+        secondary.energy      = MevEnergy{product.energy};
+        secondary.particle_id = product.particle;
+    }
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
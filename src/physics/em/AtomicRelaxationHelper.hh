@@ -29,7 +29,8 @@ namespace celeritas
     AtomicRelaxationHelper relax_helper(shared, el_id, allocate, 1);
     Span<Secondary>  secondaries = relax_helper.allocate_secondaries();
     Span<SubshellId> vacancies   = relax_helper.allocate_vacancies();
-    if (secondaries.empty() || (secondaries.size() > 1 && vacancies.empty()))
+    if (secondaries.empty()
+        || (relax_helper.max_vacancies() > 0 && vacancies.empty()))
     {
         return Interaction::from_failure();
     }
@@ -12,6 +12,7 @@
 #include "base/Types.hh"
 #include "physics/base/Types.hh"
 #include "physics/base/Units.hh"
+#include "random/distributions/AliasTableInterface.hh"
 
 namespace celeritas
 {
@@ -28,13 +29,49 @@ struct AtomicRelaxTransition
     real_type  energy;
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Secondary particle emitted in a precomputed relaxation cascade.
+ */
+struct AtomicRelaxProduct
+{
+    ParticleId particle;
+    real_type  energy;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * A possible outcome of the full relaxation cascade for an initial vacancy.
+ *
+ * The products are the particles emitted with energies above the lowest
+ * production thresholds of the element over all materials; the thresholds of
+ * the current material are applied when sampling. The energy is the average
+ * total transition energy of the cascades that lead to this set of products.
+ */
+struct AtomicRelaxOutcome
+{
+    Span<const AtomicRelaxProduct> products;
+    real_type                      energy;
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Electron subshell data.
+ *
+ * The alias table has one more entry than the number of transitions: the
+ * final bin is the probability that no transition occurs (e.g. non-radiative
+ * transitions when Auger production is disabled).
+ *
+ * If the cascade outcomes are precomputed, the outcomes for an initial
+ * vacancy in this subshell are sampled from the outcome alias table instead
+ * of following the individual transitions.
  */
 struct AtomicRelaxSubshell
 {
     Span<const AtomicRelaxTransition> transitions;
+    Span<const AliasTableEntry>       transition_alias;
+    Span<const AtomicRelaxOutcome>    outcomes;
+    Span<const AliasTableEntry>       outcome_alias;
 };
 
 //---------------------------------------------------------------------------//
@@ -46,7 +83,7 @@ struct AtomicRelaxElement
     Span<const AtomicRelaxSubshell> shells;
 
     size_type max_secondary;  //!< Maximum number of secondaries possible
-    size_type max_stack_size; //!< Maximum size of the subshell vacancy stack
+    size_type max_stack_size; //!< Max vacancy stack size (0 if precomputed)
 
     //! Check whether the element is assigned (false for Z < 6).
     explicit inline CELER_FUNCTION operator bool() const
@@ -29,6 +29,7 @@ namespace celeritas
  */
 AtomicRelaxationParams::AtomicRelaxationParams(const Input& inp)
     : is_auger_enabled_(inp.is_auger_enabled)
+    , precompute_cascade_(inp.precompute_cascade)
     , electron_id_(inp.particles->find(pdg::electron()))
     , gamma_id_(inp.particles->find(pdg::gamma()))
 {
@@ -58,6 +59,7 @@ AtomicRelaxationParams::AtomicRelaxationParams(const Input& inp)
     host_elements_.reserve(inp.elements.size());
     host_shells_.reserve(ss_size);
     host_transitions_.reserve(tr_size);
+    host_shell_alias_.reserve(ss_size);
 
     // Find the minimum electron and photon cutoff energy for each element over
     // all materials. This is used to calculate the maximum number of
@@ -82,10 +84,42 @@ AtomicRelaxationParams::AtomicRelaxationParams(const Input& inp)
     }
 
     // Build elements
+    AliasTableBuilder build_alias(&host_alias_);
     for (auto el_idx : range(num_elements))
     {
-        this->append_element(
-            inp.elements[el_idx], min_ecut[el_idx], min_gcut[el_idx]);
+        this->append_element(inp.elements[el_idx],
+                             min_ecut[el_idx],
+                             min_gcut[el_idx],
+                             &build_alias);
+    }
+
+    // Point shells to their alias tables and outcomes now that storage is
+    // finalized
+    CELER_ASSERT(host_shell_alias_.size() == host_shells_.size());
+    for (auto i : range(host_shells_.size()))
+    {
+        host_shells_[i].transition_alias = host_alias_[host_shell_alias_[i]];
+    }
+    if (precompute_cascade_)
+    {
+        CELER_ASSERT(host_outcome_products_.size() == host_outcomes_.size());
+        for (auto i : range(host_outcomes_.size()))
+        {
+            const IndexSpan& products = host_outcome_products_[i];
+            host_outcomes_[i].products
+                = {host_products_.data() + products.first, products.second};
+        }
+
+        CELER_ASSERT(host_shell_outcomes_.size() == host_shells_.size());
+        CELER_ASSERT(host_outcome_alias_.size() == host_shells_.size());
+        for (auto i : range(host_shells_.size()))
+        {
+            const IndexSpan& outcomes = host_shell_outcomes_[i];
+            host_shells_[i].outcomes
+                = {host_outcomes_.data() + outcomes.first, outcomes.second};
+            host_shells_[i].outcome_alias
+                = host_alias_[host_outcome_alias_[i]];
+        }
     }
 
     if (celeritas::device())
@@ -96,15 +130,38 @@ AtomicRelaxationParams::AtomicRelaxationParams(const Input& inp)
         device_shells_ = DeviceVector<AtomicRelaxSubshell>(host_shells_.size());
         device_transitions_
             = DeviceVector<AtomicRelaxTransition>(host_transitions_.size());
+        device_outcomes_
+            = DeviceVector<AtomicRelaxOutcome>(host_outcomes_.size());
+        device_products_
+            = DeviceVector<AtomicRelaxProduct>(host_products_.size());
+        device_alias_ = host_alias_;
+
+        // Remap outcome->product spans
+        auto remap_products = make_span_remapper(
+            make_span(host_products_), device_products_.device_pointers());
+        std::vector<AtomicRelaxOutcome> temp_device_outcomes = host_outcomes_;
+        for (AtomicRelaxOutcome& outcome : temp_device_outcomes)
+        {
+            outcome.products = remap_products(outcome.products);
+        }
 
-        // Remap shell->transition spans
+        // Remap shell->transition and shell->outcome spans
         auto remap_transitions
             = make_span_remapper(make_span(host_transitions_),
                                  device_transitions_.device_pointers());
+        auto remap_outcomes = make_span_remapper(
+            make_span(host_outcomes_), device_outcomes_.device_pointers());
         std::vector<AtomicRelaxSubshell> temp_device_shells = host_shells_;
-        for (AtomicRelaxSubshell& ss : temp_device_shells)
+        for (auto i : range(temp_device_shells.size()))
         {
-            ss.transitions = remap_transitions(ss.transitions);
+            AtomicRelaxSubshell& ss = temp_device_shells[i];
+            ss.transitions          = remap_transitions(ss.transitions);
+            ss.transition_alias     = device_alias_[host_shell_alias_[i]];
+            ss.outcomes             = remap_outcomes(ss.outcomes);
+            if (precompute_cascade_)
+            {
+                ss.outcome_alias = device_alias_[host_outcome_alias_[i]];
+            }
         }
 
         // Remap element->shell spans
@@ -120,6 +177,8 @@ AtomicRelaxationParams::AtomicRelaxationParams(const Input& inp)
         device_elements_.copy_to_device(make_span(temp_device_elements));
         device_shells_.copy_to_device(make_span(temp_device_shells));
         device_transitions_.copy_to_device(make_span(host_transitions_));
+        device_outcomes_.copy_to_device(make_span(temp_device_outcomes));
+        device_products_.copy_to_device(make_span(host_products_));
     }
 
     CELER_ENSURE(host_elements_.size() == inp.elements.size());
@@ -165,23 +224,36 @@ AtomicRelaxParamsPointers AtomicRelaxationParams::device_pointers() const
  */
 void AtomicRelaxationParams::append_element(const ImportAtomicRelaxation& inp,
                                             MevEnergy electron_cutoff,
-                                            MevEnergy gamma_cutoff)
+                                            MevEnergy gamma_cutoff,
+                                            AliasTableBuilder* build_alias)
 {
     AtomicRelaxElement result;
 
     // Copy subshell transition data
-    result.shells = this->extend_shells(inp);
-
-    // Calculate the maximum possible number of secondaries that could be
-    // created in atomic relaxation.
-    result.max_secondary
-        = detail::calc_max_secondaries(result, electron_cutoff, gamma_cutoff);
+    result.shells = this->extend_shells(inp, build_alias);
 
-    // Maximum size of the stack used to store unprocessed vacancy subshell
-    // IDs. For radiative transitions, there is only ever one vacancy waiting
-    // to be processed. For non-radiative transitions, the upper bound on the
-    // stack size is the number of shells that have transition data.
-    result.max_stack_size = is_auger_enabled_ ? result.shells.size() : 1;
+    if (precompute_cascade_)
+    {
+        // Tabulate the cascade outcomes: the maximum number of secondaries is
+        // the largest outcome, and no vacancy stack is needed
+        result.max_secondary = this->extend_outcomes(
+            result, electron_cutoff, gamma_cutoff, build_alias);
+        result.max_stack_size = 0;
+    }
+    else
+    {
+        // Calculate the maximum possible number of secondaries that could be
+        // created in atomic relaxation.
+        result.max_secondary = detail::calc_max_secondaries(
+            result, electron_cutoff, gamma_cutoff);
+
+        // Maximum size of the stack used to store unprocessed vacancy subshell
+        // IDs. For radiative transitions, there is only ever one vacancy
+        // waiting to be processed. For non-radiative transitions, the upper
+        // bound on the stack size is the number of shells that have
+        // transition data.
+        result.max_stack_size = is_auger_enabled_ ? result.shells.size() : 1;
+    }
 
     // Add to host vector
     host_elements_.push_back(result);
@@ -192,7 +264,8 @@ void AtomicRelaxationParams::append_element(const ImportAtomicRelaxation& inp,
  * Process and store electron subshells to the internal list.
  */
 Span<AtomicRelaxSubshell>
-AtomicRelaxationParams::extend_shells(const ImportAtomicRelaxation& inp)
+AtomicRelaxationParams::extend_shells(const ImportAtomicRelaxation& inp,
+                                      AliasTableBuilder* build_alias)
 {
     CELER_EXPECT(host_shells_.size() + inp.shells.size()
                  <= host_shells_.capacity());
@@ -211,6 +284,8 @@ AtomicRelaxationParams::extend_shells(const ImportAtomicRelaxation& inp)
     }
     CELER_ASSERT(des_to_id_.size() == inp.shells.size());
 
+    std::vector<real_type> weights;
+
     for (auto i : range(inp.shells.size()))
     {
         // Check that for a given subshell vacancy EADL transition
@@ -236,6 +311,17 @@ AtomicRelaxationParams::extend_shells(const ImportAtomicRelaxation& inp)
         {
             result[i].transitions = fluor;
         }
+
+        // Build the sampling table, with the final bin for "no transition"
+        weights.clear();
+        real_type remainder = 1;
+        for (const auto& transition : result[i].transitions)
+        {
+            weights.push_back(transition.probability);
+            remainder -= transition.probability;
+        }
+        weights.push_back(max<real_type>(remainder, 0));
+        host_shell_alias_.push_back((*build_alias)(make_span(weights)));
     }
 
     return result;
@@ -269,5 +355,50 @@ Span<AtomicRelaxTransition> AtomicRelaxationParams::extend_transitions(
     return {host_transitions_.data() + start, transitions.size()};
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulate and store the relaxation cascade outcomes for each subshell.
+ *
+ * Secondaries are considered only if they're above the lowest production
+ * threshold of the element over all materials. The return value is the
+ * largest number of secondaries in any outcome.
+ */
+size_type
+AtomicRelaxationParams::extend_outcomes(const AtomicRelaxElement& el,
+                                        MevEnergy          electron_cutoff,
+                                        MevEnergy          gamma_cutoff,
+                                        AliasTableBuilder* build_alias)
+{
+    detail::RelaxationOutcomeCalculator calc_outcomes(
+        el, electron_id_, gamma_id_, electron_cutoff, gamma_cutoff);
+
+    size_type              result = 0;
+    std::vector<real_type> weights;
+    for (auto shell_id : range(SubshellId(el.shells.size())))
+    {
+        auto outcomes = calc_outcomes(shell_id);
+
+        weights.clear();
+        host_shell_outcomes_.push_back({host_outcomes_.size(), outcomes.size()});
+        for (const auto& outcome : outcomes)
+        {
+            host_outcome_products_.push_back(
+                {host_products_.size(), outcome.products.size()});
+            host_products_.insert(host_products_.end(),
+                                  outcome.products.begin(),
+                                  outcome.products.end());
+
+            AtomicRelaxOutcome stored;
+            stored.energy = outcome.energy;
+            host_outcomes_.push_back(stored);
+
+            weights.push_back(outcome.probability);
+            result = max<size_type>(result, outcome.products.size());
+        }
+        host_outcome_alias_.push_back((*build_alias)(make_span(weights)));
+    }
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -8,11 +8,14 @@
 #pragma once
 
 #include <unordered_map>
+#include <utility>
 #include <vector>
 #include "base/Algorithms.hh"
+#include "base/Collection.hh"
 #include "base/DeviceVector.hh"
 #include "io/ImportAtomicRelaxation.hh"
 #include "physics/base/CutoffParams.hh"
+#include "random/distributions/AliasTableBuilder.hh"
 #include "AtomicRelaxationInterface.hh"
 
 namespace celeritas
@@ -38,6 +41,7 @@ class AtomicRelaxationParams
         SPConstMaterials materials;
         SPConstParticles particles;
         bool is_auger_enabled{false}; //!< Whether to produce Auger electrons
+        bool precompute_cascade{false}; //!< Tabulate cascade outcomes
         std::vector<ImportAtomicRelaxation> elements;
     };
 
@@ -51,10 +55,21 @@ class AtomicRelaxationParams
     // Access EADL data on the device
     AtomicRelaxParamsPointers device_pointers() const;
 
+    //! Whether cascade outcomes are sampled from precomputed tables
+    bool precompute_cascade() const { return precompute_cascade_; }
+
   private:
+    using HostAliasCollection = AliasTableBuilder::EntryCollection;
+    using DeviceAliasCollection
+        = Collection<AliasTableEntry, Ownership::value, MemSpace::device>;
+
+    //! Start index and size of a subspan
+    using IndexSpan = std::pair<size_type, size_type>;
+
     //// HOST DATA ////
 
     bool                                is_auger_enabled_;
+    bool                                precompute_cascade_;
     ParticleId                          electron_id_;
     ParticleId                          gamma_id_;
     std::unordered_map<int, SubshellId> des_to_id_;
@@ -62,21 +77,38 @@ class AtomicRelaxationParams
     std::vector<AtomicRelaxElement>    host_elements_;
     std::vector<AtomicRelaxSubshell>   host_shells_;
     std::vector<AtomicRelaxTransition> host_transitions_;
+    std::vector<AliasTableData>        host_shell_alias_;
+    std::vector<AtomicRelaxOutcome>    host_outcomes_;
+    std::vector<AtomicRelaxProduct>    host_products_;
+    std::vector<IndexSpan>             host_outcome_products_;
+    std::vector<IndexSpan>             host_shell_outcomes_;
+    std::vector<AliasTableData>        host_outcome_alias_;
+    HostAliasCollection                host_alias_;
 
     //// DEVICE DATA ////
 
     DeviceVector<AtomicRelaxElement>    device_elements_;
     DeviceVector<AtomicRelaxSubshell>   device_shells_;
     DeviceVector<AtomicRelaxTransition> device_transitions_;
+    DeviceVector<AtomicRelaxOutcome>    device_outcomes_;
+    DeviceVector<AtomicRelaxProduct>    device_products_;
+    DeviceAliasCollection               device_alias_;
 
     // HELPER FUNCTIONS
     void append_element(const ImportAtomicRelaxation& inp,
                         MevEnergy                     electron_cutoff,
-                        MevEnergy                     gamma_cutoff);
+                        MevEnergy                     gamma_cutoff,
+                        AliasTableBuilder*            build_alias);
 
-    Span<AtomicRelaxSubshell> extend_shells(const ImportAtomicRelaxation& inp);
+    Span<AtomicRelaxSubshell> extend_shells(const ImportAtomicRelaxation& inp,
+                                            AliasTableBuilder* build_alias);
     Span<AtomicRelaxTransition>
     extend_transitions(const std::vector<ImportAtomicTransition>& transitions);
+
+    size_type extend_outcomes(const AtomicRelaxElement& el,
+                              MevEnergy                 electron_cutoff,
+                              MevEnergy                 gamma_cutoff,
+                              AliasTableBuilder*        build_alias);
 };
 
 //---------------------------------------------------------------------------//
@@ -7,10 +7,14 @@
 //---------------------------------------------------------------------------//
 #include "LivermorePEModel.hh"
 
+#include <cmath>
+#include <utility>
 #include "base/Assert.hh"
 #include "base/CollectionBuilder.hh"
 #include "comm/Device.hh"
 #include "physics/base/PDGNumber.hh"
+#include "physics/material/ElementTableBuilder.hh"
+#include "detail/LivermorePEMicroXsCalculator.hh"
 
 namespace celeritas
 {
@@ -24,6 +28,27 @@ LivermorePEModel::LivermorePEModel(ModelId               id,
                                    ReadData              load_data,
                                    SPConstAtomicRelax    atomic_relaxation,
                                    size_type             num_vacancies)
+    : LivermorePEModel(id,
+                       particles,
+                       materials,
+                       std::move(load_data),
+                       std::move(atomic_relaxation),
+                       num_vacancies,
+                       Options{})
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with configuration options.
+ */
+LivermorePEModel::LivermorePEModel(ModelId               id,
+                                   const ParticleParams& particles,
+                                   const MaterialParams& materials,
+                                   ReadData              load_data,
+                                   SPConstAtomicRelax    atomic_relaxation,
+                                   size_type             num_vacancies,
+                                   const Options&        options)
 {
     CELER_EXPECT(id);
     CELER_EXPECT(load_data);
@@ -52,12 +77,44 @@ LivermorePEModel::LivermorePEModel(ModelId               id,
     }
     CELER_ASSERT(host_data.xs.elements.size() == materials.num_elements());
 
+    if (options.tabulate_elements)
+    {
+        // Tabulate element selection probabilities for each material on a
+        // grid from 1 eV to 100 GeV with 16 points per decade, plus points
+        // around each subshell binding energy
+        detail::LivermorePEXsData<Ownership::const_reference, MemSpace::host>
+            host_xs;
+        host_xs = host_data.xs;
+
+        ElementTableBuilder::VecEnergy edges;
+        for (const detail::LivermoreSubshell& shell :
+             host_xs.shells[AllItems<detail::LivermoreSubshell>{}])
+        {
+            edges.push_back(shell.binding_energy);
+        }
+
+        ElementTableBuilder build_tables(
+            materials,
+            UniformGridData::from_bounds(std::log(1e-6), std::log(1e5), 177),
+            edges);
+        host_data.element_tables
+            = build_tables([&host_xs](ElementId el_id, MevEnergy energy) {
+                  return detail::LivermorePEMicroXsCalculator(host_xs,
+                                                              energy)(el_id);
+              });
+    }
+
     // Add atomic relaxation data
     if (atomic_relaxation)
     {
-        CELER_ASSERT(num_vacancies > 0);
-        resize(&relax_scratch_.vacancies, num_vacancies);
-        relax_scratch_ref_          = relax_scratch_;
+        if (!atomic_relaxation->precompute_cascade())
+        {
+            // Storage for the vacancy stack is only needed when following
+            // the individual transitions
+            CELER_ASSERT(num_vacancies > 0);
+            resize(&relax_scratch_.vacancies, num_vacancies);
+            relax_scratch_ref_ = relax_scratch_;
+        }
         host_data.atomic_relaxation = atomic_relaxation->device_pointers();
     }
 
@@ -40,6 +40,14 @@ class LivermorePEModel final : public Model
     using DeviceRef          = detail::LivermorePEDeviceRef;
     //!@}
 
+    //! Model configuration options
+    struct Options
+    {
+        //! Sample elements from precomputed tables instead of evaluating
+        //! cross sections for every element in the material
+        bool tabulate_elements = false;
+    };
+
   public:
     // Construct from model ID and other necessary data
     LivermorePEModel(ModelId               id,
@@ -49,6 +57,15 @@ class LivermorePEModel final : public Model
                      SPConstAtomicRelax    atomic_relaxation = nullptr,
                      size_type             num_vacancies     = 0);
 
+    // Construct with configuration options
+    LivermorePEModel(ModelId               id,
+                     const ParticleParams& particles,
+                     const MaterialParams& materials,
+                     ReadData              load_data,
+                     SPConstAtomicRelax    atomic_relaxation,
+                     size_type             num_vacancies,
+                     const Options&        options);
+
     // Particle types and energy ranges that this model applies to
     SetApplicability applicability() const final;
 
@@ -7,11 +7,17 @@
 //---------------------------------------------------------------------------//
 #include "RayleighModel.hh"
 
+#include <cmath>
+#include <vector>
+#include "base/Algorithms.hh"
 #include "base/Assert.hh"
 #include "base/Range.hh"
 #include "base/CollectionBuilder.hh"
+#include "base/Constants.hh"
 #include "physics/base/PDGNumber.hh"
 #include "physics/base/ParticleParams.hh"
+#include "physics/base/Units.hh"
+#include "physics/grid/UniformGrid.hh"
 
 namespace celeritas
 {
@@ -22,6 +28,18 @@ namespace celeritas
 RayleighModel::RayleighModel(ModelId               id,
                              const ParticleParams& particles,
                              const MaterialParams& materials)
+    : RayleighModel(id, particles, materials, Options{})
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with configuration options.
+ */
+RayleighModel::RayleighModel(ModelId               id,
+                             const ParticleParams& particles,
+                             const MaterialParams& materials,
+                             const Options&        options)
 {
     CELER_EXPECT(id);
 
@@ -34,6 +52,10 @@ RayleighModel::RayleighModel(ModelId               id,
                    << ")");
 
     this->build_data(&host_group, materials);
+    if (options.tabulate_angular)
+    {
+        this->build_tables(&host_group);
+    }
 
     // Move to mirrored data, copying to device
     group_ = CollectionMirror<detail::RayleighGroup>{std::move(host_group)};
@@ -111,5 +133,118 @@ void RayleighModel::build_data(HostValue*            group,
     }
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulate the angular distribution of each element.
+ *
+ * The differential cross section at each energy is integrated with Simpson's
+ * rule between successive nodes. The nodes are spaced so that the form factor
+ * term changes by a constant ratio across each interval: this keeps the
+ * piecewise-uniform interpolation used for sampling accurate when the
+ * distribution is sharply forward-peaked.
+ */
+void RayleighModel::build_tables(HostValue* group) const
+{
+    CELER_EXPECT(group && !group->params.empty());
+
+    // Energy grid spanning the applicability of the model, 10 per decade
+    constexpr real_type min_energy    = 1e-5;
+    constexpr real_type max_energy    = 1e8;
+    constexpr size_type num_energies  = 131;
+    constexpr size_type num_intervals = 128;
+    constexpr size_type num_subpanels = 4;
+
+    // Convert photon energy [MeV] to inverse wavelength [1/cm]
+    const real_type inv_hc = units::centimeter
+                             * unit_cast(units::MevEnergy{1.0})
+                             / (constants::c_light * constants::h_planck);
+
+    auto& tables      = group->tables;
+    tables.log_energy = UniformGridData::from_bounds(
+        std::log(min_energy), std::log(max_energy), num_energies);
+    tables.num_nodes = num_intervals + 1;
+
+    const UniformGrid loge_grid(tables.log_energy);
+    auto              reals    = make_builder(&tables.reals);
+    auto              elements = make_builder(&tables.elements);
+    elements.reserve(group->params.size());
+    reals.reserve(2 * group->params.size() * num_energies * tables.num_nodes);
+
+    std::vector<real_type> xi;
+    std::vector<real_type> cdf;
+    xi.reserve(num_energies * tables.num_nodes);
+    cdf.reserve(num_energies * tables.num_nodes);
+    for (auto el_id : range(ElementId{group->params.size()}))
+    {
+        const detail::RayleighParameters& p = group->params[el_id];
+        const real_type                   max_b
+            = celeritas::max(p.b[0], celeritas::max(p.b[1], p.b[2]));
+
+        xi.clear();
+        cdf.clear();
+        for (auto i : range(num_energies))
+        {
+            // Argument of the form factor is b * factor * xi
+            const real_type factor
+                = ipow<2>(inv_hc * std::exp(loge_grid[i]));
+            auto calc_dxs = [&p, factor](real_type x) {
+                const real_type cost   = 1 - 2 * x;
+                real_type       result = 0;
+                for (auto j : range(3))
+                {
+                    result += p.a[j]
+                              * std::pow(1 + p.b[j] * factor * x,
+                                         -(p.n[j] + 1));
+                }
+                return (1 + cost * cost) * result;
+            };
+
+            // Nodes are geometric in 1 + c * xi
+            const real_type c       = max_b * factor;
+            const real_type log_max = std::log1p(c);
+            const size_type start   = cdf.size();
+            xi.push_back(0);
+            cdf.push_back(0);
+            for (auto k : range(size_type(1), tables.num_nodes))
+            {
+                const real_type lower = xi.back();
+                real_type upper = real_type(k) / num_intervals;
+                if (k < num_intervals && c > 0)
+                {
+                    upper = std::expm1(log_max * upper) / c;
+                }
+
+                // Integrate over the interval using composite Simpson's rule
+                const real_type h        = (upper - lower) / num_subpanels;
+                real_type       integral = 0;
+                for (auto s : range(num_subpanels))
+                {
+                    const real_type x = lower + s * h;
+                    integral += calc_dxs(x) + 4 * calc_dxs(x + h / 2)
+                                + calc_dxs(x + h);
+                }
+                xi.push_back(upper);
+                cdf.push_back(cdf.back() + integral * h / 6);
+            }
+            CELER_ASSERT(cdf.back() > 0);
+
+            // Normalize
+            const real_type norm = 1 / cdf.back();
+            for (auto k : range(start, size_type(cdf.size())))
+            {
+                cdf[k] *= norm;
+            }
+            cdf.back() = 1;
+        }
+
+        detail::RayleighElementTable table;
+        table.xi  = reals.insert_back(xi.begin(), xi.end());
+        table.cdf = reals.insert_back(cdf.begin(), cdf.end());
+        elements.push_back(table);
+    }
+
+    CELER_ENSURE(tables);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -31,12 +31,25 @@ class RayleighModel final : public Model
         = detail::RayleighGroup<Ownership::const_reference, MemSpace::device>;
     //@}
 
+    //! Model configuration options
+    struct Options
+    {
+        //! Precompute angular distributions to sample without rejection
+        bool tabulate_angular = false;
+    };
+
   public:
     // Construct from model ID and other necessary data
     RayleighModel(ModelId               id,
                   const ParticleParams& particles,
                   const MaterialParams& materials);
 
+    // Construct with configuration options
+    RayleighModel(ModelId               id,
+                  const ParticleParams& particles,
+                  const MaterialParams& materials,
+                  const Options&        options);
+
     // Particle types and energy ranges that this model applies to
     SetApplicability applicability() const final;
 
@@ -62,6 +75,7 @@ class RayleighModel final : public Model
   private:
     using HostValue = detail::RayleighGroup<Ownership::value, MemSpace::host>;
     void build_data(HostValue* group, const MaterialParams& materials);
+    void build_tables(HostValue* group) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -9,6 +9,7 @@
 
 #include "base/Assert.hh"
 #include "base/KernelParamCalculator.cuda.hh"
+#include "random/CountingRngEngine.hh"
 #include "random/RngEngine.hh"
 #include "physics/base/ModelInterface.hh"
 #include "physics/base/ParticleTrackView.hh"
@@ -68,7 +69,8 @@ bethe_heitler_interact_kernel(const BetheHeitlerPointers                bh,
         material_view.element_view(celeritas::ElementComponentId{0}));
 
     RngEngine rng(model.states.rng, tid);
-    model.states.interactions[tid] = interact(rng);
+    model.states.interactions[tid] = sample_counted(
+        interact, rng, model.states.rng_counters, bh.model_id.get());
     CELER_ENSURE(model.states.interactions[tid]);
 }
 
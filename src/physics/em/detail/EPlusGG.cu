@@ -9,6 +9,7 @@
 
 #include "base/Assert.hh"
 #include "base/KernelParamCalculator.cuda.hh"
+#include "random/CountingRngEngine.hh"
 #include "random/RngEngine.hh"
 #include "physics/base/ModelInterface.hh"
 #include "physics/base/ParticleTrackView.hh"
@@ -55,7 +56,8 @@ eplusgg_interact_kernel(const EPlusGGPointers                     epgg,
     EPlusGGInteractor interact(
         epgg, particle, model.states.direction[tid], allocate_secondaries);
     RngEngine rng(model.states.rng, tid);
-    model.states.interactions[tid] = interact(rng);
+    model.states.interactions[tid] = sample_counted(
+        interact, rng, model.states.rng_counters, epgg.model_id.get());
 
     CELER_ENSURE(model.states.interactions[tid]);
 }
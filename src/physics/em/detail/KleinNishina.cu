@@ -9,6 +9,7 @@
 
 #include "base/Assert.hh"
 #include "base/KernelParamCalculator.cuda.hh"
+#include "random/CountingRngEngine.hh"
 #include "random/RngEngine.hh"
 #include "physics/base/ModelInterface.hh"
 #include "physics/base/ParticleTrackView.hh"
@@ -54,7 +55,8 @@ klein_nishina_interact_kernel(const KleinNishinaPointers                kn,
         kn, particle, model.states.direction[tid], allocate_secondaries);
 
     RngEngine rng(model.states.rng, tid);
-    model.states.interactions[tid] = interact(rng);
+    model.states.interactions[tid] = sample_counted(
+        interact, rng, model.states.rng_counters, kn.model_id.get());
     CELER_ENSURE(model.states.interactions[tid]);
 }
 
@@ -0,0 +1,81 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file KleinNishinaBatchInteractor.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "physics/base/Secondary.hh"
+#include "KleinNishina.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Perform Compton scattering for many photons at once on the host.
+ *
+ * This samples the same distribution as \c KleinNishinaInteractor, but for a
+ * whole span of incident photons, so that the CPU's vector units can be used.
+ * Tracks are processed in fixed-size blocks whose intermediate values are
+ * stored as structures of arrays. For each pass over a block, random numbers
+ * are first drawn for all unaccepted tracks; the candidate energy and
+ * rejection test are then evaluated for every track in the block with
+ * branch-free arithmetic that the compiler can vectorize. Accepted tracks are
+ * masked out and the remaining ones are retried until the block is complete.
+ *
+ * \code
+    KleinNishinaBatchInteractor interact(shared, energies, directions);
+    interact(rng, {out_energies, out_directions, electrons});
+   \endcode
+ */
+class KleinNishinaBatchInteractor
+{
+  public:
+    //! Outgoing photon and electron properties, one per incident photon
+    struct Output
+    {
+        Span<real_type> energy;    //!< Scattered photon energy [MeV]
+        Span<Real3>     direction; //!< Scattered photon direction
+        Span<Secondary> electrons; //!< Emitted electron
+    };
+
+    //! Number of tracks sampled together
+    static constexpr size_type block_size() { return 64; }
+
+  public:
+    // Construct with shared data and incident photons
+    inline KleinNishinaBatchInteractor(const KleinNishinaPointers& shared,
+                                       Span<const real_type>       energy,
+                                       Span<const Real3>           direction);
+
+    //! Number of incident photons
+    size_type size() const { return inc_energy_.size(); }
+
+    // Sample all interactions with the given RNG
+    template<class Engine>
+    inline void operator()(Engine& rng, const Output& out) const;
+
+  private:
+    // Constant data
+    const KleinNishinaPointers& shared_;
+    // Incident gamma energies [MeV]
+    Span<const real_type> inc_energy_;
+    // Incident directions
+    Span<const Real3> inc_direction_;
+
+    template<class Engine>
+    inline void
+    sample_block(Engine& rng, size_type start, const Output& out) const;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
+
+#include "KleinNishinaBatchInteractor.i.hh"
@@ -0,0 +1,167 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file KleinNishinaBatchInteractor.i.hh
+//---------------------------------------------------------------------------//
+
+#include <cmath>
+#include "base/Algorithms.hh"
+#include "base/ArrayUtils.hh"
+#include "base/Assert.hh"
+#include "base/Constants.hh"
+#include "random/distributions/GenerateCanonical.hh"
+#include "random/distributions/UniformRealDistribution.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with shared data and incident photons.
+ *
+ * All photons must have positive energy.
+ */
+KleinNishinaBatchInteractor::KleinNishinaBatchInteractor(
+    const KleinNishinaPointers& shared,
+    Span<const real_type>       energy,
+    Span<const Real3>           direction)
+    : shared_(shared), inc_energy_(energy), inc_direction_(direction)
+{
+    CELER_EXPECT(shared_.inv_electron_mass > 0 && shared_.electron_id);
+    CELER_EXPECT(inc_energy_.size() == inc_direction_.size());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample all interactions with the given RNG.
+ */
+template<class Engine>
+void KleinNishinaBatchInteractor::operator()(Engine&       rng,
+                                             const Output& out) const
+{
+    CELER_EXPECT(out.energy.size() == this->size());
+    CELER_EXPECT(out.direction.size() == this->size());
+    CELER_EXPECT(out.electrons.size() == this->size());
+
+    for (size_type start = 0; start < this->size(); start += block_size())
+    {
+        this->sample_block(rng, start, out);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a block of interactions using masked retry.
+ *
+ * See \c KleinNishinaInteractor for the sampling method. Both branches of the
+ * \f$ \epsilon \f$ sampling are evaluated for every track and the result is
+ * selected, which trades a few redundant operations for vectorization.
+ */
+template<class Engine>
+void KleinNishinaBatchInteractor::sample_block(Engine&       rng,
+                                               size_type     start,
+                                               const Output& out) const
+{
+    constexpr size_type width = block_size();
+    const size_type     count = celeritas::min(width, this->size() - start);
+
+    // Per-track constants
+    real_type energy_per_mecsq[width];
+    real_type log_epsilon_0[width];
+    real_type epsilon_0_sq[width];
+    real_type prob_f1[width];
+    for (size_type i = 0; i < count; ++i)
+    {
+        CELER_ASSERT(inc_energy_[start + i] > 0);
+        energy_per_mecsq[i] = inc_energy_[start + i]
+                              * shared_.inv_electron_mass;
+        const real_type epsilon_0 = 1 / (1 + 2 * energy_per_mecsq[i]);
+        log_epsilon_0[i]          = std::log(epsilon_0);
+        epsilon_0_sq[i]           = epsilon_0 * epsilon_0;
+
+        // Relative weight of alpha_1 (f_1) to alpha_1 + alpha_2
+        const real_type alpha_1 = -log_epsilon_0[i];
+        const real_type alpha_2 = real_type(0.5) * (1 - epsilon_0_sq[i]);
+        prob_f1[i]              = alpha_1 / (alpha_1 + alpha_2);
+    }
+
+    // Sampled values and acceptance mask
+    real_type epsilon[width];
+    real_type one_minus_costheta[width];
+    bool      accepted[width] = {};
+
+    real_type xi_choose[width];
+    real_type xi_sample[width];
+    real_type xi_reject[width];
+
+    size_type num_remaining = count;
+    while (num_remaining > 0)
+    {
+        // Draw random numbers for tracks that haven't been accepted
+        for (size_type i = 0; i < count; ++i)
+        {
+            if (!accepted[i])
+            {
+                xi_choose[i] = generate_canonical(rng);
+                xi_sample[i] = generate_canonical(rng);
+                xi_reject[i] = generate_canonical(rng);
+            }
+        }
+
+        // Evaluate candidates for the whole block without branching
+        num_remaining = 0;
+        for (size_type i = 0; i < count; ++i)
+        {
+            // f_1(\eps) \propto 1/\eps on [\eps_0, 1]
+            const real_type eps_f1 = std::exp(xi_sample[i] * log_epsilon_0[i]);
+            // f_2(\eps^2) \propto 1 on [\eps_0^2, 1]
+            const real_type eps_sq_f2 = epsilon_0_sq[i]
+                                        + xi_sample[i] * (1 - epsilon_0_sq[i]);
+
+            const bool      use_f1 = xi_choose[i] < prob_f1[i];
+            const real_type eps    = use_f1 ? eps_f1 : std::sqrt(eps_sq_f2);
+            const real_type eps_sq = use_f1 ? eps_f1 * eps_f1 : eps_sq_f2;
+
+            const real_type omc = (1 - eps) / (eps * energy_per_mecsq[i]);
+            const real_type sintheta_sq = omc * (2 - omc);
+            const real_type reject_prob = eps * sintheta_sq / (1 + eps_sq);
+
+            const bool accept = !accepted[i] && !(xi_reject[i] < reject_prob);
+            epsilon[i]            = accept ? eps : epsilon[i];
+            one_minus_costheta[i] = accept ? omc : one_minus_costheta[i];
+            accepted[i]           = accepted[i] || accept;
+            num_remaining += accepted[i] ? 0 : 1;
+        }
+    }
+
+    // Construct outgoing photon and electron
+    UniformRealDistribution<real_type> sample_phi(0, 2 * constants::pi);
+    for (size_type i = 0; i < count; ++i)
+    {
+        const size_type track     = start + i;
+        const real_type inc_e     = inc_energy_[track];
+        const Real3&    inc_dir   = inc_direction_[track];
+        const real_type out_e     = epsilon[i] * inc_e;
+        const Real3     out_dir   = rotate(
+            from_spherical(1 - one_minus_costheta[i], sample_phi(rng)), inc_dir);
+        out.energy[track]    = out_e;
+        out.direction[track] = out_dir;
+
+        // Calculate exiting electron direction via conservation of momentum
+        Secondary& electron  = out.electrons[track];
+        electron.particle_id = shared_.electron_id;
+        electron.energy      = units::MevEnergy{inc_e - out_e};
+        for (int j = 0; j < 3; ++j)
+        {
+            electron.direction[j] = inc_dir[j] * inc_e - out_dir[j] * out_e;
+        }
+        normalize_direction(&electron.direction);
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
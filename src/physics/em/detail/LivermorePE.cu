@@ -8,6 +8,7 @@
 #include "LivermorePE.hh"
 
 #include "base/KernelParamCalculator.cuda.hh"
+#include "random/CountingRngEngine.hh"
 #include "random/RngEngine.hh"
 #include "physics/base/ModelInterface.hh"
 #include "physics/base/ParticleTrackView.hh"
@@ -15,6 +16,7 @@
 #include "base/StackAllocator.hh"
 #include "physics/material/ElementSelector.hh"
 #include "physics/material/MaterialTrackView.hh"
+#include "physics/material/TabulatedElementSelector.hh"
 #include "LivermorePEInteractor.hh"
 #include "LivermorePEMicroXsCalculator.hh"
 
@@ -58,12 +60,22 @@ livermore_pe_interact_kernel(const LivermorePEDeviceRef                pe,
     RngEngine rng(model.states.rng, tid);
 
     // Sample an element
-    ElementSelector select_el(
-        material.material_view(),
-        LivermorePEMicroXsCalculator{pe, particle.energy()},
-        material.element_scratch());
-    ElementComponentId comp_id = select_el(rng);
-    ElementId          el_id   = material.material_view().element_id(comp_id);
+    ElementComponentId comp_id;
+    if (pe.element_tables)
+    {
+        TabulatedElementSelector select_el(
+            pe.element_tables, material.material_id(), particle.energy());
+        comp_id = select_el(rng);
+    }
+    else
+    {
+        ElementSelector select_el(
+            material.material_view(),
+            LivermorePEMicroXsCalculator{pe, particle.energy()},
+            material.element_scratch());
+        comp_id = select_el(rng);
+    }
+    ElementId el_id = material.material_view().element_id(comp_id);
 
     LivermorePEInteractor interact(pe,
                                    scratch,
@@ -73,7 +85,8 @@ livermore_pe_interact_kernel(const LivermorePEDeviceRef                pe,
                                    model.states.direction[tid],
                                    allocate_secondaries);
 
-    model.states.interactions[tid] = interact(rng);
+    model.states.interactions[tid] = sample_counted(
+        interact, rng, model.states.rng_counters, pe.ids.model.get());
     CELER_ENSURE(model.states.interactions[tid]);
 }
 
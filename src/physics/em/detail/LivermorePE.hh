@@ -15,6 +15,7 @@
 #include "physics/base/Units.hh"
 #include "physics/em/AtomicRelaxationInterface.hh"
 #include "physics/grid/XsGridInterface.hh"
+#include "physics/material/ElementTableInterface.hh"
 #include "physics/material/Types.hh"
 
 namespace celeritas
@@ -128,6 +129,15 @@ struct LivermorePEXsData
         elements = other.elements;
         return *this;
     }
+
+    //! Visit each collection and nested group
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("reals", reals);
+        visit("shells", shells);
+        visit("elements", elements);
+    }
 };
 
 //---------------------------------------------------------------------------//
@@ -171,6 +181,9 @@ struct LivermorePEData
     //! EADL transition data used for atomic relaxation
     AtomicRelaxParamsPointers atomic_relaxation;
 
+    //! Optional energy-binned element selection tables for each material
+    ElementTableData<W, M> element_tables;
+
     //// MEMBER FUNCTIONS ////
 
     //! Check whether the data is assigned
@@ -188,8 +201,17 @@ struct LivermorePEData
         inv_electron_mass = other.inv_electron_mass;
         xs                = other.xs;
         atomic_relaxation = other.atomic_relaxation;
+        element_tables    = other.element_tables;
         return *this;
     }
+
+    //! Visit each collection and nested group
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("xs", xs);
+        visit("element_tables", element_tables);
+    }
 };
 
 using LivermorePEDeviceRef
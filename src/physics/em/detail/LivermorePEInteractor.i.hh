@@ -41,7 +41,6 @@ LivermorePEInteractor::LivermorePEInteractor(const LivermorePEPointers& shared,
 {
     CELER_EXPECT(particle.particle_id() == shared_.ids.gamma);
     CELER_EXPECT(inc_energy_.value() > 0);
-    CELER_EXPECT(!shared_.atomic_relaxation || scratch_.vacancies);
 
     inv_energy_ = 1 / inc_energy_.value();
 }
@@ -58,21 +57,27 @@ CELER_FUNCTION Interaction LivermorePEInteractor::operator()(Engine& rng)
     Span<SubshellId>       vacancies;
     if (relaxation)
     {
-        StackAllocator<SubshellId> allocate_vacancies(scratch_.vacancies);
-        size_type                  count = 1 + relaxation.max_secondaries();
+        size_type count = 1 + relaxation.max_secondaries();
         if (Secondary* ptr = allocate_(count))
         {
             secondaries = {ptr, count};
         }
+
+        // No vacancy stack is needed if the cascade outcomes are precomputed
         count = relaxation.max_vacancies();
-        if (SubshellId* ptr = allocate_vacancies(count))
-        {
-            vacancies = {ptr, count};
-        }
-        else
+        if (count > 0)
         {
-            // Failed to allocate space for vacancy stack
-            return Interaction::from_failure();
+            CELER_ASSERT(scratch_.vacancies);
+            StackAllocator<SubshellId> allocate_vacancies(scratch_.vacancies);
+            if (SubshellId* ptr = allocate_vacancies(count))
+            {
+                vacancies = {ptr, count};
+            }
+            else
+            {
+                // Failed to allocate space for vacancy stack
+                return Interaction::from_failure();
+            }
         }
     }
     else if (Secondary* ptr = allocate_(1))
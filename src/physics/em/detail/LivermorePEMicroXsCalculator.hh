@@ -37,12 +37,20 @@ class LivermorePEMicroXsCalculator
     LivermorePEMicroXsCalculator(const LivermorePEPointers& shared,
                                  Energy                     energy);
 
+    // Construct with cross section data from any memory space
+    template<MemSpace M>
+    inline CELER_FUNCTION LivermorePEMicroXsCalculator(
+        const LivermorePEXsData<Ownership::const_reference, M>& xs,
+        Energy                                                  energy);
+
     // Compute cross section
     inline CELER_FUNCTION real_type operator()(ElementId el_id) const;
 
   private:
     // Shared constant physics properties
-    const LivermorePEPointers& shared_;
+    Span<const LivermoreElement>  elements_;
+    Span<const LivermoreSubshell> shells_;
+    Span<const real_type>         reals_;
     // Incident gamma energy
     const Energy inc_energy_;
 };
@@ -19,7 +19,23 @@ namespace detail
  */
 CELER_FUNCTION LivermorePEMicroXsCalculator::LivermorePEMicroXsCalculator(
     const LivermorePEPointers& shared, Energy energy)
-    : shared_(shared), inc_energy_(energy.value())
+    : LivermorePEMicroXsCalculator(shared.xs, energy)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with cross section data from any memory space.
+ *
+ * This allows the cross sections to be evaluated on the host during setup.
+ */
+template<MemSpace M>
+CELER_FUNCTION LivermorePEMicroXsCalculator::LivermorePEMicroXsCalculator(
+    const LivermorePEXsData<Ownership::const_reference, M>& xs, Energy energy)
+    : elements_(xs.elements[AllItems<LivermoreElement, M>{}])
+    , shells_(xs.shells[AllItems<LivermoreSubshell, M>{}])
+    , reals_(xs.reals[AllItems<real_type, M>{}])
+    , inc_energy_(energy.value())
 {
 }
 
@@ -31,8 +47,10 @@ CELER_FUNCTION
 real_type LivermorePEMicroXsCalculator::operator()(ElementId el_id) const
 {
     CELER_EXPECT(el_id);
-    const LivermoreElement& el     = shared_.xs.elements[el_id];
-    const auto&             shells = shared_.xs.shells[el.shells];
+    CELER_EXPECT(el_id < elements_.size());
+    const LivermoreElement& el = elements_[el_id.get()];
+    const auto              shells
+        = shells_.subspan(el.shells.begin()->get(), el.shells.size());
 
     // In Geant4, if the incident gamma energy is below the lowest binding
     // energy, it is set to the binding energy so that the photoelectric cross
@@ -59,14 +77,14 @@ real_type LivermorePEMicroXsCalculator::operator()(ElementId el_id) const
     {
         // Use tabulated cross sections above K-shell energy but below energy
         // limit for parameterization
-        GenericXsCalculator calc_xs(el.xs_hi, shared_.xs.reals);
+        GenericXsCalculator calc_xs(el.xs_hi, reals_);
         result = ipow<3>(inv_energy) * calc_xs(energy.value());
     }
     else
     {
         CELER_ASSERT(el.xs_lo);
         // Use tabulated cross sections below K-shell energy
-        GenericXsCalculator calc_xs(el.xs_lo, shared_.xs.reals);
+        GenericXsCalculator calc_xs(el.xs_lo, reals_);
         result = ipow<3>(inv_energy) * calc_xs(energy.value());
     }
     return result;
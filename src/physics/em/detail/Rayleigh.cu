@@ -9,6 +9,7 @@
 
 #include "base/Assert.hh"
 #include "base/KernelParamCalculator.cuda.hh"
+#include "random/CountingRngEngine.hh"
 #include "random/RngEngine.hh"
 #include "physics/base/ModelInterface.hh"
 #include "physics/base/ParticleTrackView.hh"
@@ -67,7 +68,8 @@ rayleigh_interact_kernel(const RayleighDeviceRef                   rayleigh,
     RayleighInteractor interact(
         rayleigh, particle, model.states.direction[tid], el_id);
 
-    model.states.interactions[tid] = interact(rng);
+    model.states.interactions[tid] = sample_counted(
+        interact, rng, model.states.rng_counters, rayleigh.model_id.get());
     CELER_ENSURE(model.states.interactions[tid]);
 }
 
@@ -11,6 +11,7 @@
 #include "base/Types.hh"
 #include "base/Collection.hh"
 #include "physics/base/Types.hh"
+#include "physics/grid/UniformGridInterface.hh"
 #include "physics/material/Types.hh"
 
 namespace celeritas
@@ -50,6 +51,73 @@ struct RayleighParameters
     Real3 n;
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Tabulated angular distribution for a single element.
+ *
+ * For each point on the log-energy grid, the cumulative distribution of the
+ * reduced angle \f$ \xi = (1 - \cos\theta)/2 \f$ is stored at \c num_nodes
+ * points. The nodes are spaced geometrically in \f$ 1 + c\xi \f$, where \em
+ * c is the largest form factor argument at that energy, so that the forward
+ * peak at high energy is resolved.
+ */
+struct RayleighElementTable
+{
+    ItemRange<real_type> xi;  //!< [energy][node] reduced angle
+    ItemRange<real_type> cdf; //!< [energy][node] cumulative probability
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Optional precomputed angular distributions for all elements.
+ *
+ * These tabulate the full differential cross section
+ * \f[
+ *  \frac{d\sigma}{d\xi} \propto [1 + \cos^{2}\theta] FF(E,\cos)^2
+ * \f]
+ * so that the scattering angle can be sampled by inverting the CDF without
+ * rejection.
+ */
+template<Ownership W, MemSpace M>
+struct RayleighTableData
+{
+    //// MEMBER DATA ////
+
+    UniformGridData log_energy;  //!< Log energy grid [MeV]
+    size_type       num_nodes{}; //!< Angular points per energy
+
+    Collection<RayleighElementTable, W, M, ElementId> elements;
+    Collection<real_type, W, M>                       reals;
+
+    //// MEMBER FUNCTIONS ////
+
+    //! Whether the data is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return log_energy && num_nodes > 1 && !elements.empty()
+               && !reals.empty();
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    RayleighTableData& operator=(const RayleighTableData<W2, M2>& other)
+    {
+        log_energy = other.log_energy;
+        num_nodes  = other.num_nodes;
+        elements   = other.elements;
+        reals      = other.reals;
+        return *this;
+    }
+
+    //! Visit each collection and nested group
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("elements", elements);
+        visit("reals", reals);
+    }
+};
+
 //---------------------------------------------------------------------------//
 /*!
  * Device data for creating an interactor.
@@ -67,6 +135,9 @@ struct RayleighGroup
     using ElementItems = celeritas::Collection<T, W, M, ElementId>;
     ElementItems<RayleighParameters> params;
 
+    //! Tabulated angular distributions (optional)
+    RayleighTableData<W, M> tables;
+
     //! Check whether the data is assigned
     explicit inline CELER_FUNCTION operator bool() const
     {
@@ -81,8 +152,17 @@ struct RayleighGroup
         model_id = other.model_id;
         gamma_id = other.gamma_id;
         params   = other.params;
+        tables   = other.tables;
         return *this;
     }
+
+    //! Visit each collection and nested group
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("params", params);
+        visit("tables", tables);
+    }
 };
 
 using RayleighDeviceRef
@@ -28,6 +28,10 @@ namespace detail
  * \note This performs the same sampling routine as in Geant4's
  * G4LivermoreRayleighModel class, as documented in section 6.2.2 of the
  * Geant4 Physics Reference (release 10.6).
+ *
+ * If the model was built with tabulated angular distributions, the scattering
+ * angle is instead sampled by inverting the tabulated CDF of the element,
+ * which needs no rejection loop.
  */
 class RayleighInteractor
 {
@@ -85,6 +89,14 @@ class RayleighInteractor
 
     //! Evaluate weights and probabilities for the angular sampling algorithm
     inline CELER_FUNCTION auto evaluate_weight_and_prob() const -> SampleInput;
+
+    // Sample the scattering cosine from the form factor fit
+    template<class Engine>
+    inline CELER_FUNCTION real_type sample_fit(Engine& rng) const;
+
+    // Sample the scattering cosine from the tabulated distribution
+    template<class Engine>
+    inline CELER_FUNCTION real_type sample_tabulated(Engine& rng) const;
 };
 
 //---------------------------------------------------------------------------//
@@ -6,8 +6,10 @@
 //! \file RayleighInteractor.i.hh
 //---------------------------------------------------------------------------//
 
+#include <cmath>
 #include "base/ArrayUtils.hh"
 #include "base/Algorithms.hh"
+#include "physics/grid/UniformGrid.hh"
 #include "random/distributions/GenerateCanonical.hh"
 #include "random/distributions/IsotropicDistribution.hh"
 #include "random/Selector.hh"
@@ -48,6 +50,65 @@ CELER_FUNCTION Interaction RayleighInteractor::operator()(Engine& rng)
     result.action = Action::scattered;
     result.energy = inc_energy_;
 
+    const real_type cost = shared_.tables ? this->sample_tabulated(rng)
+                                          : this->sample_fit(rng);
+
+    UniformRealDistribution<real_type> sample_phi(0, 2 * constants::pi);
+
+    // Scattered direction
+    result.direction
+        = rotate(from_spherical(cost, sample_phi(rng)), inc_direction_);
+
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Evaluate weights and probabilities for the angular sampling algorithm.
+ */
+CELER_FUNCTION
+auto RayleighInteractor::evaluate_weight_and_prob() const -> SampleInput
+{
+    const Real3& a = shared_.params[element_id_].a;
+    const Real3& b = shared_.params[element_id_].b;
+    const Real3& n = shared_.params[element_id_].n;
+
+    SampleInput input;
+    input.factor = ipow<2>(units::centimeter * unit_cast(inc_energy_)
+                           / (constants::c_light * constants::h_planck));
+
+    Real3 x = b;
+    axpy(input.factor, b, &x);
+
+    Real3 prob;
+    for (auto i : range(3))
+    {
+        input.weight[i] = (x[i] > fit_slice())
+                              ? 1 - std::pow(1 + x[i], -n[i])
+                              : n[i] * x[i]
+                                    * (1
+                                       - real_type(0.5) * (n[i] - 1) * (x[i])
+                                             * (1 - (n[i] - 2) * (x[i]) / 3));
+
+        prob[i] = input.weight[i] * a[i] / (b[i] * n[i]);
+    }
+
+    real_type inv_sum = 1 / (prob[0] + prob[1] + prob[2]);
+    axpy(inv_sum, prob, &input.prob);
+
+    return input;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the scattering cosine from the form factor fit.
+ *
+ * Each term of the fit is sampled analytically, and the \f$ 1 + \cos^2\theta
+ * \f$ factor is applied by rejection.
+ */
+template<class Engine>
+CELER_FUNCTION real_type RayleighInteractor::sample_fit(Engine& rng) const
+{
     SampleInput input = this->evaluate_weight_and_prob();
 
     const Real3& pb = shared_.params[element_id_].b;
@@ -86,46 +147,62 @@ CELER_FUNCTION Interaction RayleighInteractor::operator()(Engine& rng)
 
     } while (2 * generate_canonical(rng) > 1 + ipow<2>(cost) || cost < -1);
 
-    UniformRealDistribution<real_type> sample_phi(0, 2 * constants::pi);
-
-    // Scattered direction
-    result.direction
-        = rotate(from_spherical(cost, sample_phi(rng)), inc_direction_);
-
-    return result;
+    return cost;
 }
 
-CELER_FUNCTION
-auto RayleighInteractor::evaluate_weight_and_prob() const -> SampleInput
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the scattering cosine from the tabulated distribution.
+ *
+ * The table at the lower or upper bounding energy grid point is chosen
+ * stochastically using the fractional log-energy position, and the reduced
+ * angle is then sampled by inverting its piecewise-linear CDF.
+ */
+template<class Engine>
+CELER_FUNCTION real_type
+RayleighInteractor::sample_tabulated(Engine& rng) const
 {
-    const Real3& a = shared_.params[element_id_].a;
-    const Real3& b = shared_.params[element_id_].b;
-    const Real3& n = shared_.params[element_id_].n;
-
-    SampleInput input;
-    input.factor = ipow<2>(units::centimeter * unit_cast(inc_energy_)
-                           / (constants::c_light * constants::h_planck));
+    const auto& tables = shared_.tables;
 
-    Real3 x = b;
-    axpy(input.factor, b, &x);
-
-    Real3 prob;
-    for (auto i : range(3))
+    // Find the energy table
+    const UniformGrid loge_grid(tables.log_energy);
+    const real_type   loge = std::log(inc_energy_.value());
+    size_type         idx  = 0;
+    if (loge >= loge_grid.back())
     {
-        input.weight[i] = (x[i] > fit_slice())
-                              ? 1 - std::pow(1 + x[i], -n[i])
-                              : n[i] * x[i]
-                                    * (1
-                                       - real_type(0.5) * (n[i] - 1) * (x[i])
-                                             * (1 - (n[i] - 2) * (x[i]) / 3));
-
-        prob[i] = input.weight[i] * a[i] / (b[i] * n[i]);
+        idx = loge_grid.size() - 1;
+    }
+    else if (loge > loge_grid.front())
+    {
+        idx = loge_grid.find(loge);
+        const real_type frac = (loge - loge_grid[idx])
+                               / tables.log_energy.delta;
+        if (generate_canonical(rng) < frac)
+        {
+            ++idx;
+        }
     }
 
-    real_type inv_sum = 1 / (prob[0] + prob[1] + prob[2]);
-    axpy(inv_sum, prob, &input.prob);
-
-    return input;
+    const RayleighElementTable& table = tables.elements[element_id_];
+    const auto xi  = tables.reals[table.xi].subspan(idx * tables.num_nodes,
+                                                   tables.num_nodes);
+    const auto cdf = tables.reals[table.cdf].subspan(idx * tables.num_nodes,
+                                                     tables.num_nodes);
+
+    // Find the CDF interval and interpolate
+    const real_type u = generate_canonical(rng);
+    size_type       k = celeritas::lower_bound(cdf.begin(), cdf.end(), u)
+                  - cdf.begin();
+    k = celeritas::min(celeritas::max(k, size_type(1)),
+                       size_type(cdf.size() - 1));
+
+    real_type       result = xi[k - 1];
+    const real_type width  = cdf[k] - cdf[k - 1];
+    if (width > 0)
+    {
+        result += (xi[k] - xi[k - 1]) * (u - cdf[k - 1]) / width;
+    }
+    return 1 - 2 * result;
 }
 
 //---------------------------------------------------------------------------//
@@ -14,6 +14,7 @@
 #include "physics/base/ParticleTrackView.hh"
 #include "physics/base/PhysicsTrackView.hh"
 #include "physics/material/MaterialTrackView.hh"
+#include "random/CountingRngEngine.hh"
 #include "random/RngEngine.hh"
 #include "SeltzerBergerInteractor.hh"
 
@@ -71,7 +72,11 @@ __global__ void seltzer_berger_interact_kernel(
                                      selected_element);
 
     RngEngine rng(interaction.states.rng, tid);
-    interaction.states.interactions[tid] = interact(rng);
+    interaction.states.interactions[tid]
+        = sample_counted(interact,
+                         rng,
+                         interaction.states.rng_counters,
+                         device_pointers.ids.model.get());
     CELER_ENSURE(interaction.states.interactions[tid]);
 }
 
@@ -93,6 +93,15 @@ struct SeltzerBergerTableData
         elements = other.elements;
         return *this;
     }
+
+    //! Visit each collection and nested group
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("reals", reals);
+        visit("sizes", sizes);
+        visit("elements", elements);
+    }
 };
 
 //! Helper struct for making assignment easier
@@ -151,6 +160,13 @@ struct SeltzerBergerData
         differential_xs = other.differential_xs;
         return *this;
     }
+
+    //! Visit each collection and nested group
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("differential_xs", differential_xs);
+    }
 };
 
 using SeltzerBergerDeviceRef
@@ -7,8 +7,11 @@
 //---------------------------------------------------------------------------//
 #include "Utils.hh"
 
+#include <algorithm>
 #include <cmath>
+#include <iterator>
 #include "base/Algorithms.hh"
+#include "base/Assert.hh"
 #include "base/Range.hh"
 
 namespace celeritas
@@ -96,6 +99,164 @@ MaxSecondariesCalculator::calc(SubshellId vacancy_shell, size_type count)
     return count + sub_count;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with EADL transition data and production thresholds.
+ */
+RelaxationOutcomeCalculator::RelaxationOutcomeCalculator(
+    const AtomicRelaxElement& el,
+    ParticleId                electron_id,
+    ParticleId                gamma_id,
+    MevEnergy                 electron_cut,
+    MevEnergy                 gamma_cut)
+    : shells_(el.shells)
+    , electron_id_(electron_id)
+    , gamma_id_(gamma_id)
+    , electron_cut_(electron_cut.value())
+    , gamma_cut_(gamma_cut.value())
+{
+    CELER_EXPECT(electron_id_ && gamma_id_);
+
+    // A vacancy with no transition data produces nothing
+    no_vacancy_[Key{}].probability = 1;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the outcomes for an initial vacancy in the given subshell.
+ *
+ * The outcomes are ordered by decreasing probability, and the probabilities
+ * are renormalized to account for the discarded cascades.
+ */
+auto RelaxationOutcomeCalculator::operator()(SubshellId vacancy_shell)
+    -> VecOutcome
+{
+    const Distribution& dist = this->calc(vacancy_shell);
+
+    real_type total = 0;
+    for (const auto& key_weight : dist)
+    {
+        total += key_weight.second.probability;
+    }
+    CELER_ASSERT(total > 0);
+
+    VecOutcome result;
+    result.reserve(dist.size());
+    for (const auto& key_weight : dist)
+    {
+        const Weight& w = key_weight.second;
+
+        Outcome outcome;
+        outcome.probability = w.probability / total;
+        outcome.energy      = w.energy / w.probability;
+        for (const auto& idx : key_weight.first)
+        {
+            const AtomicRelaxTransition& transition
+                = shells_[idx.first].transitions[idx.second];
+            outcome.products.push_back(
+                {transition.auger_shell ? electron_id_ : gamma_id_,
+                 transition.energy});
+        }
+        result.push_back(std::move(outcome));
+    }
+    std::stable_sort(
+        result.begin(), result.end(), [](const Outcome& a, const Outcome& b) {
+            return a.probability > b.probability;
+        });
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate the distribution of emitted secondaries for a vacancy.
+ */
+auto RelaxationOutcomeCalculator::calc(SubshellId vacancy_shell)
+    -> const Distribution&
+{
+    // No transitions for this subshell, so no secondaries produced
+    if (!vacancy_shell || vacancy_shell.get() >= shells_.size())
+        return no_vacancy_;
+
+    auto it = visited_.find(vacancy_shell.get());
+    if (it != visited_.end())
+        return it->second;
+
+    // Transitions only fill vacancies from outer shells, so the recursion
+    // must terminate
+    CELER_MAYBE_UNUSED bool inserted
+        = in_progress_.insert(vacancy_shell.get()).second;
+    CELER_ASSERT(inserted);
+
+    const auto&  transitions = shells_[vacancy_shell.get()].transitions;
+    Distribution result;
+    real_type    remainder = 1;
+    for (auto i : range(transitions.size()))
+    {
+        const AtomicRelaxTransition& transition = transitions[i];
+        remainder -= transition.probability;
+        if (transition.probability < min_probability())
+            continue;
+
+        // Whether a secondary is emitted above the production threshold
+        const bool emitted = transition.energy >= (transition.auger_shell
+                                                       ? electron_cut_
+                                                       : gamma_cut_);
+
+        // Combine the outcomes of the resulting vacancies. The map nodes are
+        // stable, so recursive insertion doesn't invalidate these references.
+        const Distribution& first  = this->calc(transition.initial_shell);
+        const Distribution& second = this->calc(transition.auger_shell);
+        for (const auto& a : first)
+        {
+            const real_type prob_a = transition.probability
+                                     * a.second.probability;
+            if (prob_a < min_probability())
+                continue;
+
+            for (const auto& b : second)
+            {
+                const real_type prob = prob_a * b.second.probability;
+                if (prob < min_probability())
+                    continue;
+
+                Key key;
+                key.reserve(a.first.size() + b.first.size() + 1);
+                std::merge(a.first.begin(),
+                           a.first.end(),
+                           b.first.begin(),
+                           b.first.end(),
+                           std::back_inserter(key));
+                if (emitted)
+                {
+                    const std::pair<size_type, size_type> idx{
+                        vacancy_shell.get(), i};
+                    key.insert(std::upper_bound(key.begin(), key.end(), idx),
+                               idx);
+                }
+
+                // Accumulate the total transition energy weighted by
+                // probability
+                Weight& w = result[std::move(key)];
+                w.probability += prob;
+                w.energy += prob * transition.energy
+                            + transition.probability
+                                  * (a.second.energy * b.second.probability
+                                     + a.second.probability * b.second.energy);
+            }
+        }
+    }
+
+    if (remainder > 0)
+    {
+        // No transition occurs
+        result[Key{}].probability += remainder;
+    }
+
+    in_progress_.erase(vacancy_shell.get());
+    return visited_.emplace(vacancy_shell.get(), std::move(result))
+        .first->second;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
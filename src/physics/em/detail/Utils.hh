@@ -7,7 +7,11 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <map>
+#include <set>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 #include "base/Macros.hh"
 #include "base/Types.hh"
 #include "physics/em/AtomicRelaxationInterface.hh"
@@ -56,6 +60,77 @@ class MaxSecondariesCalculator
     size_type calc(SubshellId vacancy_shell, size_type count);
 };
 
+//---------------------------------------------------------------------------//
+/*!
+ * Helper class for tabulating the outcomes of the atomic relaxation cascade.
+ *
+ * Since each vacancy relaxes independently of the others, the distribution of
+ * secondaries produced by a vacancy in a given subshell is a mixture over its
+ * transitions of the combined distributions of the (one or two) new
+ * vacancies. These per-subshell distributions are calculated recursively and
+ * cached. Cascades that produce the same set of secondaries above the
+ * production thresholds are merged, and cascades less likely than \c
+ * min_probability are discarded.
+ */
+class RelaxationOutcomeCalculator
+{
+  public:
+    //!@{
+    //! Type aliases
+    using MevEnergy = units::MevEnergy;
+    //!@}
+
+    //! A unique set of emitted secondaries
+    struct Outcome
+    {
+        std::vector<AtomicRelaxProduct> products;
+        real_type                       energy;
+        real_type                       probability;
+    };
+
+    using VecOutcome = std::vector<Outcome>;
+
+    //! Discard cascades less likely than this
+    static constexpr real_type min_probability() { return 1e-6; }
+
+  public:
+    // Construct with EADL transition data and production thresholds
+    RelaxationOutcomeCalculator(const AtomicRelaxElement& el,
+                                ParticleId                electron_id,
+                                ParticleId                gamma_id,
+                                MevEnergy                 electron_cut,
+                                MevEnergy                 gamma_cut);
+
+    // Calculate the outcomes for an initial vacancy in the given subshell
+    VecOutcome operator()(SubshellId vacancy_shell);
+
+  private:
+    //! Emitted transitions as (subshell, transition) indices in sorted order
+    using Key = std::vector<std::pair<size_type, size_type>>;
+
+    //! Probability and energy-weighted probability
+    struct Weight
+    {
+        real_type probability{0};
+        real_type energy{0};
+    };
+
+    using Distribution = std::map<Key, Weight>;
+
+    Span<const AtomicRelaxSubshell>   shells_;
+    ParticleId                        electron_id_;
+    ParticleId                        gamma_id_;
+    const real_type                   electron_cut_;
+    const real_type                   gamma_cut_;
+    std::map<size_type, Distribution> visited_;
+    std::set<size_type>               in_progress_;
+    Distribution                      no_vacancy_;
+
+    // HELPER FUNCTIONS
+
+    const Distribution& calc(SubshellId vacancy_shell);
+};
+
 //---------------------------------------------------------------------------//
 } // namespace detail
 } // namespace celeritas
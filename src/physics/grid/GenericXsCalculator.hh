@@ -9,6 +9,7 @@
 
 #include "base/Collection.hh"
 #include "base/Macros.hh"
+#include "base/Span.hh"
 #include "base/Types.hh"
 #include "XsGridInterface.hh"
 
@@ -25,6 +26,7 @@ class GenericXsCalculator
     //! Type aliases
     using Values
         = Collection<real_type, Ownership::const_reference, MemSpace::native>;
+    using SpanConstReal = Span<const real_type>;
     //@}
 
   public:
@@ -32,12 +34,16 @@ class GenericXsCalculator
     inline CELER_FUNCTION
     GenericXsCalculator(const GenericGridData& grid, const Values& values);
 
+    // Construct from grid data and values from any memory space
+    inline CELER_FUNCTION
+    GenericXsCalculator(const GenericGridData& grid, SpanConstReal values);
+
     // Find and interpolate the cross section from the given energy
     inline CELER_FUNCTION real_type operator()(const real_type energy) const;
 
   private:
     const GenericGridData& data_;
-    const Values&          reals_;
+    SpanConstReal          reals_;
 
     CELER_FORCEINLINE_FUNCTION real_type get(size_type index) const;
 };
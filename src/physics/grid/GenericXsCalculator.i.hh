@@ -19,6 +19,17 @@ namespace celeritas
 CELER_FUNCTION
 GenericXsCalculator::GenericXsCalculator(const GenericGridData& grid,
                                          const Values&          values)
+    : GenericXsCalculator(grid, values[AllItems<real_type, MemSpace::native>{}])
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from grid data and values from any memory space.
+ */
+CELER_FUNCTION
+GenericXsCalculator::GenericXsCalculator(const GenericGridData& grid,
+                                         SpanConstReal          values)
     : data_(grid), reals_(values)
 {
     CELER_EXPECT(data_);
@@ -69,7 +80,7 @@ GenericXsCalculator::operator()(const real_type energy) const
 CELER_FUNCTION real_type GenericXsCalculator::get(size_type index) const
 {
     CELER_EXPECT(index < data_.value.size());
-    return reals_[data_.value[index]];
+    return reals_[data_.value[index].get()];
 }
 
 //---------------------------------------------------------------------------//
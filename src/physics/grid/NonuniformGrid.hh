@@ -9,6 +9,7 @@
 
 #include "base/Collection.hh"
 #include "base/Macros.hh"
+#include "base/Span.hh"
 #include "base/Types.hh"
 
 namespace celeritas
@@ -30,6 +31,7 @@ class NonuniformGrid
     using value_type = T;
     using Values
         = Collection<value_type, Ownership::const_reference, MemSpace::native>;
+    using SpanConstT = Span<const value_type>;
     //!@}
 
   public:
@@ -37,6 +39,10 @@ class NonuniformGrid
     explicit inline CELER_FUNCTION
     NonuniformGrid(const ItemRange<value_type>& values, const Values& data);
 
+    // Construct with data from any memory space
+    inline CELER_FUNCTION
+    NonuniformGrid(const ItemRange<value_type>& values, SpanConstT data);
+
     //! Number of grid points
     CELER_FORCEINLINE_FUNCTION size_type size() const { return data_.size(); }
 
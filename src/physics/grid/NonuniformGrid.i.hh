@@ -24,6 +24,23 @@ NonuniformGrid<T>::NonuniformGrid(const ItemRange<value_type>& values,
     CELER_EXPECT(data_.front() <= data_.back()); // Approximation for "sorted"
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with data from any memory space.
+ *
+ * This allows host code to use grids stored in a host collection in a build
+ * where the native memory space is the device.
+ */
+template<class T>
+CELER_FUNCTION
+NonuniformGrid<T>::NonuniformGrid(const ItemRange<value_type>& values,
+                                  SpanConstT                   data)
+    : data_(data.subspan(values.begin()->get(), values.size()))
+{
+    CELER_EXPECT(data_.size() >= 2);
+    CELER_EXPECT(data_.front() <= data_.back()); // Approximation for "sorted"
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get the value at the given grid point.
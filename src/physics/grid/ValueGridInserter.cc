@@ -7,9 +7,12 @@
 //---------------------------------------------------------------------------//
 #include "ValueGridInserter.hh"
 
+#include <cmath>
+#include <vector>
 #include "base/SpanRemapper.hh"
 #include "base/VectorUtils.hh"
 #include "comm/Device.hh"
+#include "UniformGrid.hh"
 
 namespace celeritas
 {
@@ -19,7 +22,9 @@ namespace celeritas
  */
 ValueGridInserter::ValueGridInserter(RealCollection*   real_data,
                                      XsGridCollection* xs_grid)
-    : values_(real_data), xs_grids_(xs_grid)
+    : values_(real_data)
+    , xs_grids_(xs_grid)
+    , grid_energy_(std::make_shared<MapEnergy>())
 {
     CELER_EXPECT(real_data && xs_grid);
 }
@@ -27,6 +32,9 @@ ValueGridInserter::ValueGridInserter(RealCollection*   real_data,
 //---------------------------------------------------------------------------//
 /*!
  * Add a grid of physics xs data.
+ *
+ * The grid energies are stored so that they don't have to be recalculated
+ * during transport.
  */
 auto ValueGridInserter::operator()(const UniformGridData& log_grid,
                                    size_type              prime_index,
@@ -41,6 +49,7 @@ auto ValueGridInserter::operator()(const UniformGridData& log_grid,
     grid.log_energy  = log_grid;
     grid.prime_index = prime_index;
     grid.value       = values_.insert_back(values.begin(), values.end());
+    grid.energy      = this->insert_energy(log_grid);
     return xs_grids_.push_back(grid);
 }
 
@@ -64,5 +73,30 @@ auto ValueGridInserter::operator()(InterpolatedGrid, InterpolatedGrid)
     CELER_NOT_IMPLEMENTED("generic grids");
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the stored energies of a log grid, adding them if it's a new grid.
+ */
+auto ValueGridInserter::insert_energy(const UniformGridData& log_grid)
+    -> ItemRange<real_type>
+{
+    GridKey key{log_grid.size, log_grid.front, log_grid.delta};
+    auto    iter = grid_energy_->find(key);
+    if (iter != grid_energy_->end())
+    {
+        return iter->second;
+    }
+
+    const UniformGrid      loge_grid(log_grid);
+    std::vector<real_type> energy(loge_grid.size());
+    for (size_type i = 0; i < loge_grid.size(); ++i)
+    {
+        energy[i] = std::exp(loge_grid[i]);
+    }
+    auto result = values_.insert_back(energy.begin(), energy.end());
+    grid_energy_->insert({key, result});
+    return result;
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -7,6 +7,9 @@
 //---------------------------------------------------------------------------//
 #pragma once
 
+#include <map>
+#include <memory>
+#include <tuple>
 #include <vector>
 #include "base/Collection.hh"
 #include "base/CollectionBuilder.hh"
@@ -25,6 +28,9 @@ namespace celeritas
  * ValueGridXsBuilder::build method taking an instance of this class) it can be
  * extended to build additional grid types as well.
  *
+ * The energies of each distinct log grid are stored once and shared by all
+ * xs grids that use it, including grids inserted by copies of the inserter.
+ *
  * \code
     ValueGridInserter insert(&data.host.values, &data.host.grids);
     insert(uniform_grid, values);
@@ -63,8 +69,14 @@ class ValueGridInserter
     GenericIndex operator()(InterpolatedGrid grid, InterpolatedGrid values);
 
   private:
+    using GridKey   = std::tuple<size_type, real_type, real_type>;
+    using MapEnergy = std::map<GridKey, ItemRange<real_type>>;
+
     CollectionBuilder<real_type, MemSpace::host, ItemId<real_type>>   values_;
     CollectionBuilder<XsGridData, MemSpace::host, ItemId<XsGridData>> xs_grids_;
+    std::shared_ptr<MapEnergy> grid_energy_;
+
+    ItemRange<real_type> insert_energy(const UniformGridData& log_grid);
 };
 
 //---------------------------------------------------------------------------//
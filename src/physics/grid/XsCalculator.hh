@@ -8,6 +8,7 @@
 #pragma once
 
 #include "base/Quantity.hh"
+#include "base/Span.hh"
 #include "XsGridInterface.hh"
 
 namespace celeritas
@@ -29,6 +30,13 @@ namespace celeritas
     XsCalculator calc_xs(xs_grid, xs_params.reals);
     real_type xs = calc_xs(particle);
    \endcode
+ *
+ * On the host, many energies can be evaluated against the same grid in one
+ * call, which is the preferred way to calculate cross sections for a group of
+ * tracks that share a material and particle type:
+ * \code
+    calc_xs(make_span(energies), make_span(xs));
+   \endcode
  */
 class XsCalculator
 {
@@ -51,11 +59,16 @@ class XsCalculator
     // Get the cross section at the given index
     inline CELER_FUNCTION real_type operator[](size_type index) const;
 
+    // Calculate cross sections for many energies [MeV] on the host
+    inline void
+    operator()(Span<const real_type> energy, Span<real_type> result) const;
+
   private:
     const XsGridData& data_;
     const Values&     reals_;
 
     CELER_FORCEINLINE_FUNCTION real_type get(size_type index) const;
+    CELER_FORCEINLINE_FUNCTION real_type get_energy(size_type index) const;
 };
 
 //---------------------------------------------------------------------------//
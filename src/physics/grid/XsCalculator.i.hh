@@ -6,6 +6,7 @@
 //! \file XsCalculator.i.hh
 //---------------------------------------------------------------------------//
 #include <cmath>
+#include "base/Algorithms.hh"
 #include "Interpolator.hh"
 #include "UniformGrid.hh"
 
@@ -54,7 +55,7 @@ CELER_FUNCTION real_type XsCalculator::operator()(Energy energy) const
         lower_idx = loge_grid.find(loge);
         CELER_ASSERT(lower_idx + 1 < loge_grid.size());
 
-        const real_type upper_energy = std::exp(loge_grid[lower_idx + 1]);
+        const real_type upper_energy = this->get_energy(lower_idx + 1);
         real_type       upper_xs     = this->get(lower_idx + 1);
         if (lower_idx + 1 == data_.prime_index)
         {
@@ -65,7 +66,7 @@ CELER_FUNCTION real_type XsCalculator::operator()(Energy energy) const
 
         // Interpolate *linearly* on energy using the lower_idx data.
         LinearInterpolator<real_type> interpolate_xs(
-            {std::exp(loge_grid[lower_idx]), this->get(lower_idx)},
+            {this->get_energy(lower_idx), this->get(lower_idx)},
             {upper_energy, upper_xs});
         result = interpolate_xs(energy.value());
     }
@@ -83,17 +84,113 @@ CELER_FUNCTION real_type XsCalculator::operator()(Energy energy) const
  */
 CELER_FUNCTION real_type XsCalculator::operator[](size_type index) const
 {
-    const UniformGrid loge_grid(data_.log_energy);
-    real_type         energy = std::exp(loge_grid[index]);
-    real_type         result = this->get(index);
+    real_type result = this->get(index);
 
     if (index >= data_.prime_index)
     {
-        result /= energy;
+        result /= this->get_energy(index);
     }
     return result;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Calculate cross sections for many energies on the host.
+ *
+ * This gives the same result as calling the scalar operator for each energy,
+ * to within roundoff, but avoids all calls to the math library. Energies are
+ * processed in blocks: the log energies of a block are first calculated in a
+ * loop over \c fast_log that the compiler can vectorize, and the grid
+ * energies that bracket each point are read from the precomputed \c energy
+ * range rather than recalculated with \c std::exp. If a grid point lies
+ * within roundoff of the computed log energy, the neighboring bin may be
+ * selected; since the interpolation is continuous across grid points, this
+ * only perturbs the result at the level of roundoff.
+ *
+ * Grids without precomputed energies fall back to the scalar evaluation.
+ */
+void XsCalculator::operator()(Span<const real_type> energy,
+                              Span<real_type>       result) const
+{
+    CELER_EXPECT(energy.size() == result.size());
+
+    if (data_.energy.empty())
+    {
+        for (size_type i = 0; i < energy.size(); ++i)
+        {
+            result[i] = (*this)(Energy{energy[i]});
+        }
+        return;
+    }
+
+    const UniformGrid           loge_grid(data_.log_energy);
+    const Span<const real_type> grid_e    = reals_[data_.energy];
+    const Span<const real_type> grid_xs   = reals_[data_.value];
+    const size_type             last_idx  = loge_grid.size() - 1;
+    const size_type             prime     = data_.prime_index;
+    const real_type             min_loge  = loge_grid.front();
+    const real_type             max_loge  = loge_grid.back();
+    const real_type             inv_delta = 1 / data_.log_energy.delta;
+    const real_type             min_e     = grid_e.front();
+    const real_type             max_e     = grid_e.back();
+    const real_type             max_bin   = last_idx - 1;
+
+    constexpr size_type block_size = 64;
+    real_type           loge[block_size];
+    for (size_type start = 0; start < energy.size(); start += block_size)
+    {
+        const size_type count
+            = celeritas::min(block_size, size_type(energy.size() - start));
+
+        // Vectorized calculation of the log energies
+        const real_type* block_e = energy.data() + start;
+        for (size_type i = 0; i < count; ++i)
+        {
+            loge[i] = fast_log(block_e[i]);
+        }
+
+        for (size_type i = 0; i < count; ++i)
+        {
+            const real_type e = block_e[i];
+            CELER_ASSERT(e > 0);
+            const bool above = (loge[i] >= max_loge);
+
+            // Locate the bin, clamped to the valid range of lower indices
+            real_type bin = (loge[i] - min_loge) * inv_delta;
+            bin           = (bin > 0) ? bin : 0;
+            bin           = (bin < max_bin) ? bin : max_bin;
+            const size_type lower    = static_cast<size_type>(bin);
+            const size_type upper    = lower + 1;
+            const real_type lower_e  = grid_e[lower];
+            const real_type upper_e  = grid_e[upper];
+            const real_type lower_xs = grid_xs[lower];
+            real_type       upper_xs = grid_xs[upper];
+
+            // Snap out-of-bounds energies to the closest grid point
+            real_type e_clamped = (loge[i] > min_loge) ? e : min_e;
+            e_clamped           = above ? max_e : e_clamped;
+
+            // Unscale the upper point if it's the first prescaled value
+            if (upper == prime && !above)
+            {
+                upper_xs /= upper_e;
+            }
+
+            // Interpolate linearly in energy
+            real_type xs = lower_xs
+                           + (e_clamped - lower_e) * (upper_xs - lower_xs)
+                                 / (upper_e - lower_e);
+
+            // Apply 1/E scaling using the index of the snapped grid point
+            if ((above ? last_idx : lower) >= prime)
+            {
+                xs /= e;
+            }
+            result[start + i] = xs;
+        }
+    }
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get the raw cross section data at a particular index.
@@ -104,5 +201,20 @@ CELER_FUNCTION real_type XsCalculator::get(size_type index) const
     return reals_[data_.value[index]];
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Get the energy of a grid point.
+ */
+CELER_FUNCTION real_type XsCalculator::get_energy(size_type index) const
+{
+    if (data_.energy.empty())
+    {
+        const UniformGrid loge_grid(data_.log_energy);
+        return std::exp(loge_grid[index]);
+    }
+    CELER_EXPECT(index < data_.energy.size());
+    return reals_[data_.energy[index]];
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -24,6 +24,11 @@ namespace celeritas
  *
  * Interpolation is linear-linear after transforming to log-E space and before
  * scaling the value by E (if the grid point is above prime_index).
+ *
+ * The optional \c energy range stores \f$ \exp \f$ of each log-energy grid
+ * point so that the calculators don't have to recompute the bracketing
+ * energies with \c std::exp. It is required for batched evaluation. Grids
+ * that share a log-energy grid also share the same energy range.
  */
 struct XsGridData
 {
@@ -39,13 +44,15 @@ struct XsGridData
     UniformGridData      log_energy;
     size_type            prime_index{no_scaling()};
     ItemRange<real_type> value;
+    ItemRange<real_type> energy; //!< Optional grid energies [MeV]
 
     //! Whether the interface is initialized and valid
     explicit CELER_FUNCTION operator bool() const
     {
         return log_energy && (value.size() >= 2)
                && (prime_index < log_energy.size || prime_index == no_scaling())
-               && log_energy.size == value.size();
+               && log_energy.size == value.size()
+               && (energy.empty() || energy.size() == value.size());
     }
 };
 
@@ -0,0 +1,132 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ElementTableBuilder.cc
+//---------------------------------------------------------------------------//
+#include "ElementTableBuilder.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "base/Assert.hh"
+#include "base/CollectionBuilder.hh"
+#include "base/Range.hh"
+#include "physics/grid/UniformGrid.hh"
+#include "random/distributions/AliasTableBuilder.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+//! Distance in log energy between an edge and the grid points around it
+constexpr real_type edge_delta = 1e-6;
+
+//---------------------------------------------------------------------------//
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with materials, log-energy grid, and cross section edges.
+ *
+ * Edges outside the grid are ignored.
+ */
+ElementTableBuilder::ElementTableBuilder(const MaterialParams&  materials,
+                                         const UniformGridData& log_energy,
+                                         const VecEnergy&       edges)
+    : materials_(materials)
+{
+    CELER_EXPECT(log_energy);
+
+    const UniformGrid loge_grid(log_energy);
+    log_energy_.reserve(loge_grid.size() + 2 * edges.size());
+    for (auto i : range(loge_grid.size()))
+    {
+        log_energy_.push_back(loge_grid[i]);
+    }
+    for (MevEnergy edge : edges)
+    {
+        CELER_EXPECT(edge > zero_quantity());
+        const real_type loge = std::log(edge.value());
+        if (loge - edge_delta > loge_grid.front()
+            && loge + edge_delta < loge_grid.back())
+        {
+            log_energy_.push_back(loge - edge_delta);
+            log_energy_.push_back(loge + edge_delta);
+        }
+    }
+    std::sort(log_energy_.begin(), log_energy_.end());
+    log_energy_.erase(std::unique(log_energy_.begin(), log_energy_.end()),
+                      log_energy_.end());
+    CELER_ENSURE(log_energy_.size() >= loge_grid.size());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Build tables for all materials.
+ *
+ * If every element in a material has zero cross section at an energy point
+ * (e.g. below all thresholds), the elements are weighted by number fraction.
+ */
+auto ElementTableBuilder::operator()(const MicroXsCalc& calc_micro_xs) const
+    -> HostData
+{
+    CELER_EXPECT(calc_micro_xs);
+
+    HostData result;
+    make_builder(&result.log_energy)
+        .insert_back(log_energy_.begin(), log_energy_.end());
+    AliasTableBuilder build_alias(&result.entries);
+    auto              tables = make_builder(&result.materials);
+    tables.reserve(materials_.num_materials());
+
+    std::vector<real_type> weights;
+    for (auto mat_id : range(MaterialId{materials_.num_materials()}))
+    {
+        const MaterialView material = materials_.get(mat_id);
+        const auto         elements = material.elements();
+
+        MaterialElementTable table;
+        table.num_elements = elements.size();
+        if (elements.size() > 1)
+        {
+            using EntryId = AliasTableData::value_type;
+
+            // Tables for successive energies are stored contiguously
+            const EntryId start{result.entries.size()};
+            weights.resize(elements.size());
+            for (real_type loge : log_energy_)
+            {
+                const MevEnergy energy{std::exp(loge)};
+                real_type       total = 0;
+                for (auto j : range(elements.size()))
+                {
+                    const real_type micro_xs
+                        = calc_micro_xs(elements[j].element, energy);
+                    CELER_ASSERT(micro_xs >= 0);
+                    weights[j] = elements[j].fraction * micro_xs;
+                    total += weights[j];
+                }
+                if (total == 0)
+                {
+                    for (auto j : range(elements.size()))
+                    {
+                        weights[j] = elements[j].fraction;
+                    }
+                }
+                build_alias(make_span(weights));
+            }
+            table.entries = {start, EntryId{result.entries.size()}};
+        }
+        CELER_ASSERT(table || elements.empty());
+        tables.push_back(table);
+    }
+
+    CELER_ENSURE(result.materials.size() == materials_.num_materials());
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,70 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ElementTableBuilder.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <functional>
+#include <vector>
+#include "base/Types.hh"
+#include "physics/base/Units.hh"
+#include "physics/grid/UniformGridInterface.hh"
+#include "ElementTableInterface.hh"
+#include "MaterialParams.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct per-material, energy-binned element selection tables.
+ *
+ * At each point on the given log-energy grid, the elements of each material
+ * are weighted by their number fraction times the microscopic cross section
+ * returned by the given host function. This replaces the on-the-fly
+ * evaluation of \c ElementSelector for models whose cross sections depend
+ * only on the element and incident energy.
+ *
+ * Selection probabilities are interpolated between grid points, so a jump in
+ * a cross section (such as an absorption edge) would otherwise be smeared
+ * over an entire grid interval. Grid points are therefore added just below
+ * and above each of the given edge energies.
+ *
+ * \code
+    ElementTableBuilder build_tables(materials, log_grid, edges);
+    host_data.element_tables = build_tables(
+        [&](ElementId el, MevEnergy e) { return calc_micro_xs(el, e); });
+   \endcode
+ */
+class ElementTableBuilder
+{
+  public:
+    //!@{
+    //! Type aliases
+    using MevEnergy   = units::MevEnergy;
+    using MicroXsCalc = std::function<real_type(ElementId, MevEnergy)>;
+    using HostData    = ElementTableData<Ownership::value, MemSpace::host>;
+    using VecEnergy   = std::vector<MevEnergy>;
+    //!@}
+
+  public:
+    // Construct with materials, log-energy grid, and cross section edges
+    ElementTableBuilder(const MaterialParams&  materials,
+                        const UniformGridData& log_energy,
+                        const VecEnergy&       edges = {});
+
+    // Build tables for all materials
+    HostData operator()(const MicroXsCalc& calc_micro_xs) const;
+
+    //! Log energies of the grid points, including edges
+    const std::vector<real_type>& log_energy() const { return log_energy_; }
+
+  private:
+    const MaterialParams&  materials_;
+    std::vector<real_type> log_energy_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
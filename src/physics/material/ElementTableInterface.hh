@@ -0,0 +1,87 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file ElementTableInterface.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Collection.hh"
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "random/distributions/AliasTableInterface.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Element selection tables for a single material.
+ *
+ * The entries are a 2D array of alias tables: one table of \c num_elements
+ * bins for each point on the shared log-energy grid. Materials with a single
+ * element need no table, and materials with no elements (vacuum) can't be
+ * sampled.
+ */
+struct MaterialElementTable
+{
+    size_type                  num_elements{}; //!< Components in material
+    ItemRange<AliasTableEntry> entries;        //!< [energy][component]
+
+    //! Whether an element can be selected from this table
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return num_elements == 1 || (num_elements > 1 && !entries.empty());
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Precomputed element selection tables for all materials.
+ *
+ * These are constructed by \c ElementTableBuilder for a model whose
+ * elemental microscopic cross sections depend only on the incident energy,
+ * and sampled with a \c TabulatedElementSelector. All materials share a
+ * nonuniform grid of log energies, which has extra points on both sides of
+ * each cross section discontinuity (e.g. absorption edges).
+ */
+template<Ownership W, MemSpace M>
+struct ElementTableData
+{
+    //// MEMBER DATA ////
+
+    Collection<real_type, W, M>                        log_energy;
+    Collection<MaterialElementTable, W, M, MaterialId> materials;
+    Collection<AliasTableEntry, W, M>                  entries;
+
+    //// MEMBER FUNCTIONS ////
+
+    //! Whether the data is assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return !log_energy.empty() && !materials.empty();
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    ElementTableData& operator=(const ElementTableData<W2, M2>& other)
+    {
+        log_energy = other.log_energy;
+        materials  = other.materials;
+        entries    = other.entries;
+        return *this;
+    }
+
+    //! Visit each collection and nested group
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("log_energy", log_energy);
+        visit("materials", materials);
+        visit("entries", entries);
+    }
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
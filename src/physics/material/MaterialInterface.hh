@@ -119,6 +119,24 @@ struct MaterialParamsData
         max_element_components = other.max_element_components;
         return *this;
     }
+
+    //! Visit each collection and nested group
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("elements", elements);
+        visit("elcomponents", elcomponents);
+        visit("materials", materials);
+    }
+
+    //! Visit each collection and nested group for modification
+    template<class F>
+    void visit_members(F&& visit)
+    {
+        visit("elements", elements);
+        visit("elcomponents", elcomponents);
+        visit("materials", materials);
+    }
 };
 
 //---------------------------------------------------------------------------//
@@ -171,6 +189,14 @@ struct MaterialStateData
         element_scratch = other.element_scratch;
         return *this;
     }
+
+    //! Visit each collection and nested group
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("state", state);
+        visit("element_scratch", element_scratch);
+    }
 };
 
 //---------------------------------------------------------------------------//
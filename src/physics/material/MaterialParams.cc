@@ -124,6 +124,32 @@ MaterialParams::MaterialParams(const Input& inp)
     CELER_ENSURE(matnames_.size() == inp.materials.size());
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from data and names built elsewhere.
+ *
+ * This adopts data from another \c MaterialParams, e.g. one constructed on
+ * a different process, whose material names are unique.
+ */
+MaterialParams::MaterialParams(CollectionMirror<MaterialParamsData> data,
+                               std::vector<std::string>             elnames,
+                               std::vector<std::string>             matnames)
+    : elnames_(std::move(elnames))
+    , matnames_(std::move(matnames))
+    , data_(std::move(data))
+{
+    CELER_EXPECT(data_);
+    CELER_EXPECT(this->host_pointers().elements.size() == elnames_.size());
+    CELER_EXPECT(this->host_pointers().materials.size() == matnames_.size());
+
+    for (auto mat_id : range(MaterialId{matnames_.size()}))
+    {
+        auto iter_inserted
+            = matname_to_id_.insert({matnames_[mat_id.get()], mat_id});
+        CELER_ASSERT(iter_inserted.second);
+    }
+}
+
 //---------------------------------------------------------------------------//
 // IMPLEMENTATION
 //---------------------------------------------------------------------------//
@@ -70,6 +70,11 @@ class MaterialParams
     // Construct with a vector of material definitions
     explicit MaterialParams(const Input& inp);
 
+    // Construct from data and names built elsewhere
+    MaterialParams(CollectionMirror<MaterialParamsData> data,
+                   std::vector<std::string>             elnames,
+                   std::vector<std::string>             matnames);
+
     //! Number of material definitions
     MaterialId::size_type size() const { return matnames_.size(); }
 
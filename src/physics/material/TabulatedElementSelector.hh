@@ -0,0 +1,66 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TabulatedElementSelector.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "physics/base/Units.hh"
+#include "ElementTableInterface.hh"
+#include "Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Select an element of a material from precomputed tables.
+ *
+ * This is a drop-in replacement for \c ElementSelector for models whose
+ * tables were built by \c ElementTableBuilder. No per-track scratch space or
+ * cross section evaluation is needed: the energy is located on the tables'
+ * log grid, and the element is sampled from the alias table of the lower or
+ * upper grid point (chosen with probability proportional to the fractional
+ * distance, which interpolates the selection probabilities between the grid
+ * points). Energies outside the grid use the nearest table.
+ *
+ * \code
+    TabulatedElementSelector select_el(
+        shared.element_tables, material.material_id(), particle.energy());
+    ElementComponentId comp_id = select_el(rng);
+   \endcode
+ */
+class TabulatedElementSelector
+{
+  public:
+    //!@{
+    //! Type aliases
+    using Energy = units::MevEnergy;
+    using TableData
+        = ElementTableData<Ownership::const_reference, MemSpace::native>;
+    //!@}
+
+  public:
+    // Construct with tables, material, and incident energy
+    inline CELER_FUNCTION TabulatedElementSelector(const TableData& tables,
+                                                   MaterialId       material,
+                                                   Energy           energy);
+
+    // Sample with the given RNG
+    template<class Engine>
+    inline CELER_FUNCTION ElementComponentId operator()(Engine& rng) const;
+
+  private:
+    const TableData&            tables_;
+    const MaterialElementTable& table_;
+    size_type                   lower_idx_{0};
+    real_type                   frac_{0};
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "TabulatedElementSelector.i.hh"
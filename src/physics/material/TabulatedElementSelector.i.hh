@@ -0,0 +1,77 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TabulatedElementSelector.i.hh
+//---------------------------------------------------------------------------//
+
+#include <cmath>
+#include "base/Assert.hh"
+#include "physics/grid/NonuniformGrid.hh"
+#include "random/distributions/AliasDistribution.hh"
+#include "random/distributions/GenerateCanonical.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with tables, material, and incident energy.
+ */
+CELER_FUNCTION
+TabulatedElementSelector::TabulatedElementSelector(const TableData& tables,
+                                                   MaterialId       material,
+                                                   Energy           energy)
+    : tables_(tables), table_(tables.materials[material])
+{
+    CELER_EXPECT(table_);
+    CELER_EXPECT(energy > zero_quantity());
+    if (table_.num_elements == 1)
+        return;
+
+    const NonuniformGrid<real_type> loge_grid(
+        ItemRange<real_type>{ItemId<real_type>{0},
+                             ItemId<real_type>{tables.log_energy.size()}},
+        tables.log_energy);
+    const real_type loge = std::log(energy.value());
+    if (loge <= loge_grid.front())
+    {
+        lower_idx_ = 0;
+    }
+    else if (loge >= loge_grid.back())
+    {
+        lower_idx_ = loge_grid.size() - 1;
+    }
+    else
+    {
+        lower_idx_ = loge_grid.find(loge);
+        frac_      = (loge - loge_grid[lower_idx_])
+                / (loge_grid[lower_idx_ + 1] - loge_grid[lower_idx_]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample the element with the given RNG.
+ */
+template<class Engine>
+CELER_FUNCTION ElementComponentId
+TabulatedElementSelector::operator()(Engine& rng) const
+{
+    if (table_.num_elements == 1)
+        return ElementComponentId{0};
+
+    size_type idx = lower_idx_;
+    if (frac_ > 0 && generate_canonical(rng) < frac_)
+    {
+        ++idx;
+    }
+
+    const auto        entries = tables_.entries[table_.entries];
+    AliasDistribution sample_el(
+        entries.subspan(idx * table_.num_elements, table_.num_elements));
+    return ElementComponentId{sample_el(rng)};
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,100 @@
+//---------------------------------*-C++-*-----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BufferedRngEngine.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "random/distributions/GenerateCanonical.hh"
+#include "RngBufferInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Draw pregenerated uniform values for a track before using another engine.
+ *
+ * This adapter lets interactors and distributions consume random numbers that
+ * were generated in bulk at the start of a kernel pass (see \c
+ * generate_uniforms). Each call to \c generate_canonical returns the next
+ * buffered value for the track; once the track's buffer is exhausted, values
+ * are drawn directly from the fallback engine. Raw integer draws always use
+ * the fallback engine.
+ *
+ * \code
+    BufferedRngEngine<RngEngine> rng(buffer, tid, fallback_rng);
+    Interaction result = interact(rng);
+   \endcode
+ */
+template<class Engine>
+class BufferedRngEngine
+{
+  public:
+    //!@{
+    //! Type aliases
+    using result_type = typename Engine::result_type;
+    using BufferRef
+        = RngBufferData<Ownership::const_reference, MemSpace::native>;
+    //!@}
+
+  public:
+    // Construct with buffered values for a track and a fallback engine
+    inline CELER_FUNCTION
+    BufferedRngEngine(const BufferRef& buffer, ThreadId tid, Engine& fallback);
+
+    // Sample a random integer from the fallback engine
+    inline CELER_FUNCTION result_type operator()();
+
+    //! Number of buffered values consumed so far
+    CELER_FUNCTION size_type num_buffered() const { return index_; }
+
+    //! Number of values drawn from the fallback engine after the buffer ran out
+    CELER_FUNCTION size_type num_fallback() const { return num_fallback_; }
+
+    //!@{
+    //! Engine limits
+    static CELER_CONSTEXPR_FUNCTION result_type min() { return Engine::min(); }
+    static CELER_CONSTEXPR_FUNCTION result_type max() { return Engine::max(); }
+    //!@}
+
+  private:
+    const BufferRef& buffer_;
+    ThreadId         tid_;
+    Engine&          fallback_;
+    size_type        index_{0};
+    size_type        num_fallback_{0};
+
+    template<class Generator, class RealType>
+    friend class GenerateCanonical;
+
+    // Get the next value on [0, 1)
+    inline CELER_FUNCTION real_type next_canonical();
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Specialization of GenerateCanonical for BufferedRngEngine.
+ */
+template<class Engine, class RealType>
+class GenerateCanonical<BufferedRngEngine<Engine>, RealType>
+{
+  public:
+    //!@{
+    //! Type aliases
+    using real_type   = RealType;
+    using result_type = real_type;
+    //!@}
+
+  public:
+    // Sample a random number
+    inline CELER_FUNCTION result_type operator()(BufferedRngEngine<Engine>& rng);
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "BufferedRngEngine.i.hh"
@@ -0,0 +1,75 @@
+//---------------------------------*-C++-*-----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BufferedRngEngine.i.hh
+//---------------------------------------------------------------------------//
+
+#include "base/Assert.hh"
+#include "base/NumericLimits.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with buffered values for a track and a fallback engine.
+ */
+template<class Engine>
+CELER_FUNCTION
+BufferedRngEngine<Engine>::BufferedRngEngine(const BufferRef& buffer,
+                                             ThreadId         tid,
+                                             Engine&          fallback)
+    : buffer_(buffer), tid_(tid), fallback_(fallback)
+{
+    CELER_EXPECT(buffer_);
+    CELER_EXPECT(tid_ < buffer_.num_streams);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a random integer from the fallback engine.
+ */
+template<class Engine>
+CELER_FUNCTION auto BufferedRngEngine<Engine>::operator()() -> result_type
+{
+    return fallback_();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Get the next buffered value, or draw from the fallback engine.
+ */
+template<class Engine>
+CELER_FUNCTION real_type BufferedRngEngine<Engine>::next_canonical()
+{
+    if (index_ < buffer_.capacity)
+    {
+        using ItemIdT = ItemId<real_type>;
+        return buffer_.uniforms[ItemIdT{index_++ * buffer_.num_streams
+                                        + tid_.unchecked_get()}];
+    }
+    ++num_fallback_;
+    return generate_canonical<real_type>(fallback_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a random number on [0, 1).
+ *
+ * Narrowing to single precision can round values just below 1 up to 1, so
+ * the result is clamped to the largest representable value below 1.
+ */
+template<class Engine, class RealType>
+CELER_FUNCTION auto
+GenerateCanonical<BufferedRngEngine<Engine>, RealType>::operator()(
+    BufferedRngEngine<Engine>& rng) -> result_type
+{
+    constexpr result_type max_result
+        = 1 - numeric_limits<result_type>::epsilon() / 2;
+    const auto result = static_cast<result_type>(rng.next_canonical());
+    return result < max_result ? result : max_result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,109 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CountingRngEngine.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "random/distributions/GenerateCanonical.hh"
+#include "RngCounterInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Count the random draws made through another engine.
+ *
+ * This wraps a reference to an engine so that the cost of a sampling
+ * algorithm (e.g. the number of iterations of a rejection loop) can be
+ * measured in production without changing its implementation. Both raw
+ * integer draws and canonical samples count as one draw each. The count can
+ * be tallied into \c RngCounterData for the category of the sample.
+ *
+ * \code
+    CountingRngEngine<RngEngine> counting_rng(rng);
+    Interaction result = interact(counting_rng);
+    counting_rng.tally(counters, model_id.get());
+   \endcode
+ */
+template<class Engine>
+class CountingRngEngine
+{
+  public:
+    //!@{
+    //! Type aliases
+    using result_type = typename Engine::result_type;
+    using CounterRef  = RngCounterData<Ownership::reference, MemSpace::native>;
+    //!@}
+
+  public:
+    // Construct from the engine that generates the values
+    explicit inline CELER_FUNCTION CountingRngEngine(Engine& engine);
+
+    // Sample a random integer
+    inline CELER_FUNCTION result_type operator()();
+
+    //! Number of draws so far
+    CELER_FUNCTION size_type count() const { return count_; }
+
+    // Add the number of draws to the tallies for a category
+    inline CELER_FUNCTION void
+    tally(const CounterRef& counters, size_type category) const;
+
+    //!@{
+    //! Engine limits
+    static CELER_CONSTEXPR_FUNCTION result_type min() { return Engine::min(); }
+    static CELER_CONSTEXPR_FUNCTION result_type max() { return Engine::max(); }
+    //!@}
+
+  private:
+    Engine&   engine_;
+    size_type count_{0};
+
+    template<class Generator, class RealType>
+    friend class GenerateCanonical;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Specialization of GenerateCanonical for CountingRngEngine.
+ *
+ * This forwards to the wrapped engine's canonical sampling so that the values
+ * are unchanged by counting.
+ */
+template<class Engine, class RealType>
+class GenerateCanonical<CountingRngEngine<Engine>, RealType>
+{
+  public:
+    //!@{
+    //! Type aliases
+    using real_type   = RealType;
+    using result_type = real_type;
+    //!@}
+
+  public:
+    // Sample a random number
+    inline CELER_FUNCTION result_type
+    operator()(CountingRngEngine<Engine>& rng);
+};
+
+//---------------------------------------------------------------------------//
+// FREE FUNCTIONS
+//---------------------------------------------------------------------------//
+// Sample with an engine, tallying the draws if counters are assigned
+template<class F, class Engine>
+inline CELER_FUNCTION auto sample_counted(
+    F&&                                                   sample,
+    Engine&                                               rng,
+    const typename CountingRngEngine<Engine>::CounterRef& counters,
+    size_type                                             category)
+    -> decltype(sample(rng));
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "CountingRngEngine.i.hh"
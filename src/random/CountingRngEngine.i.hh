@@ -0,0 +1,99 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CountingRngEngine.i.hh
+//---------------------------------------------------------------------------//
+#include "base/Algorithms.hh"
+#include "base/Assert.hh"
+#include "base/Atomics.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from the engine that generates the values.
+ */
+template<class Engine>
+CELER_FUNCTION CountingRngEngine<Engine>::CountingRngEngine(Engine& engine)
+    : engine_(engine)
+{
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a random integer.
+ */
+template<class Engine>
+CELER_FUNCTION auto CountingRngEngine<Engine>::operator()() -> result_type
+{
+    ++count_;
+    return engine_();
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add the number of draws to the tallies for a category.
+ */
+template<class Engine>
+CELER_FUNCTION void
+CountingRngEngine<Engine>::tally(const CounterRef& counters,
+                                 size_type         category) const
+{
+    CELER_EXPECT(counters);
+    CELER_EXPECT(category < counters.num_categories());
+
+    using ItemIdT = ItemId<ull_int>;
+
+    // Samples with more draws than the histogram holds go in the last bin
+    const size_type bin   = celeritas::min(count_, counters.num_bins - 1);
+    const ull_int   draws = count_;
+
+    atomic_add(&counters.histogram[ItemIdT{category * counters.num_bins + bin}],
+               ull_int{1});
+    atomic_add(&counters.total[ItemIdT{category}], draws);
+    atomic_max(&counters.max[ItemIdT{category}], draws);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a random number with the wrapped engine.
+ */
+template<class Engine, class RealType>
+CELER_FUNCTION auto
+GenerateCanonical<CountingRngEngine<Engine>, RealType>::operator()(
+    CountingRngEngine<Engine>& rng) -> result_type
+{
+    ++rng.count_;
+    return generate_canonical<RealType>(rng.engine_);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample with an engine, tallying the draws if counters are assigned.
+ *
+ * The sampling function (e.g. an interactor) is called with the engine
+ * directly when counting is disabled, so the only cost is a branch.
+ */
+template<class F, class Engine>
+CELER_FUNCTION auto sample_counted(
+    F&&                                                   sample,
+    Engine&                                               rng,
+    const typename CountingRngEngine<Engine>::CounterRef& counters,
+    size_type                                             category)
+    -> decltype(sample(rng))
+{
+    if (!counters)
+    {
+        return sample(rng);
+    }
+
+    CountingRngEngine<Engine> counting_rng(rng);
+    auto                      result = sample(counting_rng);
+    counting_rng.tally(counters, category);
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
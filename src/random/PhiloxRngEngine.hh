@@ -0,0 +1,87 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file PhiloxRngEngine.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+#include "base/Macros.hh"
+#include "base/Types.hh"
+#include "random/distributions/GenerateCanonical.hh"
+#include "detail/Philox.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Generate random numbers from the event, track, and step being simulated.
+ *
+ * This stateless counter-based engine uses the Philox4x32-10 generator keyed
+ * by the run seed. Its stream is identified by the event, track, and step
+ * numbers rather than by the thread or track slot that happens to process the
+ * step, so the values a track draws don't depend on the launch order, the
+ * number of threads, or the number of track slots. A new engine should be
+ * constructed for each step of each track.
+ *
+ * The event, track, and step numbers must each fit in 32 bits.
+ *
+ * \code
+    PhiloxRngEngine rng(seed, event.get(), track.get(), num_steps);
+    Interaction result = interact(rng);
+   \endcode
+ */
+class PhiloxRngEngine
+{
+  public:
+    //!@{
+    //! Type aliases
+    using result_type = std::uint32_t;
+    //!@}
+
+  public:
+    // Construct from the run seed and the step being simulated
+    inline CELER_FUNCTION
+    PhiloxRngEngine(ull_int seed, ull_int event, ull_int track, ull_int step);
+
+    // Sample a random integer
+    inline CELER_FUNCTION result_type operator()();
+
+    //!@{
+    //! Engine limits
+    static CELER_CONSTEXPR_FUNCTION result_type min() { return 0u; }
+    static CELER_CONSTEXPR_FUNCTION result_type max() { return 0xffffffffu; }
+    //!@}
+
+  private:
+    detail::PhiloxKey     key_;
+    detail::PhiloxCounter ctr_;
+    detail::PhiloxCounter bits_;
+    unsigned int          index_;
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Specialization of GenerateCanonical for PhiloxRngEngine.
+ */
+template<class RealType>
+class GenerateCanonical<PhiloxRngEngine, RealType>
+{
+  public:
+    //!@{
+    //! Type aliases
+    using real_type   = RealType;
+    using result_type = real_type;
+    //!@}
+
+  public:
+    // Sample a random number
+    inline CELER_FUNCTION result_type operator()(PhiloxRngEngine& rng);
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "PhiloxRngEngine.i.hh"
@@ -0,0 +1,77 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file PhiloxRngEngine.i.hh
+//---------------------------------------------------------------------------//
+#include "base/Assert.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from the run seed and the step being simulated.
+ *
+ * The 64-bit seed is the Philox key. The counter holds the step, track, and
+ * event numbers, with the first word counting the blocks of four values
+ * generated so far.
+ */
+CELER_FUNCTION
+PhiloxRngEngine::PhiloxRngEngine(ull_int seed,
+                                 ull_int event,
+                                 ull_int track,
+                                 ull_int step)
+    : key_{static_cast<std::uint32_t>(seed),
+           static_cast<std::uint32_t>(seed >> 32)}
+    , ctr_{0u,
+           static_cast<std::uint32_t>(step),
+           static_cast<std::uint32_t>(track),
+           static_cast<std::uint32_t>(event)}
+    , bits_{0u, 0u, 0u, 0u}
+    , index_{4}
+{
+    CELER_EXPECT(event <= 0xffffffffull);
+    CELER_EXPECT(track <= 0xffffffffull);
+    CELER_EXPECT(step <= 0xffffffffull);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a random integer.
+ */
+CELER_FUNCTION auto PhiloxRngEngine::operator()() -> result_type
+{
+    if (index_ == 4)
+    {
+        bits_ = detail::philox4x32(ctr_, key_);
+        ++ctr_[0];
+        index_ = 0;
+    }
+    return bits_[index_++];
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a random number on [0, 1).
+ *
+ * Double precision values use two integer draws, with the same construction
+ * as the bulk uniform buffers, and single precision values use one.
+ */
+template<class RealType>
+CELER_FUNCTION auto
+GenerateCanonical<PhiloxRngEngine, RealType>::operator()(PhiloxRngEngine& rng)
+    -> result_type
+{
+    if (sizeof(RealType) == sizeof(float))
+    {
+        // 24 random bits are exactly representable
+        return static_cast<result_type>((rng() >> 8) * (1.0f / 16777216.0f));
+    }
+    const std::uint32_t a = rng();
+    const std::uint32_t b = rng();
+    return static_cast<result_type>(detail::uint32_pair_to_canonical(a, b));
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
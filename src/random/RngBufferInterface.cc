@@ -0,0 +1,88 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RngBufferInterface.cc
+//---------------------------------------------------------------------------//
+#include "RngBufferInterface.hh"
+
+#include "base/Assert.hh"
+#include "base/CollectionBuilder.hh"
+#include "detail/Philox.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate a buffer for the given number of tracks and values per track.
+ *
+ * The capacity is rounded up to an even number since each counter-based
+ * block produces a pair of values.
+ */
+void resize(RngBufferData<Ownership::value, MemSpace::host>* buffer,
+            size_type                                        num_streams,
+            size_type                                        capacity)
+{
+    CELER_EXPECT(buffer);
+    CELER_EXPECT(num_streams > 0);
+    CELER_EXPECT(capacity > 0);
+
+    buffer->num_streams = num_streams;
+    buffer->capacity    = capacity + capacity % 2;
+    make_builder(&buffer->uniforms).resize(num_streams * buffer->capacity);
+
+    CELER_ENSURE(*buffer);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Fill the buffer with counter-based random numbers on the host.
+ *
+ * Each value is a pure function of the seed, the pass number, the track index,
+ * and the position in the track's buffer, computed with the Philox4x32-10
+ * generator: the 64-bit seed is the key, and the counter is made of the track
+ * index, the pass number, and the block index. Refilling the buffer with a new
+ * pass number (e.g. the step count) therefore gives an independent set of
+ * values without any stored generator state, and the result is independent of
+ * the order or the number of threads used to fill it.
+ *
+ * The inner loop runs over tracks with a fixed block index so that it has no
+ * data dependencies between iterations and writes two contiguous rows of the
+ * buffer, which lets the compiler vectorize the generator.
+ */
+void generate_uniforms(
+    const RngBufferData<Ownership::reference, MemSpace::host>& buffer,
+    ull_int                                                    seed,
+    ull_int                                                    pass)
+{
+    CELER_EXPECT(buffer);
+    CELER_EXPECT(buffer.capacity % 2 == 0);
+
+    const detail::PhiloxKey key{static_cast<std::uint32_t>(seed),
+                                static_cast<std::uint32_t>(seed >> 32)};
+    const auto pass_lo = static_cast<std::uint32_t>(pass);
+    const auto pass_hi = static_cast<std::uint32_t>(pass >> 32);
+
+    const size_type n      = buffer.num_streams;
+    real_type*      values = buffer.uniforms[AllItems<real_type>{}].data();
+
+    for (size_type block = 0; block < buffer.capacity / 2; ++block)
+    {
+        real_type* first  = values + (2 * block) * n;
+        real_type* second = first + n;
+        for (size_type t = 0; t < n; ++t)
+        {
+            const detail::PhiloxCounter ctr{static_cast<std::uint32_t>(t),
+                                            pass_lo,
+                                            pass_hi,
+                                            static_cast<std::uint32_t>(block)};
+            const detail::PhiloxCounter bits = detail::philox4x32(ctr, key);
+            first[t]  = detail::uint32_pair_to_canonical(bits[0], bits[1]);
+            second[t] = detail::uint32_pair_to_canonical(bits[2], bits[3]);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,67 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RngBufferInterface.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Collection.hh"
+#include "base/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Pregenerated uniform random numbers for each track.
+ *
+ * The buffer holds \c capacity values on [0, 1) for each of \c num_streams
+ * tracks. Values are stored with the track index varying fastest, i.e. the
+ * k'th value for track t is at \c k * num_streams + t, so that bulk generation
+ * and consumption by adjacent threads both access contiguous memory.
+ */
+template<Ownership W, MemSpace M>
+struct RngBufferData
+{
+    //// DATA ////
+
+    size_type                   num_streams{}; //!< Number of tracks
+    size_type                   capacity{};    //!< Values per track
+    Collection<real_type, W, M> uniforms;
+
+    //// METHODS ////
+
+    //! True if assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return num_streams > 0 && capacity > 0
+               && uniforms.size() == num_streams * capacity;
+    }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    RngBufferData& operator=(RngBufferData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        num_streams = other.num_streams;
+        capacity    = other.capacity;
+        uniforms    = other.uniforms;
+        return *this;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// Allocate a buffer for the given number of tracks and values per track
+void resize(RngBufferData<Ownership::value, MemSpace::host>* buffer,
+            size_type                                        num_streams,
+            size_type                                        capacity);
+
+// Fill the buffer with counter-based random numbers on the host
+void generate_uniforms(
+    const RngBufferData<Ownership::reference, MemSpace::host>& buffer,
+    ull_int                                                    seed,
+    ull_int                                                    pass);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
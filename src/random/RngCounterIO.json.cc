@@ -0,0 +1,30 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RngCounterIO.json.cc
+//---------------------------------------------------------------------------//
+#include "RngCounterIO.json.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Write random draw statistics out to JSON.
+ */
+void to_json(nlohmann::json& j, const RngCounterStats& stats)
+{
+    j = nlohmann::json{
+        {"num_samples", stats.num_samples},
+        {"num_draws", stats.num_draws},
+        {"mean", stats.mean},
+        {"p50", stats.p50},
+        {"p90", stats.p90},
+        {"p99", stats.p99},
+        {"max", stats.max},
+    };
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
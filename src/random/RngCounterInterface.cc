@@ -0,0 +1,64 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RngCounterInterface.cc
+//---------------------------------------------------------------------------//
+#include "RngCounterInterface.hh"
+
+#include "base/Assert.hh"
+#include "base/Range.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Summarize the tallies of each category.
+ */
+std::vector<RngCounterStats> calc_rng_counter_stats(
+    const RngCounterData<Ownership::value, MemSpace::host>& data)
+{
+    CELER_EXPECT(data);
+    using ItemIdT = ItemId<ull_int>;
+
+    std::vector<RngCounterStats> result(data.num_categories());
+    for (auto cat : range(data.num_categories()))
+    {
+        RngCounterStats& stats = result[cat];
+        const auto       hist  = data.histogram[ItemRange<ull_int>(
+            ItemIdT(cat * data.num_bins), ItemIdT((cat + 1) * data.num_bins))];
+
+        for (ull_int count : hist)
+        {
+            stats.num_samples += count;
+        }
+        stats.num_draws = data.total[ItemIdT(cat)];
+        stats.max       = data.max[ItemIdT(cat)];
+        if (stats.num_samples == 0)
+            continue;
+        stats.mean = static_cast<double>(stats.num_draws) / stats.num_samples;
+
+        // Find the smallest draw count whose cumulative fraction of samples
+        // reaches each percentile
+        auto percentile = [&hist, &stats](double frac) -> size_type {
+            const double threshold  = frac * stats.num_samples;
+            ull_int      cumulative = 0;
+            for (auto bin : range(hist.size() - 1))
+            {
+                cumulative += hist[bin];
+                if (cumulative >= threshold)
+                    return bin;
+            }
+            // Overflow bin: report the exact maximum
+            return static_cast<size_type>(stats.max);
+        };
+        stats.p50 = percentile(0.5);
+        stats.p90 = percentile(0.9);
+        stats.p99 = percentile(0.99);
+    }
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
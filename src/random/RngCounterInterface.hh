@@ -0,0 +1,146 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file RngCounterInterface.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+#include "base/Collection.hh"
+#include "base/CollectionAlgorithms.hh"
+#include "base/CollectionBuilder.hh"
+#include "base/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Tallies of the number of random draws used by each sample.
+ *
+ * Samples are grouped into categories (e.g. one for each physics model). For
+ * each category, the histogram counts samples by the number of draws they
+ * used, with the last of the \c num_bins bins holding all samples with at
+ * least that many draws. The total and largest draw counts of each category
+ * are tallied exactly.
+ */
+template<Ownership W, MemSpace M>
+struct RngCounterData
+{
+    //// TYPES ////
+
+    template<class T>
+    using Items = Collection<T, W, M>;
+
+    //// DATA ////
+
+    size_type      num_bins{};
+    Items<ull_int> histogram; //!< Samples by draw count [category][bin]
+    Items<ull_int> total;     //!< Total draws [category]
+    Items<ull_int> max;       //!< Most draws in a single sample [category]
+
+    //// METHODS ////
+
+    //! True if assigned
+    explicit CELER_FUNCTION operator bool() const
+    {
+        return num_bins > 0 && !total.empty()
+               && histogram.size() == num_bins * total.size()
+               && max.size() == total.size();
+    }
+
+    //! Number of categories
+    CELER_FUNCTION size_type num_categories() const { return total.size(); }
+
+    //! Assign from another set of data
+    template<Ownership W2, MemSpace M2>
+    RngCounterData& operator=(RngCounterData<W2, M2>& other)
+    {
+        CELER_EXPECT(other);
+        num_bins  = other.num_bins;
+        histogram = other.histogram;
+        total     = other.total;
+        max       = other.max;
+        return *this;
+    }
+
+    //! Visit each collection and nested group
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("histogram", histogram);
+        visit("total", total);
+        visit("max", max);
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Summary of the random draws used by the samples in a category.
+ *
+ * Percentiles are exact unless they fall in the overflow bin of the
+ * histogram, in which case the largest draw count is reported.
+ */
+struct RngCounterStats
+{
+    ull_int   num_samples = 0; //!< Number of samples tallied
+    ull_int   num_draws   = 0; //!< Total random draws
+    double    mean        = 0; //!< Mean draws per sample
+    size_type p50         = 0; //!< Median draws per sample
+    size_type p90         = 0; //!< 90th percentile
+    size_type p99         = 0; //!< 99th percentile
+    ull_int   max         = 0; //!< Most draws in a single sample
+};
+
+//---------------------------------------------------------------------------//
+// Summarize the tallies of each category
+std::vector<RngCounterStats>
+calc_rng_counter_stats(const RngCounterData<Ownership::value, MemSpace::host>&);
+
+//---------------------------------------------------------------------------//
+/*!
+ * Allocate and zero the tallies.
+ */
+template<MemSpace M>
+inline void resize(RngCounterData<Ownership::value, M>* data,
+                   size_type                            num_categories,
+                   size_type                            num_bins)
+{
+    CELER_EXPECT(data);
+    CELER_EXPECT(num_categories > 0);
+    CELER_EXPECT(num_bins > 1);
+
+    data->num_bins = num_bins;
+    make_builder(&data->histogram).resize(num_categories * num_bins);
+    make_builder(&data->total).resize(num_categories);
+    make_builder(&data->max).resize(num_categories);
+    fill(ull_int(0), &data->histogram);
+    fill(ull_int(0), &data->total);
+    fill(ull_int(0), &data->max);
+
+    CELER_ENSURE(*data);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Copy the tallies to the host and summarize each category.
+ */
+template<Ownership W, MemSpace M>
+inline std::vector<RngCounterStats>
+calc_rng_counter_stats(const RngCounterData<W, M>& data)
+{
+    CELER_EXPECT(data);
+
+    RngCounterData<Ownership::value, MemSpace::host> host_data;
+    resize(&host_data, data.num_categories(), data.num_bins);
+    copy_to_host(data.histogram,
+                 host_data.histogram[AllItems<ull_int, MemSpace::host>{}]);
+    copy_to_host(data.total,
+                 host_data.total[AllItems<ull_int, MemSpace::host>{}]);
+    copy_to_host(data.max, host_data.max[AllItems<ull_int, MemSpace::host>{}]);
+    return calc_rng_counter_stats(host_data);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
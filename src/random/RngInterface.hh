@@ -138,6 +138,13 @@ struct RngStateData
         rng = other.rng;
         return *this;
     }
+
+    //! Visit each collection and nested group
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("rng", rng);
+    }
 };
 
 //---------------------------------------------------------------------------//
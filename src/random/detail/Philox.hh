@@ -0,0 +1,75 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file Philox.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <cstdint>
+#include "base/Array.hh"
+#include "base/Macros.hh"
+
+namespace celeritas
+{
+namespace detail
+{
+//---------------------------------------------------------------------------//
+//!@{
+//! Philox4x32 counter and key types
+using PhiloxCounter = Array<std::uint32_t, 4>;
+using PhiloxKey     = Array<std::uint32_t, 2>;
+//!@}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Philox4x32-10 counter-based random number generator.
+ *
+ * This is the bijection from Salmon et al., "Parallel random numbers: as easy
+ * as 1, 2, 3" (SC11), which is also the basis of the CURAND Philox engine. The
+ * output is a pure function of the counter and key, so independent streams
+ * can be generated in any order, and loops over many counters contain only
+ * 32-bit integer arithmetic that the compiler can vectorize.
+ */
+CELER_FUNCTION inline PhiloxCounter philox4x32(PhiloxCounter ctr,
+                                               PhiloxKey     key)
+{
+    constexpr std::uint64_t mult_0  = 0xD2511F53u;
+    constexpr std::uint64_t mult_1  = 0xCD9E8D57u;
+    constexpr std::uint32_t weyl_0  = 0x9E3779B9u;
+    constexpr std::uint32_t weyl_1  = 0xBB67AE85u;
+    constexpr int           nrounds = 10;
+
+    for (int r = 0; r < nrounds; ++r)
+    {
+        const std::uint64_t prod_0 = mult_0 * ctr[0];
+        const std::uint64_t prod_1 = mult_1 * ctr[2];
+        ctr = {static_cast<std::uint32_t>(prod_1 >> 32) ^ ctr[1] ^ key[0],
+               static_cast<std::uint32_t>(prod_1),
+               static_cast<std::uint32_t>(prod_0 >> 32) ^ ctr[3] ^ key[1],
+               static_cast<std::uint32_t>(prod_0)};
+        key[0] += weyl_0;
+        key[1] += weyl_1;
+    }
+    return ctr;
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Convert two 32-bit random integers to a double on [0, 1).
+ *
+ * This uses the same 27 + 26 bit construction as \c genrand_res53 from the
+ * reference Mersenne twister, which needs only 32-bit integer conversions.
+ */
+CELER_CONSTEXPR_FUNCTION double
+uint32_pair_to_canonical(std::uint32_t a, std::uint32_t b)
+{
+    return (static_cast<std::int32_t>(a >> 5) * 67108864.0
+            + static_cast<std::int32_t>(b >> 6))
+           * (1.0 / 9007199254740992.0);
+}
+
+//---------------------------------------------------------------------------//
+} // namespace detail
+} // namespace celeritas
@@ -0,0 +1,59 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AliasDistribution.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Macros.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "AliasTableInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a discrete index from an alias table in constant time.
+ *
+ * Unlike \c Selector, which accumulates weights until the sampled value is
+ * exceeded, this uses a table precomputed by \c AliasTableBuilder so that
+ * each sample costs a single random number and one table lookup regardless
+ * of the number of bins. The bin index and the acceptance test are both
+ * taken from the same canonical random number.
+ *
+ * \code
+    AliasDistribution sample_transition(entries[shell.alias]);
+    size_type idx = sample_transition(rng);
+   \endcode
+ */
+class AliasDistribution
+{
+  public:
+    //!@{
+    //! Type aliases
+    using result_type    = size_type;
+    using SpanConstEntry = Span<const AliasTableEntry>;
+    //!@}
+
+  public:
+    // Construct from an alias table
+    explicit inline CELER_FUNCTION AliasDistribution(SpanConstEntry table);
+
+    // Sample a bin index
+    template<class Generator>
+    inline CELER_FUNCTION result_type operator()(Generator& rng);
+
+    //! Number of bins in the table
+    CELER_FUNCTION size_type size() const { return table_.size(); }
+
+  private:
+    SpanConstEntry table_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
+
+#include "AliasDistribution.i.hh"
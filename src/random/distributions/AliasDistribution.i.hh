@@ -0,0 +1,42 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AliasDistribution.i.hh
+//---------------------------------------------------------------------------//
+
+#include "base/Algorithms.hh"
+#include "base/Assert.hh"
+#include "GenerateCanonical.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct from an alias table.
+ */
+CELER_FUNCTION AliasDistribution::AliasDistribution(SpanConstEntry table)
+    : table_(table)
+{
+    CELER_EXPECT(!table_.empty());
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Sample a bin index.
+ */
+template<class Generator>
+CELER_FUNCTION auto AliasDistribution::operator()(Generator& rng)
+    -> result_type
+{
+    real_type scaled = generate_canonical(rng) * table_.size();
+    // Guard against roundoff when the canonical value is near one
+    size_type idx = celeritas::min(static_cast<size_type>(scaled),
+                                   static_cast<size_type>(table_.size() - 1));
+    const AliasTableEntry& entry = table_[idx];
+    return (scaled - idx < entry.probability) ? idx : entry.alias;
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
@@ -0,0 +1,85 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AliasTableBuilder.cc
+//---------------------------------------------------------------------------//
+#include "AliasTableBuilder.hh"
+
+#include <numeric>
+#include "base/Assert.hh"
+#include "base/Range.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct with a reference to mutable host data.
+ */
+AliasTableBuilder::AliasTableBuilder(EntryCollection* entries)
+    : entries_(entries)
+{
+    CELER_EXPECT(entries);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Add an alias table for the given unnormalized weights.
+ *
+ * Weights are scaled so that their mean is unity. Bins with less than the
+ * mean ("small") are filled in by the excess of bins with more than the mean
+ * ("large") until all bins are full. Bins left over due to roundoff are
+ * assigned a probability of one.
+ */
+AliasTableData AliasTableBuilder::operator()(SpanConstReal weights)
+{
+    CELER_EXPECT(!weights.empty());
+
+    const real_type total
+        = std::accumulate(weights.begin(), weights.end(), real_type(0));
+    CELER_EXPECT(total > 0);
+    const real_type norm = weights.size() / total;
+
+    table_.resize(weights.size());
+    small_.clear();
+    large_.clear();
+    for (auto i : range(weights.size()))
+    {
+        CELER_EXPECT(weights[i] >= 0);
+        table_[i].probability = weights[i] * norm;
+        table_[i].alias       = i;
+        if (table_[i].probability < 1)
+            small_.push_back(i);
+        else
+            large_.push_back(i);
+    }
+
+    while (!small_.empty() && !large_.empty())
+    {
+        size_type s = small_.back();
+        small_.pop_back();
+        size_type l = large_.back();
+
+        // Fill the remainder of the small bin with the large one
+        table_[s].alias = l;
+        real_type& p_large = table_[l].probability;
+        p_large            = (p_large + table_[s].probability) - 1;
+        if (p_large < 1)
+        {
+            large_.pop_back();
+            small_.push_back(l);
+        }
+    }
+
+    // Remaining bins are full to within roundoff
+    for (size_type i : small_)
+        table_[i].probability = 1;
+    for (size_type i : large_)
+        table_[i].probability = 1;
+
+    return entries_.insert_back(table_.begin(), table_.end());
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
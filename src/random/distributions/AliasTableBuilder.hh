@@ -0,0 +1,60 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AliasTableBuilder.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+#include "base/Collection.hh"
+#include "base/CollectionBuilder.hh"
+#include "base/Span.hh"
+#include "base/Types.hh"
+#include "AliasTableInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Construct alias tables from discrete weights.
+ *
+ * Tables are appended to a host collection using Vose's algorithm, which
+ * runs in linear time. The resulting range can be sampled with an \c
+ * AliasDistribution in constant time.
+ *
+ * \code
+    AliasTableBuilder build_table(&data.host.alias_entries);
+    AliasTableData table = build_table(make_span(weights));
+   \endcode
+ */
+class AliasTableBuilder
+{
+  public:
+    //!@{
+    //! Type aliases
+    using EntryCollection
+        = Collection<AliasTableEntry, Ownership::value, MemSpace::host>;
+    using SpanConstReal = Span<const real_type>;
+    //!@}
+
+  public:
+    // Construct with a reference to mutable host data
+    explicit AliasTableBuilder(EntryCollection* entries);
+
+    // Add an alias table for the given unnormalized weights
+    AliasTableData operator()(SpanConstReal weights);
+
+  private:
+    CollectionBuilder<AliasTableEntry, MemSpace::host, ItemId<AliasTableEntry>>
+        entries_;
+
+    // Scratch space
+    std::vector<AliasTableEntry> table_;
+    std::vector<size_type>       small_;
+    std::vector<size_type>       large_;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
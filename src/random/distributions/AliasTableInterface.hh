@@ -0,0 +1,33 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AliasTableInterface.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include "base/Collection.hh"
+#include "base/Types.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Single bin of a Walker/Vose alias table.
+ *
+ * Bin \em i is selected with probability \c probability and otherwise
+ * redirects to bin \c alias.
+ */
+struct AliasTableEntry
+{
+    real_type probability; //!< Chance of keeping this bin [0, 1]
+    size_type alias;       //!< Index of the alternate bin
+};
+
+//---------------------------------------------------------------------------//
+//! Contiguous alias table stored in a Collection
+using AliasTableData = ItemRange<AliasTableEntry>;
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
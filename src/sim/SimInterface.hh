@@ -63,6 +63,13 @@ struct SimStateData
         state = other.state;
         return *this;
     }
+
+    //! Visit each collection and nested group
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("state", state);
+    }
 };
 
 //---------------------------------------------------------------------------//
@@ -24,7 +24,8 @@ namespace celeritas
  * There is no persistent data needed on device. Primaries are copied to device
  * only when they are needed to initialize new tracks and are not stored on
  * device. \c storage_factor is only used at construction to allocate memory
- * for track initializers and parent track IDs.
+ * for track initializers and parent track IDs. Initializers in excess of the
+ * resulting capacity can be buffered on host with a \c TrackInitOverflow.
  */
 template<Ownership W, MemSpace M>
 struct TrackInitParamsData;
@@ -0,0 +1,134 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TrackInitOverflow.cc
+//---------------------------------------------------------------------------//
+#include "TrackInitOverflow.hh"
+
+#include "base/Algorithms.hh"
+#include "base/CollectionBuilder.hh"
+#include "base/detail/Copier.hh"
+
+namespace celeritas
+{
+namespace
+{
+//---------------------------------------------------------------------------//
+template<MemSpace M>
+using InitCollection = StateCollection<TrackInitializer, Ownership::value, M>;
+using InitRange      = InitCollection<MemSpace::host>::ItemRangeT;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move a contiguous range of initializers within the storage.
+ *
+ * The source and destination may overlap, so the data is staged through a
+ * temporary buffer in the same memory space.
+ */
+template<MemSpace M>
+void move_initializers(InitCollection<M>* storage,
+                       size_type          src,
+                       size_type          dst,
+                       size_type          count)
+{
+    if (count == 0 || src == dst)
+        return;
+
+    InitCollection<M> temp;
+    make_builder(&temp).resize(count);
+    auto temp_span = temp[AllItems<TrackInitializer, M>{}];
+
+    detail::Copier<TrackInitializer, M> copy_to_temp{
+        (*storage)[InitRange{ThreadId{src}, ThreadId{src + count}}]};
+    copy_to_temp(M, temp_span);
+
+    detail::Copier<TrackInitializer, M> copy_from_temp{temp_span};
+    copy_from_temp(M,
+                   (*storage)[InitRange{ThreadId{dst}, ThreadId{dst + count}}]);
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move the given number of initializers from the bottom of the stack.
+ *
+ * The initializers are appended to the host buffer and the remaining
+ * initializers are shifted to the bottom of the storage.
+ */
+template<MemSpace M>
+void TrackInitOverflow::spill(size_type                 count,
+                              ResizableInitializers<M>* initializers)
+{
+    CELER_EXPECT(initializers && *initializers);
+    CELER_EXPECT(count <= initializers->size());
+
+    if (count == 0)
+        return;
+
+    // Copy the bottom of the stack to the top of the host buffer
+    const size_type start = buffer_.size();
+    buffer_.resize(start + count);
+    detail::Copier<TrackInitializer, M> copy_to_host{
+        initializers->storage[InitRange{ThreadId{0}, ThreadId{count}}]};
+    copy_to_host(MemSpace::host, make_span(buffer_).subspan(start, count));
+    max_size_ = max(max_size_, this->size());
+
+    // Shift the remaining initializers down
+    const size_type remaining = initializers->size() - count;
+    move_initializers(&initializers->storage, count, 0, remaining);
+    initializers->resize(remaining);
+}
+
+//---------------------------------------------------------------------------//
+/*!
+ * Move as many buffered initializers as will fit back under the stack.
+ *
+ * The existing initializers are shifted up to make room, and the most
+ * recently spilled initializers are restored to the bottom of the storage.
+ * The number of restored initializers is returned.
+ */
+template<MemSpace M>
+size_type TrackInitOverflow::restore(ResizableInitializers<M>* initializers)
+{
+    CELER_EXPECT(initializers && *initializers);
+
+    const size_type count = min(
+        initializers->capacity() - initializers->size(), this->size());
+    if (count == 0)
+        return 0;
+
+    // Shift the existing initializers up
+    const size_type existing = initializers->size();
+    initializers->resize(existing + count);
+    move_initializers(&initializers->storage, 0, count, existing);
+
+    // Copy the top of the host buffer to the bottom of the stack
+    const size_type start = buffer_.size() - count;
+    detail::Copier<TrackInitializer, MemSpace::host> copy_from_host{
+        make_span(buffer_).subspan(start, count)};
+    copy_from_host(
+        M, initializers->storage[InitRange{ThreadId{0}, ThreadId{count}}]);
+    buffer_.resize(start);
+
+    return count;
+}
+
+//---------------------------------------------------------------------------//
+// EXPLICIT INSTANTIATION
+//---------------------------------------------------------------------------//
+
+template void
+TrackInitOverflow::spill<MemSpace::host>(size_type,
+                                         ResizableInitializers<MemSpace::host>*);
+template void TrackInitOverflow::spill<MemSpace::device>(
+    size_type, ResizableInitializers<MemSpace::device>*);
+
+template size_type TrackInitOverflow::restore<MemSpace::host>(
+    ResizableInitializers<MemSpace::host>*);
+template size_type TrackInitOverflow::restore<MemSpace::device>(
+    ResizableInitializers<MemSpace::device>*);
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
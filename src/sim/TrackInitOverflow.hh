@@ -0,0 +1,65 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TrackInitOverflow.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+#include "base/Types.hh"
+#include "TrackInitInterface.hh"
+
+namespace celeritas
+{
+//---------------------------------------------------------------------------//
+/*!
+ * Host buffer for track initializers that do not fit in the state storage.
+ *
+ * The initializers in \c TrackInitStateData form a stack whose top (back) is
+ * consumed first and whose top elements may correspond to parent tracks. The
+ * overflow buffer acts as an extension of the *bottom* of that stack: \c spill
+ * moves the bottommost (oldest) initializers onto the top of the host buffer,
+ * and \c restore moves them back underneath the remaining initializers as
+ * room becomes available. The overall order of the initializers, and thus the
+ * order in which tracks are initialized, is unchanged by spilling.
+ *
+ * The memory space of the initializer storage is a template parameter so that
+ * host storage can stand in for device memory in testing.
+ */
+class TrackInitOverflow
+{
+  public:
+    //!@{
+    //! Type aliases
+    template<MemSpace M>
+    using ResizableInitializers
+        = ResizableData<TrackInitializer, Ownership::value, M>;
+    //!@}
+
+  public:
+    // Move the given number of initializers from the bottom of the stack
+    template<MemSpace M>
+    void spill(size_type count, ResizableInitializers<M>* initializers);
+
+    // Move as many spilled initializers as will fit back under the stack
+    template<MemSpace M>
+    size_type restore(ResizableInitializers<M>* initializers);
+
+    //! Number of initializers currently buffered
+    size_type size() const { return buffer_.size(); }
+
+    //! Whether no initializers are buffered
+    bool empty() const { return buffer_.empty(); }
+
+    //! Largest number of initializers buffered at once
+    size_type max_size() const { return max_size_; }
+
+  private:
+    std::vector<TrackInitializer> buffer_;
+    size_type                     max_size_ = 0;
+};
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas
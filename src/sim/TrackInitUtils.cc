@@ -102,10 +102,16 @@ void extend_from_primaries(const TrackInitParamsHostRef& params,
    vacancies          | 1  4
 
    \endverbatim
+ *
+ * If the new secondaries don't fit in the remaining initializer storage and
+ * an overflow buffer is provided, the oldest initializers are spilled to the
+ * host to make room. It is an error if the secondaries alone exceed the
+ * capacity.
  */
 void extend_from_secondaries(const ParamsDeviceRef&   params,
                              const StateDeviceRef&    states,
-                             TrackInitStateDeviceVal* data)
+                             TrackInitStateDeviceVal* data,
+                             TrackInitOverflow*       overflow)
 {
     CELER_EXPECT(params);
     CELER_EXPECT(states);
@@ -124,10 +130,18 @@ void extend_from_secondaries(const ParamsDeviceRef&   params,
     data->vacancies.resize(num_vac);
 
     // Sum the total number secondaries produced in all interactions
-    // TODO: if we don't have space for all the secondaries, we will need to
-    // buffer the current track initializers to create room
     size_type num_secondaries = detail::reduce_counts(
         data->secondary_counts[AllItems<size_type, MemSpace::device>{}]);
+    if (overflow
+        && num_secondaries + data->initializers.size()
+               > data->initializers.capacity())
+    {
+        // Buffer the oldest track initializers on host to create room
+        size_type excess = num_secondaries + data->initializers.size()
+                           - data->initializers.capacity();
+        overflow->spill(min(excess, data->initializers.size()),
+                        &data->initializers);
+    }
     CELER_VALIDATE(num_secondaries + data->initializers.size()
                        <= data->initializers.capacity(),
                    << "insufficient capacity (" << data->initializers.capacity()
@@ -157,15 +171,24 @@ void extend_from_secondaries(const ParamsDeviceRef&   params,
  * state copied over from the parent instead of initialized from the position.
  * If there are more empty slots than new secondaries, they will be filled by
  * any track initializers remaining from previous steps using the position.
+ * If there are more empty slots than initializers, initializers that were
+ * spilled to the overflow buffer are first restored.
  */
 void initialize_tracks(const ParamsDeviceRef&   params,
                        const StateDeviceRef&    states,
-                       TrackInitStateDeviceVal* data)
+                       TrackInitStateDeviceVal* data,
+                       TrackInitOverflow*       overflow)
 {
     CELER_EXPECT(params);
     CELER_EXPECT(states);
     CELER_EXPECT(data && *data);
 
+    if (overflow && data->vacancies.size() > data->initializers.size())
+    {
+        // Stream back buffered initializers now that there is room
+        overflow->restore(&data->initializers);
+    }
+
     // The number of new tracks to initialize is the smaller of the number of
     // empty slots in the track vector and the number of track initializers
     size_type num_tracks
@@ -8,6 +8,7 @@
 #pragma once
 
 #include "sim/TrackInitInterface.hh"
+#include "sim/TrackInitOverflow.hh"
 #include "sim/TrackInterface.hh"
 
 namespace celeritas
@@ -22,12 +23,14 @@ void extend_from_primaries(const TrackInitParamsHostRef& params,
 // Create track initializers on device from secondary particles.
 void extend_from_secondaries(const ParamsDeviceRef&   params,
                              const StateDeviceRef&    states,
-                             TrackInitStateDeviceVal* data);
+                             TrackInitStateDeviceVal* data,
+                             TrackInitOverflow*       overflow = nullptr);
 
 // Initialize track states on device.
 void initialize_tracks(const ParamsDeviceRef&   params,
                        const StateDeviceRef&    states,
-                       TrackInitStateDeviceVal* data);
+                       TrackInitStateDeviceVal* data,
+                       TrackInitOverflow*       overflow = nullptr);
 
 //---------------------------------------------------------------------------//
 } // namespace celeritas
@@ -8,6 +8,7 @@
 #include "base/Algorithms.hh"
 
 #include <algorithm>
+#include <cmath>
 #include "celeritas_test.hh"
 
 //---------------------------------------------------------------------------//
@@ -61,3 +62,38 @@ TEST(AlgorithmsTest, lower_bound)
         }
     }
 }
+
+TEST(AlgorithmsTest, fast_log)
+{
+    using celeritas::fast_log;
+
+    EXPECT_EQ(0.0, fast_log(1.0));
+    EXPECT_DOUBLE_EQ(std::log(2.0), fast_log(2.0));
+    EXPECT_DOUBLE_EQ(std::log(0.5), fast_log(0.5));
+    EXPECT_DOUBLE_EQ(std::log(1e-300), fast_log(1e-300));
+    EXPECT_DOUBLE_EQ(std::log(1e300), fast_log(1e300));
+
+    // Check documented error bounds over a wide range of magnitudes
+    double max_abs_err = 0;
+    double max_rel_err = 0;
+    for (double x = 1e-200; x < 1e200; x *= 1.0123)
+    {
+        double expected = std::log(x);
+        double err      = std::fabs(fast_log(x) - expected);
+        if (x > 0.5 && x < 2)
+        {
+            max_abs_err = std::max(max_abs_err, err);
+        }
+        else
+        {
+            max_rel_err = std::max(max_rel_err, err / std::fabs(expected));
+        }
+    }
+    for (double x = 0.5; x < 2; x += 1e-4)
+    {
+        max_abs_err
+            = std::max(max_abs_err, std::fabs(fast_log(x) - std::log(x)));
+    }
+    EXPECT_LT(max_abs_err, 2e-16);
+    EXPECT_LT(max_rel_err, 3e-16);
+}
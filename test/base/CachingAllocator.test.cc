@@ -0,0 +1,145 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CachingAllocator.test.cc
+//---------------------------------------------------------------------------//
+#include "base/CachingAllocator.hh"
+
+#include <sstream>
+#include "celeritas_test.hh"
+
+using celeritas::CachingAllocator;
+using celeritas::MemSpace;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class CachingAllocatorTest : public celeritas::Test
+{
+  protected:
+    CachingAllocator::Options small_options() const
+    {
+        CachingAllocator::Options opts;
+        opts.min_bin_bytes = 16;
+        opts.max_bin_bytes = 1024;
+        return opts;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(CachingAllocatorTest, reuse)
+{
+    CachingAllocator alloc(MemSpace::host, this->small_options());
+    EXPECT_EQ(MemSpace::host, alloc.memspace());
+
+    // Zero-size requests aren't allocated
+    EXPECT_EQ(nullptr, alloc.allocate(0));
+    alloc.deallocate(nullptr);
+    EXPECT_EQ(0, alloc.stats().num_misses);
+
+    // First allocation is a miss and is rounded up to a size class
+    void* a = alloc.allocate(100);
+    ASSERT_NE(nullptr, a);
+    auto stats = alloc.stats();
+    EXPECT_EQ(0, stats.num_hits);
+    EXPECT_EQ(1, stats.num_misses);
+    EXPECT_EQ(128, stats.bytes_in_use);
+    EXPECT_EQ(0, stats.bytes_cached);
+    EXPECT_EQ(128, stats.peak_bytes);
+
+    // Freeing returns the block to the cache
+    alloc.deallocate(a);
+    stats = alloc.stats();
+    EXPECT_EQ(0, stats.bytes_in_use);
+    EXPECT_EQ(128, stats.bytes_cached);
+
+    // Same size class reuses the block
+    void* b = alloc.allocate(65);
+    EXPECT_EQ(a, b);
+    stats = alloc.stats();
+    EXPECT_EQ(1, stats.num_hits);
+    EXPECT_EQ(1, stats.num_misses);
+    EXPECT_EQ(128, stats.bytes_in_use);
+    EXPECT_EQ(0, stats.bytes_cached);
+
+    // Different size class is a miss
+    void* c = alloc.allocate(10);
+    ASSERT_NE(nullptr, c);
+    EXPECT_NE(b, c);
+    stats = alloc.stats();
+    EXPECT_EQ(2, stats.num_misses);
+    EXPECT_EQ(128 + 16, stats.bytes_in_use);
+    EXPECT_EQ(128 + 16, stats.peak_bytes);
+
+    alloc.deallocate(b);
+    alloc.deallocate(c);
+    EXPECT_EQ(128 + 16, alloc.stats().bytes_cached);
+
+    // Release cache; high-water mark is unchanged
+    alloc.release_cached();
+    stats = alloc.stats();
+    EXPECT_EQ(0, stats.bytes_in_use);
+    EXPECT_EQ(0, stats.bytes_cached);
+    EXPECT_EQ(128 + 16, stats.peak_bytes);
+
+    // Writing to a block should be valid
+    auto* data = static_cast<char*>(alloc.allocate(32));
+    data[0]    = 'a';
+    data[31]   = 'z';
+    alloc.deallocate(data);
+
+    // Unknown pointers are rejected
+    int not_allocated = 0;
+    EXPECT_THROW(alloc.deallocate(&not_allocated), celeritas::RuntimeError);
+}
+
+TEST_F(CachingAllocatorTest, large)
+{
+    CachingAllocator alloc(MemSpace::host, this->small_options());
+
+    // Requests above the largest size class are exact and uncached
+    void* a = alloc.allocate(2000);
+    auto stats = alloc.stats();
+    EXPECT_EQ(2000, stats.bytes_in_use);
+    EXPECT_EQ(2000, stats.peak_bytes);
+    alloc.deallocate(a);
+    stats = alloc.stats();
+    EXPECT_EQ(0, stats.bytes_in_use);
+    EXPECT_EQ(0, stats.bytes_cached);
+
+    alloc.allocate(2000);
+    EXPECT_EQ(2, alloc.stats().num_misses);
+    EXPECT_EQ(0, alloc.stats().num_hits);
+}
+
+TEST_F(CachingAllocatorTest, disabled)
+{
+    auto opts    = this->small_options();
+    opts.caching = false;
+    CachingAllocator alloc(MemSpace::host, opts);
+    EXPECT_FALSE(alloc.options().caching);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        void* a = alloc.allocate(100);
+        alloc.deallocate(a);
+    }
+    auto stats = alloc.stats();
+    EXPECT_EQ(0, stats.num_hits);
+    EXPECT_EQ(3, stats.num_misses);
+    EXPECT_EQ(0, stats.bytes_cached);
+    EXPECT_EQ(128, stats.peak_bytes);
+
+    std::ostringstream os;
+    os << stats;
+    EXPECT_EQ(
+        "CachingAllocatorStats{num_hits=0, num_misses=3, bytes_in_use=0, "
+        "bytes_cached=0, peak_bytes=128}",
+        os.str());
+}
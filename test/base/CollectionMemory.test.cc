@@ -0,0 +1,103 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CollectionMemory.test.cc
+//---------------------------------------------------------------------------//
+#include "base/CollectionMemory.hh"
+
+#include "base/CollectionBuilder.hh"
+#include "base/StackAllocatorInterface.hh"
+#include "celeritas_config.h"
+#if CELERITAS_USE_JSON
+#    include "base/CollectionMemoryIO.json.hh"
+#endif
+
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+
+namespace
+{
+//---------------------------------------------------------------------------//
+template<Ownership W, MemSpace M>
+struct MockStateData
+{
+    Collection<double, W, M>      values;
+    StackAllocatorData<int, W, M> stack;
+    unsigned int                  num_ignored = 0;
+
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("values", values);
+        visit("stack", stack);
+    }
+};
+} // namespace
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class CollectionMemoryTest : public celeritas::Test
+{
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(CollectionMemoryTest, empty)
+{
+    CollectionMemory mem;
+    EXPECT_EQ(0, mem.entries().size());
+    EXPECT_EQ(0, mem.total_bytes());
+}
+
+TEST_F(CollectionMemoryTest, group)
+{
+    MockStateData<Ownership::value, MemSpace::host> state;
+    make_builder(&state.values).resize(10);
+    resize(&state.stack, 4);
+
+    CollectionMemory mem;
+    mem("state", state);
+    mem("extra", state.values);
+
+    const auto& entries = mem.entries();
+    ASSERT_EQ(6, entries.size());
+    EXPECT_EQ("state.values", entries[0].name);
+    EXPECT_EQ(10, entries[0].size);
+    EXPECT_EQ(10 * sizeof(double), entries[0].bytes);
+    EXPECT_EQ("state.stack.storage", entries[1].name);
+    EXPECT_EQ(4 * sizeof(int), entries[1].bytes);
+    EXPECT_EQ("state.stack.size", entries[2].name);
+    EXPECT_EQ(sizeof(size_type), entries[2].bytes);
+    EXPECT_EQ("state.stack.region_size", entries[4].name);
+    EXPECT_EQ(0, entries[4].bytes);
+    EXPECT_EQ("extra", entries[5].name);
+    EXPECT_EQ(MemSpace::host, entries[5].memspace);
+
+    const std::size_t expected
+        = 20 * sizeof(double) + 4 * sizeof(int) + sizeof(size_type);
+    EXPECT_EQ(expected, mem.total_bytes());
+    EXPECT_EQ(expected, mem.total_bytes(MemSpace::host));
+    EXPECT_EQ(0, mem.total_bytes(MemSpace::device));
+
+    // References report the size of the referenced data
+    MockStateData<Ownership::reference, MemSpace::host> ref;
+    ref.values = state.values;
+    CollectionMemory ref_mem;
+    ref_mem("ref", ref);
+    EXPECT_EQ(10 * sizeof(double), ref_mem.total_bytes());
+
+#if CELERITAS_USE_JSON
+    nlohmann::json j = mem;
+    EXPECT_EQ(expected, j.at("total_bytes").get<std::size_t>());
+    EXPECT_EQ(0, j.at("device_bytes").get<std::size_t>());
+    ASSERT_EQ(6, j.at("members").size());
+    EXPECT_EQ("host", j["members"][0].at("memspace").get<std::string>());
+#endif
+}
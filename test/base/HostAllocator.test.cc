@@ -0,0 +1,119 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file HostAllocator.test.cc
+//---------------------------------------------------------------------------//
+#include "base/HostAllocator.hh"
+
+#include <cstdint>
+#include <vector>
+#include "base/Collection.hh"
+#include "base/CollectionBuilder.hh"
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+
+namespace
+{
+bool is_aligned(const void* ptr, std::size_t alignment)
+{
+    return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+}
+} // namespace
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class HostAllocatorTest : public celeritas::Test
+{
+  protected:
+    void SetUp() override { saved_ = host_storage_options(); }
+    void TearDown() override { host_storage_options() = saved_; }
+
+  private:
+    HostStorageOptions saved_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(HostAllocatorTest, allocate)
+{
+    EXPECT_EQ(nullptr, host_allocate(0));
+    host_deallocate(nullptr);
+
+    for (std::size_t bytes : {1, 3, 64, 100, 4097})
+    {
+        void* ptr = host_allocate(bytes);
+        ASSERT_NE(nullptr, ptr);
+        EXPECT_TRUE(is_aligned(ptr, host_alignment)) << "bytes=" << bytes;
+        host_deallocate(ptr);
+    }
+}
+
+TEST_F(HostAllocatorTest, large)
+{
+    auto& opts             = host_storage_options();
+    opts.huge_page_bytes   = 1 << 16;
+    opts.first_touch_bytes = 1 << 17;
+
+    // Huge-page allocations are aligned to the page size and padded
+    for (std::size_t bytes : {(1 << 16) - 1, 1 << 16, (1 << 17) + 3})
+    {
+        char* ptr = static_cast<char*>(host_allocate(bytes));
+        ASSERT_NE(nullptr, ptr);
+        EXPECT_EQ(bytes >= opts.huge_page_bytes,
+                  is_aligned(ptr, opts.huge_page_bytes))
+            << "bytes=" << bytes;
+        // Whole allocation is writable
+        ptr[0]         = 1;
+        ptr[bytes - 1] = 2;
+        host_deallocate(ptr);
+    }
+
+    // Disabled policies still give aligned memory
+    opts.huge_page_bytes   = 0;
+    opts.first_touch_bytes = 0;
+    void* ptr              = host_allocate(1 << 20);
+    EXPECT_TRUE(is_aligned(ptr, host_alignment));
+    host_deallocate(ptr);
+}
+
+TEST_F(HostAllocatorTest, vector)
+{
+    std::vector<double, HostAllocator<double>> vec;
+    for (int i = 0; i < 1000; ++i)
+    {
+        vec.push_back(i);
+        EXPECT_TRUE(is_aligned(vec.data(), host_alignment));
+    }
+    EXPECT_EQ(999.0, vec.back());
+
+    std::vector<char, HostAllocator<char>> other(vec.begin(), vec.end());
+    EXPECT_TRUE(is_aligned(other.data(), host_alignment));
+    EXPECT_EQ(1000, other.size());
+    EXPECT_TRUE(vec.get_allocator() == other.get_allocator());
+}
+
+TEST_F(HostAllocatorTest, collection)
+{
+    // Value-initialized state data large enough to be first-touched
+    host_storage_options().first_touch_bytes = 1 << 12;
+
+    Collection<real_type, Ownership::value, MemSpace::host> values;
+    make_builder(&values).resize(10000);
+    auto data = values[AllItems<real_type>{}];
+    EXPECT_TRUE(is_aligned(data.data(), host_alignment));
+    EXPECT_EQ(0, data.front());
+    EXPECT_EQ(0, data.back());
+
+    // Host copies are aligned too
+    Collection<real_type, Ownership::value, MemSpace::host> copied;
+    copied = values;
+    EXPECT_TRUE(is_aligned(copied[AllItems<real_type>{}].data(),
+                           host_alignment));
+}
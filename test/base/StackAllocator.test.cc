@@ -8,7 +8,9 @@
 #include "base/StackAllocator.hh"
 
 #include <cstdint>
+#include <vector>
 #include "base/CollectionStateStore.hh"
+#include "base/Range.hh"
 #include "celeritas_test.hh"
 #include "StackAllocator.test.hh"
 
@@ -81,6 +83,88 @@ TEST_F(StackAllocatorTest, host)
 
 //---------------------------------------------------------------------------//
 
+TEST_F(StackAllocatorTest, host_regions)
+{
+    using celeritas::compact_regions;
+    using celeritas::StackRegionId;
+
+    using celeritas::MemSpace;
+    using celeritas::Ownership;
+
+    MockAllocatorData<Ownership::value, MemSpace::host> data;
+    resize(&data, 16, 3, 4);
+    MockAllocatorData<Ownership::reference, MemSpace::host> ref;
+    ref = data;
+    EXPECT_EQ(3, ref.num_regions());
+    EXPECT_EQ(4, ref.region_capacity());
+
+    // Pre-existing data on the shared stack
+    Allocator shared(ref);
+    shared(1)->mock_id = 100;
+
+    // Interleave allocations from different "threads"
+    Allocator alloc_a(ref, StackRegionId{0});
+    Allocator alloc_b(ref, StackRegionId{1});
+    Allocator alloc_c(ref, StackRegionId{2});
+    EXPECT_EQ(16, alloc_b.capacity());
+
+    MockSecondary* ptr = alloc_c(2);
+    ASSERT_NE(nullptr, ptr);
+    EXPECT_EQ(-1, ptr[0].mock_id);
+    ptr[0].mock_id = 20;
+    ptr[1].mock_id = 21;
+    alloc_a(1)->mock_id = 0;
+    ptr = alloc_c(2);
+    ASSERT_NE(nullptr, ptr);
+    ptr[0].mock_id = 22;
+    ptr[1].mock_id = 23;
+    alloc_a(1)->mock_id = 1;
+
+    // Region is full: allocation fails but doesn't affect other regions
+    EXPECT_EQ(nullptr, alloc_c(1));
+    EXPECT_EQ(nullptr, alloc_a(4));
+    alloc_a(1)->mock_id = 2;
+
+    // Region allocations don't change the shared stack until compaction
+    EXPECT_EQ(1, shared.size());
+    EXPECT_EQ(8, compact_regions(ref));
+    EXPECT_EQ(8, shared.size());
+    EXPECT_EQ(8, alloc_a.get().size());
+
+    // Data is ordered by region, then by allocation within each region
+    std::vector<int> ids;
+    for (const MockSecondary& s : shared.get())
+    {
+        ids.push_back(s.mock_id);
+    }
+    const int expected_ids[] = {100, 0, 1, 2, 20, 21, 22, 23};
+    EXPECT_VEC_EQ(expected_ids, ids);
+
+    // Regions are emptied and can be reused
+    ptr = alloc_c(4);
+    ASSERT_NE(nullptr, ptr);
+    ptr[3].mock_id = 33;
+    EXPECT_EQ(12, compact_regions(ref));
+    EXPECT_EQ(33, shared.get().back().mock_id);
+
+    // Compaction beyond the shared capacity is an error
+    alloc_a(4);
+    alloc_b(4);
+    EXPECT_THROW(compact_regions(ref), celeritas::RuntimeError);
+
+    // Clearing also empties the regions
+    shared.clear();
+    EXPECT_EQ(0, shared.size());
+    ptr = alloc_b(4);
+    ASSERT_NE(nullptr, ptr);
+    ptr[0].mock_id = 10;
+    EXPECT_EQ(4, compact_regions(ref));
+    EXPECT_EQ(4, shared.size());
+    EXPECT_EQ(10, shared.get().front().mock_id);
+}
+
+//---------------------------------------------------------------------------//
+
 TEST_F(StackAllocatorTest, TEST_IF_CELERITAS_CUDA(device))
 {
     using StateStore
@@ -141,3 +225,55 @@ TEST_F(StackAllocatorTest, TEST_IF_CELERITAS_CUDA(device))
     EXPECT_EQ(1024, actual_allocations(input, result));
     EXPECT_EQ(1024, result.view_size);
 }
+
+//---------------------------------------------------------------------------//
+
+TEST_F(StackAllocatorTest, TEST_IF_CELERITAS_CUDA(device_regions))
+{
+    using celeritas::MemSpace;
+    using celeritas::Ownership;
+
+    // More regions than threads in the compaction block
+    const int num_threads = 300;
+
+    MockAllocatorData<Ownership::value, MemSpace::device> data;
+    resize(&data, 2048, num_threads, 4);
+
+    SATestInput input;
+    input.sa_pointers = data;
+    input.num_threads = num_threads;
+    input.num_iters   = 3;
+    input.alloc_size  = 1;
+    input.use_regions = true;
+    auto result       = sa_test(input);
+    EXPECT_EQ(0, result.num_errors);
+    EXPECT_EQ(num_threads * 3, result.num_allocations);
+    EXPECT_EQ(0, result.view_size);
+
+    // Each region is full after the next allocation
+    input.num_iters = 2;
+    result          = sa_test(input);
+    EXPECT_EQ(num_threads, result.num_allocations);
+    EXPECT_EQ(num_threads * 4, sa_compact(input));
+
+    // Data is ordered by thread
+    std::vector<MockSecondary> host_data(data.storage.size());
+    celeritas::copy_to_host(data.storage, celeritas::make_span(host_data));
+    std::vector<int> ids;
+    for (auto i : celeritas::range(num_threads * 4))
+    {
+        ids.push_back(host_data[i].mock_id);
+    }
+    std::vector<int> expected_ids;
+    for (int t = 0; t < num_threads; ++t)
+    {
+        expected_ids.insert(expected_ids.end(), 4, t);
+    }
+    EXPECT_VEC_EQ(expected_ids, ids);
+
+    // Regions are reset; compaction beyond the shared capacity is an error
+    input.num_iters = 4;
+    result          = sa_test(input);
+    EXPECT_EQ(num_threads * 4, result.num_allocations);
+    EXPECT_THROW(sa_compact(input), celeritas::RuntimeError);
+}
@@ -11,6 +11,7 @@
 #include <thrust/device_vector.h>
 #include "base/KernelParamCalculator.cuda.hh"
 #include "base/StackAllocator.hh"
+#include "base/detail/StackRegionCompactor.t.cuh"
 
 using thrust::raw_pointer_cast;
 
@@ -29,7 +30,11 @@ __global__ void sa_test_kernel(SATestInput const input, SATestOutput* output)
     if (thread_idx >= input.num_threads)
         return;
 
-    StackAllocatorMock allocate(input.sa_pointers);
+    StackAllocatorMock allocate
+        = input.use_regions
+              ? StackAllocatorMock(input.sa_pointers,
+                                   celeritas::StackRegionId(thread_idx))
+              : StackAllocatorMock(input.sa_pointers);
     for (int i = 0; i < input.num_iters; ++i)
     {
         MockSecondary* secondaries = allocate(input.alloc_size);
@@ -125,5 +130,12 @@ void sa_clear(const SATestInput& input)
     CELER_CUDA_CALL(cudaDeviceSynchronize());
 }
 
+//---------------------------------------------------------------------------//
+//! Move region data onto the shared stack
+celeritas::size_type sa_compact(const SATestInput& input)
+{
+    return celeritas::compact_regions(input.sa_pointers);
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas_test
@@ -30,6 +30,7 @@ struct SATestInput
     int                   num_iters;
     int                   alloc_size;
     MockAllocatorPointers sa_pointers;
+    bool                  use_regions = false; //!< One region per thread
 };
 
 //---------------------------------------------------------------------------//
@@ -46,8 +47,9 @@ struct SATestOutput
 
 //---------------------------------------------------------------------------//
 //! Run on device and return results
-SATestOutput sa_test(const SATestInput&);
-void         sa_clear(const SATestInput&);
+SATestOutput         sa_test(const SATestInput&);
+void                 sa_clear(const SATestInput&);
+celeritas::size_type sa_compact(const SATestInput&);
 
 #if !CELERITAS_USE_CUDA
 inline SATestOutput sa_test(const SATestInput&)
@@ -59,6 +61,11 @@ inline void sa_clear(const SATestInput&)
 {
     CELER_NOT_CONFIGURED("CUDA");
 }
+
+inline celeritas::size_type sa_compact(const SATestInput&)
+{
+    CELER_NOT_CONFIGURED("CUDA");
+}
 #endif
 
 //---------------------------------------------------------------------------//
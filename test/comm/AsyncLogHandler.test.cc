@@ -0,0 +1,200 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AsyncLogHandler.test.cc
+//---------------------------------------------------------------------------//
+#include "comm/AsyncLogHandler.hh"
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "base/Range.hh"
+#include "comm/Communicator.hh"
+#include "comm/Logger.hh"
+
+#include "celeritas_test.hh"
+
+using celeritas::AsyncLogHandler;
+using celeritas::Communicator;
+using celeritas::Logger;
+using celeritas::LogLevel;
+using celeritas::Provenance;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class AsyncLogHandlerTest : public celeritas::Test
+{
+  protected:
+    //! Handler that saves messages and the threads that wrote them
+    celeritas::LogHandler make_saver()
+    {
+        return [this](Provenance prov, LogLevel, std::string msg) {
+            lines.push_back(prov.line);
+            messages.push_back(std::move(msg));
+            writers.push_back(std::this_thread::get_id());
+        };
+    }
+
+    std::vector<int>             lines;
+    std::vector<std::string>     messages;
+    std::vector<std::thread::id> writers;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(AsyncLogHandlerTest, flush)
+{
+    AsyncLogHandler handle(this->make_saver());
+    Logger          log(Communicator{}, handle);
+
+    log({"file", 1}, LogLevel::info) << "first";
+    log({"file", 2}, LogLevel::warning) << "second";
+    handle.flush();
+    EXPECT_EQ((std::vector<std::string>{"first", "second"}), messages);
+
+    // Messages are written by the flusher thread
+    ASSERT_EQ(2, writers.size());
+    EXPECT_NE(std::this_thread::get_id(), writers.front());
+    EXPECT_EQ(writers.front(), writers.back());
+
+    // Errors are written before returning
+    log({"file", 3}, LogLevel::error) << "third";
+    EXPECT_EQ(3, messages.size());
+}
+
+TEST_F(AsyncLogHandlerTest, destroy)
+{
+    {
+        AsyncLogHandler::Options opts;
+        opts.flush_interval = 1000;
+        AsyncLogHandler handle(this->make_saver(), opts);
+        handle({"file", 1}, LogLevel::info, "pending");
+        EXPECT_EQ(0, messages.size());
+    }
+    // Pending messages are written when the last copy is destroyed
+    EXPECT_EQ(std::vector<std::string>{"pending"}, messages);
+}
+
+TEST_F(AsyncLogHandlerTest, threads)
+{
+    AsyncLogHandler handle(this->make_saver());
+
+    constexpr int            num_threads = 4;
+    constexpr int            num_lines   = 10;
+    std::vector<std::thread> threads;
+    for (int t : celeritas::range(num_threads))
+    {
+        threads.emplace_back([handle, t] {
+            for (int i : celeritas::range(num_lines))
+            {
+                handle({"file", t * num_lines + i},
+                       LogLevel::info,
+                       "thread " + std::to_string(t));
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    handle.flush();
+
+    // All messages are written, and each thread's in order
+    ASSERT_EQ(num_threads * num_lines, lines.size());
+    std::vector<int> last_line(num_threads, -1);
+    for (int line : lines)
+    {
+        int t = line / num_lines;
+        EXPECT_LT(last_line[t], line);
+        last_line[t] = line;
+    }
+    EXPECT_EQ(0, handle.num_suppressed());
+}
+
+TEST_F(AsyncLogHandlerTest, rate_limit)
+{
+    AsyncLogHandler::Options opts;
+    opts.max_repeats = 3;
+    {
+        AsyncLogHandler handle(this->make_saver(), opts);
+        for (int i : celeritas::range(10))
+        {
+            handle({"file", 1}, LogLevel::warning, std::to_string(i));
+        }
+        handle({"file", 2}, LogLevel::warning, "different line");
+        handle({"file", 1}, LogLevel::info, "different level");
+        handle.flush();
+        EXPECT_EQ(7, handle.num_suppressed());
+    }
+
+    static const std::string expected_messages[] = {
+        "0",
+        "1",
+        "2",
+        "Suppressing further repeated messages",
+        "different line",
+        "different level",
+        "Suppressed 7 repeated messages",
+    };
+    EXPECT_VEC_EQ(expected_messages, messages);
+}
+
+TEST_F(AsyncLogHandlerTest, rate_limit_errors)
+{
+    AsyncLogHandler::Options opts;
+    opts.max_repeats = 1;
+    AsyncLogHandler handle(this->make_saver(), opts);
+    for (int i : celeritas::range(3))
+    {
+        handle({"file", 1}, LogLevel::error, std::to_string(i));
+    }
+
+    // Errors are never suppressed
+    static const std::string expected_messages[] = {"0", "1", "2"};
+    EXPECT_VEC_EQ(expected_messages, messages);
+    EXPECT_EQ(0, handle.num_suppressed());
+}
+
+TEST_F(AsyncLogHandlerTest, repeat_interval)
+{
+    AsyncLogHandler::Options opts;
+    opts.max_repeats     = 2;
+    opts.repeat_interval = 0.25;
+    {
+        AsyncLogHandler handle(this->make_saver(), opts);
+        for (int i : celeritas::range(4))
+        {
+            handle({"file", 1}, LogLevel::warning, std::to_string(i));
+        }
+        handle.flush();
+        EXPECT_EQ(2, handle.num_suppressed());
+
+        // Counts are reset after the interval
+        std::this_thread::sleep_for(std::chrono::milliseconds(500));
+        for (int i : celeritas::range(4, 8))
+        {
+            handle({"file", 1}, LogLevel::warning, std::to_string(i));
+        }
+        handle.flush();
+        EXPECT_EQ(4, handle.num_suppressed());
+    }
+
+    static const std::string expected_messages[] = {
+        "0",
+        "1",
+        "Suppressing further repeated messages",
+        "Suppressed 2 repeated messages",
+        "4",
+        "5",
+        "Suppressing further repeated messages",
+        "Suppressed 2 repeated messages",
+    };
+    EXPECT_VEC_EQ(expected_messages, messages);
+}
@@ -0,0 +1,81 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AtomicCounter.test.cc
+//---------------------------------------------------------------------------//
+#include "comm/AtomicCounter.hh"
+
+#include <vector>
+#include "base/Span.hh"
+#include "comm/Operations.hh"
+
+#include "celeritas_test.hh"
+
+using celeritas::AtomicCounter;
+using celeritas::Communicator;
+using celeritas::Operation;
+
+#if CELERITAS_USE_MPI
+#    define TEST_IF_CELERITAS_MPI(name) name
+#else
+#    define TEST_IF_CELERITAS_MPI(name) DISABLED_##name
+#endif
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class AtomicCounterTest : public celeritas::Test
+{
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(AtomicCounterTest, null)
+{
+    AtomicCounter counter{Communicator{}};
+    EXPECT_EQ(0, counter.fetch_add(1));
+    EXPECT_EQ(1, counter.fetch_add(3));
+    EXPECT_EQ(4, counter.fetch_add(0));
+}
+
+TEST_F(AtomicCounterTest, TEST_IF_CELERITAS_MPI(world))
+{
+    Communicator comm = Communicator::comm_world();
+
+    // Every value is taken by exactly one process
+    constexpr unsigned int num_values = 100;
+    std::vector<int>       taken(num_values, 0);
+    int                    num_local = 0;
+    {
+        AtomicCounter counter(comm);
+        auto          i = counter.fetch_add(1);
+        while (i < num_values)
+        {
+            ++taken[i];
+            ++num_local;
+            i = counter.fetch_add(1);
+        }
+    }
+    allreduce(comm, Operation::sum, celeritas::make_span(taken));
+    EXPECT_EQ(std::vector<int>(num_values, 1), taken);
+    EXPECT_EQ(int(num_values), allreduce(comm, Operation::sum, num_local));
+}
+
+TEST_F(AtomicCounterTest, TEST_IF_CELERITAS_MPI(increment))
+{
+    Communicator comm = Communicator::comm_world();
+
+    AtomicCounter counter(comm);
+    const auto    first = counter.fetch_add(5);
+    EXPECT_EQ(0, first % 5);
+    EXPECT_LT(first, 5ull * comm.size());
+    celeritas::barrier(comm);
+
+    // All processes have incremented once
+    EXPECT_EQ(5ull * comm.size(), counter.fetch_add(0));
+}
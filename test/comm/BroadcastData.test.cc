@@ -0,0 +1,223 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BroadcastData.test.cc
+//---------------------------------------------------------------------------//
+#include "comm/BroadcastData.hh"
+
+#include <cstdint>
+#include <vector>
+#include "base/CollectionMirror.hh"
+#include "comm/ScopedMpiInit.hh"
+#include "physics/base/CutoffParams.hh"
+#include "physics/base/ParticleParams.hh"
+#include "physics/base/Units.hh"
+#include "physics/material/MaterialParams.hh"
+
+#include "celeritas_test.hh"
+#include "SharedTestData.hh"
+
+using namespace celeritas;
+using namespace celeritas_test;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class BroadcastDataTest : public celeritas::Test
+{
+  protected:
+    using HostRef = SharedTestData<Ownership::const_reference, MemSpace::host>;
+
+    void SetUp() override
+    {
+        if (ScopedMpiInit::status() != ScopedMpiInit::Status::disabled)
+        {
+            comm = Communicator::comm_world();
+        }
+    }
+
+    //! Whether a collection lies inside a block of memory
+    template<class T, Ownership W>
+    static bool is_inside(const Collection<T, W, MemSpace::host>& items,
+                          const std::vector<char>&                block)
+    {
+        auto data  = items[AllItems<T, MemSpace::host>{}];
+        auto begin = reinterpret_cast<const char*>(data.data());
+        auto end   = reinterpret_cast<const char*>(data.data() + data.size());
+        return begin >= block.data() && end <= block.data() + block.size();
+    }
+
+    //! Copy the data of params built by the first process
+    template<template<Ownership, MemSpace> class P, class Params>
+    CollectionMirror<P> adopt(const Params* params) const
+    {
+        typename CollectionMirror<P>::HostRef data;
+        if (params)
+        {
+            data = params->host_pointers();
+        }
+        auto storage = std::make_shared<BroadcastData<P>>(comm, data);
+        return CollectionMirror<P>{storage->host_ref(), storage};
+    }
+
+    Communicator comm;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(BroadcastDataTest, rebase)
+{
+    auto    host = make_shared_data(1);
+    HostRef ref;
+    ref = host;
+
+    // Copy the collections, including those of the nested group, into a block
+    detail::SharedLayoutCalculator calc;
+    ref.visit_members(calc);
+    std::vector<char> src(calc.bytes + host_alignment);
+    char*             src_base = src.data();
+    src_base += detail::align_shared_offset(
+                    reinterpret_cast<std::uintptr_t>(src_base))
+                - reinterpret_cast<std::uintptr_t>(src_base);
+    detail::SharedCollectionCopier copy{src_base, calc.bytes};
+    ref.visit_members(copy);
+    EXPECT_EQ(calc.bytes, copy.offset);
+    host = {};
+
+    // Point the copied group into another block holding the same data
+    std::vector<char> dst(src_base, src_base + calc.bytes);
+    detail::SharedCollectionRebaser rebase{
+        reinterpret_cast<std::uintptr_t>(src_base), dst.data(), dst.size()};
+    HostRef rebased = ref;
+    rebased.visit_members(rebase);
+
+    EXPECT_EQ(2.5, rebased.scale);
+    EXPECT_TRUE(is_inside(rebased.reals, dst));
+    EXPECT_TRUE(is_inside(rebased.chars, dst));
+    EXPECT_TRUE(is_inside(rebased.inner.ints, dst));
+    EXPECT_VEC_SOFT_EQ((std::vector<real_type>{2, 2, 3}),
+                       to_vector(rebased.reals));
+    EXPECT_EQ(5, rebased.chars.size());
+    EXPECT_VEC_EQ((std::vector<int>{11, 20, 30, 40}),
+                  to_vector(rebased.inner.ints));
+
+#if CELERITAS_DEBUG
+    // A collection outside the source block can't be translated
+    detail::SharedCollectionRebaser bad_rebase{
+        reinterpret_cast<std::uintptr_t>(src_base), dst.data(), 64};
+    HostRef bad = ref;
+    EXPECT_THROW(bad.visit_members(bad_rebase), celeritas::DebugError);
+#endif
+}
+
+TEST_F(BroadcastDataTest, data)
+{
+    // Only the first process has data
+    SharedTestData<Ownership::value, MemSpace::host> host;
+    if (comm.rank() == 0)
+    {
+        host = make_shared_data(0);
+    }
+    HostRef ref;
+    ref = host;
+
+    auto copied = std::make_shared<BroadcastData<SharedTestData>>(comm, ref);
+    host        = {};
+
+    const HostRef& result = copied->host_ref();
+    EXPECT_EQ(1.5, result.scale);
+    EXPECT_VEC_SOFT_EQ((std::vector<real_type>{1, 2, 3}),
+                       to_vector(result.reals));
+    EXPECT_EQ(5, result.chars.size());
+    EXPECT_VEC_EQ((std::vector<int>{10, 20, 30, 40}),
+                  to_vector(result.inner.ints));
+
+    // Each collection is aligned in the block
+    EXPECT_EQ(2 * host_alignment + 4 * sizeof(int), copied->size());
+
+    // The data can be adopted by a mirror
+    CollectionMirror<SharedTestData> mirror{copied->host_ref(), copied};
+    copied = {};
+    ASSERT_TRUE(mirror);
+    EXPECT_EQ(1.5, mirror.host().scale);
+    EXPECT_VEC_EQ((std::vector<int>{10, 20, 30, 40}),
+                  to_vector(mirror.host().inner.ints));
+}
+
+TEST_F(BroadcastDataTest, params)
+{
+    using namespace celeritas::units;
+
+    // Only the first process builds the params
+    std::shared_ptr<ParticleParams> particles;
+    std::shared_ptr<MaterialParams> materials;
+    std::shared_ptr<CutoffParams>   cutoffs;
+    std::vector<std::string>        particle_names;
+    std::vector<PDGNumber>          pdg_codes;
+    std::vector<std::string>        elnames;
+    std::vector<std::string>        matnames;
+    if (comm.rank() == 0)
+    {
+        constexpr auto        stable = ParticleDef::stable_decay_constant();
+        ParticleParams::Input particle_inp;
+        particle_inp.push_back({"electron",
+                                pdg::electron(),
+                                MevMass{0.5109989461},
+                                ElementaryCharge{-1},
+                                stable});
+        particle_inp.push_back(
+            {"gamma", pdg::gamma(), zero_quantity(), zero_quantity(), stable});
+        particles = std::make_shared<ParticleParams>(particle_inp);
+
+        MaterialParams::Input material_inp;
+        material_inp.elements  = {{1, AmuMass{1.008}, "H"}};
+        material_inp.materials = {{1e20,
+                                   100.0,
+                                   MatterState::gas,
+                                   {{ElementId{0}, 1.0}},
+                                   "H2"}};
+        materials = std::make_shared<MaterialParams>(material_inp);
+        cutoffs   = std::make_shared<CutoffParams>(
+            CutoffParams::Input{particles, materials, {}});
+
+        particle_names = {"electron", "gamma"};
+        pdg_codes      = {pdg::electron(), pdg::gamma()};
+        elnames        = {"H"};
+        matnames       = {"H2"};
+    }
+    broadcast(comm, &particle_names);
+    pdg_codes.resize(particle_names.size());
+    broadcast(comm, make_span(pdg_codes));
+    broadcast(comm, &elnames);
+    broadcast(comm, &matnames);
+
+    // Adopt the data on all processes
+    ParticleParams adopted_particles(
+        adopt<ParticleParamsData>(particles.get()), particle_names, pdg_codes);
+    MaterialParams adopted_materials(
+        adopt<MaterialParamsData>(materials.get()), elnames, matnames);
+    CutoffParams adopted_cutoffs(adopt<CutoffParamsData>(cutoffs.get()));
+    particles = {};
+    materials = {};
+    cutoffs   = {};
+
+    ASSERT_EQ(2, adopted_particles.size());
+    EXPECT_EQ("gamma", adopted_particles.id_to_label(ParticleId{1}));
+    EXPECT_EQ(ParticleId{0}, adopted_particles.find(pdg::electron()));
+    EXPECT_EQ(ParticleId{1}, adopted_particles.find("gamma"));
+    EXPECT_SOFT_EQ(0.5109989461,
+                   adopted_particles.get(ParticleId{0}).mass().value());
+
+    ASSERT_EQ(1, adopted_materials.size());
+    EXPECT_EQ("H", adopted_materials.id_to_label(ElementId{0}));
+    EXPECT_EQ(MaterialId{0}, adopted_materials.find("H2"));
+    EXPECT_SOFT_EQ(1e20,
+                   adopted_materials.get(MaterialId{0}).number_density());
+
+    EXPECT_EQ(2, adopted_cutoffs.host_pointers().cutoffs.size());
+}
@@ -10,6 +10,7 @@
 #include "comm/ScopedMpiInit.hh"
 
 #include "celeritas_test.hh"
+#include "base/CollectionBuilder.hh"
 #include "base/Span.hh"
 
 using celeritas::Communicator;
@@ -58,6 +59,14 @@ TEST_F(CommunicatorTest, null)
     int       dst[] = {-1};
     celeritas::allreduce(comm, Operation::max, make_span(src), make_span(dst));
     EXPECT_EQ(1234, dst[0]);
+
+    // Broadcast should leave the data unchanged
+    EXPECT_EQ(4321, celeritas::broadcast(comm, 4321));
+    celeritas::broadcast(comm, make_span(dst));
+    EXPECT_EQ(1234, dst[0]);
+    std::vector<std::string> names{"gamma"};
+    celeritas::broadcast(comm, &names);
+    EXPECT_EQ(std::vector<std::string>{"gamma"}, names);
 }
 
 TEST_F(CommunicatorTest, TEST_IF_CELERITAS_MPI(self))
@@ -94,3 +103,63 @@ TEST_F(CommunicatorTest, TEST_IF_CELERITAS_MPI(world))
 
     EXPECT_EQ(123 * comm.size(), allreduce(comm, Operation::sum, 123));
 }
+
+TEST_F(CommunicatorTest, TEST_IF_CELERITAS_MPI(broadcast))
+{
+    using celeritas::make_span;
+
+    Communicator comm = Communicator::comm_world();
+
+    struct Pair
+    {
+        int    key;
+        double value;
+    };
+
+    // Scalar and trivially copyable values
+    EXPECT_EQ(10, celeritas::broadcast(comm, 10 + comm.rank()));
+    Pair p = celeritas::broadcast(comm, Pair{comm.rank(), 1.5 * comm.rank()});
+    EXPECT_EQ(0, p.key);
+    EXPECT_EQ(0.0, p.value);
+
+    // Array from the last process
+    const int root   = comm.size() - 1;
+    double    data[] = {1.0 * comm.rank(), 2.0 * comm.rank()};
+    celeritas::broadcast(comm, make_span(data), root);
+    EXPECT_EQ(1.0 * root, data[0]);
+    EXPECT_EQ(2.0 * root, data[1]);
+}
+
+TEST_F(CommunicatorTest, TEST_IF_CELERITAS_MPI(broadcast_collection))
+{
+    using celeritas::MemSpace;
+    using celeritas::Ownership;
+
+    Communicator comm = Communicator::comm_world();
+
+    // Only the root process builds the data
+    celeritas::Collection<int, Ownership::value, MemSpace::host> items;
+    if (comm.rank() == 0)
+    {
+        celeritas::make_builder(&items).insert_back({3, 1, 4, 1, 5});
+    }
+    celeritas::broadcast(comm, &items);
+
+    ASSERT_EQ(5, items.size());
+    auto all = items[celeritas::AllItems<int, MemSpace::host>{}];
+    EXPECT_EQ((std::vector<int>{3, 1, 4, 1, 5}),
+              std::vector<int>(all.begin(), all.end()));
+}
+
+TEST_F(CommunicatorTest, TEST_IF_CELERITAS_MPI(broadcast_strings))
+{
+    Communicator comm = Communicator::comm_world();
+
+    std::vector<std::string> names;
+    if (comm.rank() == 0)
+    {
+        names = {"electron", "", "gamma"};
+    }
+    celeritas::broadcast(comm, &names);
+    EXPECT_EQ((std::vector<std::string>{"electron", "", "gamma"}), names);
+}
@@ -0,0 +1,85 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file KernelDiagnostics.test.cc
+//---------------------------------------------------------------------------//
+#include "comm/KernelDiagnostics.hh"
+
+#include <sstream>
+#include "celeritas_config.h"
+#if CELERITAS_USE_JSON
+#    include "comm/KernelDiagnosticsIO.json.hh"
+#endif
+
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class KernelDiagnosticsTest : public celeritas::Test
+{
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(KernelDiagnosticsTest, host)
+{
+    KernelDiagnostics kd;
+    auto              pre_id   = kd.insert_host("pre_step");
+    auto              along_id = kd.insert_host("along_step");
+    EXPECT_EQ(2, kd.size());
+    EXPECT_NE(pre_id, along_id);
+    EXPECT_EQ(pre_id, kd.insert_host("pre_step"));
+    EXPECT_EQ(2, kd.size());
+
+    kd.launch_host(pre_id, 100, 4, 0.5);
+    kd.launch_host(pre_id, 300, 2, 1.5);
+
+    const auto& diag = kd.at(pre_id);
+    EXPECT_EQ("pre_step", diag.name);
+    EXPECT_TRUE(diag.host);
+    EXPECT_EQ(2, diag.num_launches);
+    EXPECT_EQ(300, diag.max_num_threads);
+    EXPECT_EQ(400, diag.num_tracks);
+    EXPECT_DOUBLE_EQ(2.0, diag.time);
+    EXPECT_EQ(4, diag.num_host_threads);
+    EXPECT_EQ(0, kd.at(along_id).num_launches);
+
+    std::ostringstream os;
+    os << kd;
+    EXPECT_NE(std::string::npos, os.str().find("num_tracks: 400"));
+
+#if CELERITAS_USE_JSON
+    nlohmann::json j = kd;
+    ASSERT_EQ(2, j.size());
+    EXPECT_EQ("host", j[0].at("memspace").get<std::string>());
+    EXPECT_DOUBLE_EQ(200.0, j[0].at("throughput").get<double>());
+    EXPECT_DOUBLE_EQ(0.0, j[1].at("throughput").get<double>());
+#endif
+}
+
+TEST_F(KernelDiagnosticsTest, scoped)
+{
+    auto& kd       = kernel_diagnostics();
+    auto  stage_id = kd.insert_host("scoped_stage_test");
+    {
+        ScopedHostStage record_stage(stage_id, 123);
+    }
+    {
+        ScopedHostStage record_stage(stage_id, 45);
+    }
+
+    const auto& diag = kd.at(stage_id);
+    EXPECT_EQ(2, diag.num_launches);
+    EXPECT_EQ(123, diag.max_num_threads);
+    EXPECT_EQ(168, diag.num_tracks);
+    EXPECT_GE(diag.time, 0);
+    EXPECT_GE(diag.num_host_threads, 1);
+}
@@ -129,6 +129,24 @@ TEST_F(LoggerTest, custom_log)
     EXPECT_EQ("Things failed because:  1 is the loneliest number", last_msg);
 }
 
+TEST_F(LoggerTest, filtered_macro)
+{
+    // Filtered messages don't evaluate their stream arguments
+    int  num_calls = 0;
+    auto count     = [&num_calls] { return ++num_calls; };
+
+    Logger&  log       = ::celeritas::world_logger();
+    LogLevel old_level = log.level();
+    log.level(LogLevel::critical);
+    CELER_LOG(info) << "Never printed: " << count();
+    EXPECT_EQ(0, num_calls);
+
+    // Only the main process writes parallel messages
+    CELER_LOG(critical) << "Printed with argument " << count();
+    EXPECT_EQ(comm_world.rank() == 0 ? 1 : 0, num_calls);
+    log.level(old_level);
+}
+
 TEST_F(LoggerTest, DISABLED_performance)
 {
     // Construct a logger with an expensive output routine that will never be
@@ -0,0 +1,118 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file NodeSharedMemory.test.cc
+//---------------------------------------------------------------------------//
+#include "comm/NodeSharedMemory.hh"
+
+#include <cstring>
+#include <vector>
+#include "comm/NodeSharedData.hh"
+#include "comm/Operations.hh"
+
+#include "celeritas_test.hh"
+#include "SharedTestData.hh"
+
+using namespace celeritas;
+using namespace celeritas_test;
+
+#if CELERITAS_USE_MPI
+#    define TEST_IF_CELERITAS_MPI(name) name
+#else
+#    define TEST_IF_CELERITAS_MPI(name) DISABLED_##name
+#endif
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class NodeSharedMemoryTest : public celeritas::Test
+{
+  protected:
+    using HostRef = SharedTestData<Ownership::const_reference, MemSpace::host>;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(NodeSharedMemoryTest, null)
+{
+    NodeSharedMemory memory(Communicator{}, 16);
+    EXPECT_TRUE(memory.writer());
+    EXPECT_FALSE(memory.node_comm());
+    EXPECT_EQ(16, memory.size());
+    ASSERT_NE(nullptr, memory.data());
+    std::memset(memory.data(), 1, memory.size());
+    memory.fence();
+
+    NodeSharedMemory empty(Communicator{}, 0);
+    EXPECT_EQ(nullptr, empty.data());
+}
+
+TEST_F(NodeSharedMemoryTest, null_shared_data)
+{
+    auto    host = make_shared_data(1);
+    HostRef host_ref;
+    host_ref = host;
+
+    NodeSharedData<SharedTestData> shared(Communicator{}, host_ref);
+    host = {};
+
+    const HostRef& ref = shared.host_ref();
+    EXPECT_EQ(2.5, ref.scale);
+    EXPECT_EQ((std::vector<real_type>{2, 2, 3}), to_vector(ref.reals));
+    EXPECT_EQ((std::vector<int>{11, 20, 30, 40}), to_vector(ref.inner.ints));
+}
+
+TEST_F(NodeSharedMemoryTest, TEST_IF_CELERITAS_MPI(world))
+{
+    Communicator comm = Communicator::comm_world();
+
+    // Only the writer's size is used
+    NodeSharedMemory memory(comm, comm.rank() == 0 ? 1024 : 1);
+    EXPECT_EQ(1024, memory.size());
+    EXPECT_EQ(memory.node_comm().size(), comm.size());
+    EXPECT_EQ(memory.writer(), static_cast<bool>(memory.writer_comm()));
+
+    int* data = static_cast<int*>(memory.data());
+    if (memory.writer())
+    {
+        for (int i = 0; i < 256; ++i)
+        {
+            data[i] = i * i;
+        }
+    }
+    memory.fence();
+    EXPECT_EQ(0, data[0]);
+    EXPECT_EQ(255 * 255, data[255]);
+    barrier(comm);
+}
+
+TEST_F(NodeSharedMemoryTest, TEST_IF_CELERITAS_MPI(shared_data))
+{
+    Communicator comm = Communicator::comm_world();
+
+    // Only the first process has data
+    SharedTestData<Ownership::value, MemSpace::host> host;
+    if (comm.rank() == 0)
+    {
+        host = make_shared_data(0);
+    }
+    HostRef host_ref;
+    host_ref = host;
+
+    NodeSharedData<SharedTestData> shared(comm, host_ref);
+    host = {};
+
+    const HostRef& ref = shared.host_ref();
+    EXPECT_EQ(1.5, ref.scale);
+    EXPECT_EQ(5, ref.chars.size());
+    EXPECT_EQ((std::vector<real_type>{1, 2, 3}), to_vector(ref.reals));
+    EXPECT_EQ((std::vector<int>{10, 20, 30, 40}), to_vector(ref.inner.ints));
+
+    // Each collection is aligned in the segment
+    EXPECT_EQ(2 * host_alignment + 4 * sizeof(int), shared.size());
+}
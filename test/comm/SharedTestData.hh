@@ -0,0 +1,113 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file SharedTestData.hh
+//---------------------------------------------------------------------------//
+#pragma once
+
+#include <vector>
+#include "base/Collection.hh"
+#include "base/CollectionBuilder.hh"
+
+namespace celeritas_test
+{
+using celeritas::Collection;
+using celeritas::MemSpace;
+using celeritas::Ownership;
+
+//---------------------------------------------------------------------------//
+/*!
+ * Collection group nested in another group.
+ */
+template<Ownership W, MemSpace M>
+struct InnerTestData
+{
+    Collection<int, W, M> ints;
+
+    template<Ownership W2, MemSpace M2>
+    InnerTestData& operator=(const InnerTestData<W2, M2>& other)
+    {
+        ints = other.ints;
+        return *this;
+    }
+
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("ints", ints);
+    }
+
+    template<class F>
+    void visit_members(F&& visit)
+    {
+        visit("ints", ints);
+    }
+};
+
+//---------------------------------------------------------------------------//
+/*!
+ * Collection group with scalar data and a nested group.
+ */
+template<Ownership W, MemSpace M>
+struct SharedTestData
+{
+    celeritas::real_type                   scale{};
+    Collection<celeritas::real_type, W, M> reals;
+    Collection<char, W, M>                 chars;
+    InnerTestData<W, M>                    inner;
+
+    explicit operator bool() const { return scale > 0 && !reals.empty(); }
+
+    template<Ownership W2, MemSpace M2>
+    SharedTestData& operator=(const SharedTestData<W2, M2>& other)
+    {
+        scale = other.scale;
+        reals = other.reals;
+        chars = other.chars;
+        inner = other.inner;
+        return *this;
+    }
+
+    template<class F>
+    void visit_members(F&& visit) const
+    {
+        visit("reals", reals);
+        visit("chars", chars);
+        visit("inner", inner);
+    }
+
+    template<class F>
+    void visit_members(F&& visit)
+    {
+        visit("reals", reals);
+        visit("chars", chars);
+        visit("inner", inner);
+    }
+};
+
+//---------------------------------------------------------------------------//
+//! Construct test data that depends on a seed value
+inline SharedTestData<Ownership::value, MemSpace::host>
+make_shared_data(int seed)
+{
+    SharedTestData<Ownership::value, MemSpace::host> result;
+    result.scale = 1.5 + seed;
+    make_builder(&result.reals).insert_back({1.0 + seed, 2.0, 3.0});
+    make_builder(&result.chars).insert_back({'a', 'b', 'c', 'd', 'e'});
+    make_builder(&result.inner.ints).insert_back({10 + seed, 20, 30, 40});
+    return result;
+}
+
+//---------------------------------------------------------------------------//
+//! Get the values of a collection
+template<class T, Ownership W, MemSpace M>
+std::vector<T> to_vector(const Collection<T, W, M>& items)
+{
+    auto all = items[celeritas::AllItems<T, M>{}];
+    return {all.begin(), all.end()};
+}
+
+//---------------------------------------------------------------------------//
+} // namespace celeritas_test
@@ -0,0 +1,154 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file Tracer.test.cc
+//---------------------------------------------------------------------------//
+#include "comm/Tracer.hh"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include "celeritas_config.h"
+#if CELERITAS_USE_JSON
+#    include <nlohmann/json.hpp>
+#endif
+
+#include "comm/Communicator.hh"
+#include "comm/ScopedMpiInit.hh"
+
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class TracerTest : public celeritas::Test
+{
+  protected:
+    static Tracer::TimePoint now() { return Tracer::Clock::now(); }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(TracerTest, disabled)
+{
+    Tracer t;
+    EXPECT_FALSE(t.enabled());
+    t.record("ignored", 0, now(), now());
+    EXPECT_EQ(0, t.num_threads());
+    EXPECT_EQ(0, t.num_events());
+
+    // Global tracer is disabled unless requested from the environment
+    {
+        ScopedTrace trace("scoped");
+    }
+}
+
+TEST_F(TracerTest, threads)
+{
+    Tracer::Options opts;
+    opts.capacity = 8;
+    Tracer t(opts);
+    EXPECT_TRUE(t.enabled());
+
+    auto record_events = [&t](size_type count) {
+        for (size_type i = 0; i < count; ++i)
+        {
+            auto begin = Tracer::Clock::now();
+            t.record("stage", i, begin, Tracer::Clock::now());
+        }
+    };
+
+    record_events(3);
+    std::thread other(record_events, 5);
+    other.join();
+    record_events(2);
+
+    EXPECT_EQ(2, t.num_threads());
+    EXPECT_EQ(10, t.num_events());
+    EXPECT_EQ(0, t.num_dropped());
+}
+
+TEST_F(TracerTest, overflow)
+{
+    Tracer::Options opts;
+    opts.capacity = 4;
+    Tracer t(opts);
+
+    for (size_type i = 0; i < 10; ++i)
+    {
+        t.record("stage", i, now(), now());
+    }
+    EXPECT_EQ(1, t.num_threads());
+    EXPECT_EQ(4, t.num_events());
+    EXPECT_EQ(6, t.num_dropped());
+
+    // Only the newest events are written, oldest first
+    std::ostringstream os;
+    t.write(os);
+    const std::string out = os.str();
+    EXPECT_EQ(std::string::npos, out.find("\"step\":5}"));
+    auto first = out.find("\"step\":6}");
+    auto last  = out.find("\"step\":9}");
+    ASSERT_NE(std::string::npos, first);
+    ASSERT_NE(std::string::npos, last);
+    EXPECT_LT(first, last);
+}
+
+TEST_F(TracerTest, write)
+{
+    Tracer t(Tracer::Options{});
+    auto   begin = now();
+    t.record("pre_step", 12, begin, now());
+    t.record("load \"params\"", Tracer::no_step(), begin, now());
+
+    std::ostringstream os;
+    t.write(os);
+    const std::string out = os.str();
+    EXPECT_NE(std::string::npos, out.find("\"traceEvents\""));
+
+#if CELERITAS_USE_JSON
+    auto j      = nlohmann::json::parse(out);
+    auto events = j.at("traceEvents");
+    ASSERT_EQ(3, events.size());
+    EXPECT_EQ("M", events[0].at("ph").get<std::string>());
+    EXPECT_EQ("pre_step", events[1].at("name").get<std::string>());
+    EXPECT_EQ("X", events[1].at("ph").get<std::string>());
+    EXPECT_EQ(12, events[1].at("args").at("step").get<int>());
+    EXPECT_GE(events[1].at("dur").get<double>(), 0);
+    EXPECT_EQ("load \"params\"", events[2].at("name").get<std::string>());
+    EXPECT_EQ(0, events[2].count("args"));
+#endif
+}
+
+TEST_F(TracerTest, filename)
+{
+    Communicator comm
+        = (ScopedMpiInit::status() == ScopedMpiInit::Status::initialized
+               ? Communicator::comm_world()
+               : Communicator{});
+    std::string expected = "tracer-filename.json";
+    if (comm.size() > 1)
+    {
+        expected += '.' + std::to_string(comm.rank());
+    }
+    std::remove(expected.c_str());
+
+    {
+        // The rank is looked up when the file is written, even without events
+        Tracer::Options opts;
+        opts.filename = "tracer-filename.json";
+        Tracer t(opts);
+    }
+    std::ifstream infile(expected);
+    EXPECT_TRUE(infile) << "Missing trace file " << expected;
+    infile.close();
+    std::remove(expected.c_str());
+}
@@ -6,6 +6,7 @@
 //! \file KleinNishina.test.cc
 //---------------------------------------------------------------------------//
 #include "physics/em/detail/KleinNishinaInteractor.hh"
+#include "physics/em/detail/KleinNishinaBatchInteractor.hh"
 
 #include "celeritas_test.hh"
 #include "base/ArrayUtils.hh"
@@ -14,6 +15,7 @@
 #include "../InteractorHostTestBase.hh"
 #include "../InteractionIO.hh"
 
+using celeritas::detail::KleinNishinaBatchInteractor;
 using celeritas::detail::KleinNishinaInteractor;
 namespace pdg = celeritas::pdg;
 
@@ -246,3 +248,76 @@ TEST_F(KleinNishinaInteractorTest, distributions)
     EXPECT_VEC_EQ(expected_eps_dist, eps_dist);
     EXPECT_VEC_EQ(expected_costheta_dist, costheta_dist);
 }
+
+TEST_F(KleinNishinaInteractorTest, batch)
+{
+    RandomEngine& rng_engine = this->rng();
+
+    // Use a size that isn't a multiple of the block size
+    const int    num_samples   = 10000;
+    const double inc_energy    = 1;
+    Real3        inc_direction = {0, 0, 1};
+    std::vector<double> energy(num_samples, inc_energy);
+    std::vector<Real3>  direction(num_samples, inc_direction);
+
+    std::vector<double>                out_energy(num_samples);
+    std::vector<Real3>                 out_direction(num_samples);
+    std::vector<celeritas::Secondary> electrons(num_samples);
+
+    KleinNishinaBatchInteractor interact(
+        pointers_, celeritas::make_span(energy), celeritas::make_span(direction));
+    interact(rng_engine,
+             {celeritas::make_span(out_energy),
+              celeritas::make_span(out_direction),
+              celeritas::make_span(electrons)});
+
+    int              nbins = 10;
+    std::vector<int> eps_dist(nbins);
+    std::vector<int> costheta_dist(nbins);
+    for (int i = 0; i < num_samples; ++i)
+    {
+        // Check conservation
+        const auto& electron = electrons[i];
+        EXPECT_EQ(pointers_.electron_id, electron.particle_id);
+        EXPECT_SOFT_EQ(inc_energy, out_energy[i] + electron.energy.value());
+        EXPECT_SOFT_EQ(1.0, celeritas::norm(out_direction[i]));
+        EXPECT_SOFT_EQ(1.0, celeritas::norm(electron.direction));
+        Real3 electron_momentum;
+        for (int j = 0; j < 3; ++j)
+        {
+            electron_momentum[j] = inc_direction[j] * inc_energy
+                                   - out_direction[i][j] * out_energy[i];
+        }
+        celeritas::normalize_direction(&electron_momentum);
+        EXPECT_VEC_SOFT_EQ(electron_momentum, electron.direction);
+        EXPECT_LT(0, out_energy[i]);
+
+        int eps_bin = out_energy[i] / inc_energy * nbins;
+        if (eps_bin >= 0 && eps_bin < nbins)
+        {
+            ++eps_dist[eps_bin];
+        }
+        double costheta = celeritas::dot_product(inc_direction,
+                                                 out_direction[i]);
+        int    ct_bin   = (1 + costheta) / 2 * nbins;
+        if (ct_bin >= 0 && ct_bin < nbins)
+        {
+            ++costheta_dist[ct_bin];
+        }
+    }
+
+    // Compare against the scalar distributions within statistical noise
+    const int expected_eps_dist[]
+        = {0, 0, 2010, 1365, 1125, 1067, 1077, 1066, 1123, 1167};
+    const int expected_costheta_dist[]
+        = {495, 459, 512, 528, 565, 701, 803, 1101, 1693, 3143};
+    for (int i = 0; i < nbins; ++i)
+    {
+        EXPECT_NEAR(expected_eps_dist[i],
+                    eps_dist[i],
+                    5 * std::sqrt(expected_eps_dist[i] + 10.0));
+        EXPECT_NEAR(expected_costheta_dist[i],
+                    costheta_dist[i],
+                    5 * std::sqrt(expected_costheta_dist[i] + 10.0));
+    }
+}
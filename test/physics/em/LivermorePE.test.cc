@@ -9,6 +9,7 @@
 #include "physics/em/LivermorePEModel.hh"
 #include "physics/em/LivermorePEMacroXsCalculator.hh"
 
+#include <algorithm>
 #include <cmath>
 #include <fstream>
 #include <map>
@@ -402,7 +403,7 @@ TEST_F(LivermorePETest, distributions_all)
     }
     EXPECT_EQ(max_secondary * num_samples,
               this->secondary_allocator().get().size());
-    EXPECT_EQ(2180, num_secondaries);
+    EXPECT_EQ(2160, num_secondaries);
 
     for (const auto& it : energy_to_count)
     {
@@ -410,18 +411,18 @@ TEST_F(LivermorePETest, distributions_all)
         count.push_back(it.second);
     }
     const double expected_costheta_dist[]
-        = {23, 61, 83, 129, 135, 150, 173, 134, 85, 27};
+        = {24, 61, 85, 126, 145, 151, 162, 134, 89, 23};
     const double expected_energy[] = {
         2.901e-05,  3.202e-05,  4.576e-05,  4.604e-05,  4.877e-05,  4.905e-05,
-        6.529e-05,  6.83e-05,   0.00021764, 0.00022065, 0.00023439, 0.00023467,
-        0.0002374,  0.00023768, 0.00025114, 0.00025142, 0.0002517,  0.00025392,
-        0.00025415, 0.00025443, 0.00025471, 0.00027095, 0.00027368, 0.00029016,
-        0.00030691, 0.00030719, 0.00034347, 0.00062884, 0.00069835, 0.00070136,
-        0.0009595,  0.00097625, 0.00097653,
+        6.83e-05,   0.00021764, 0.00022065, 0.00023439, 0.00023467, 0.0002374,
+        0.00023768, 0.00025114, 0.00025142, 0.0002517,  0.00025415, 0.00025443,
+        0.00025471, 0.00026115, 0.00027095, 0.00027368, 0.00029016, 0.00030691,
+        0.00030719, 0.00062884, 0.00069835, 0.00070136, 0.0009595,  0.00097625,
+        0.00097653,
     };
     const int expected_count[] = {
-        42, 80, 26,  24, 27, 54, 2, 5, 5,  5, 4,   141, 61,  3,  2,  169, 260,
-        1,  39, 195, 2,  8,  5,  3, 2, 14, 1, 280, 216, 424, 32, 16, 32};
+        39, 80, 22, 20, 23, 56, 3, 3,  3,   3,   144, 57, 5,  3,  166, 253,
+        45, 190, 6, 1,  7,  5,  1, 11, 14, 269, 231, 417, 31, 18, 34};
     EXPECT_VEC_EQ(expected_costheta_dist, costheta_dist);
     EXPECT_VEC_SOFT_EQ(expected_energy, energy);
     EXPECT_VEC_EQ(expected_count, count);
@@ -489,7 +490,7 @@ TEST_F(LivermorePETest, distributions_radiative)
     }
     EXPECT_EQ(max_secondary * num_samples,
               this->secondary_allocator().get().size());
-    EXPECT_EQ(10007, num_secondaries);
+    EXPECT_EQ(10008, num_secondaries);
 
     for (const auto& it : energy_to_count)
     {
@@ -498,10 +499,9 @@ TEST_F(LivermorePETest, distributions_radiative)
     }
     const double expected_energy[] = {
         6.951e-05,
+        7.252e-05,
         0.00025814,
         0.00026115,
-        0.00034741,
-        0.00034769,
         0.00062884,
         0.00069835,
         0.00070136,
@@ -511,11 +511,86 @@ TEST_F(LivermorePETest, distributions_radiative)
         0.00099578,
     };
     const int expected_count[]
-        = {2, 1, 1, 1, 2, 2525, 2228, 4358, 337, 181, 361, 10};
+        = {2, 2, 1, 3, 2525, 2228, 4357, 337, 182, 361, 10};
     EXPECT_VEC_SOFT_EQ(expected_energy, energy);
     EXPECT_VEC_EQ(expected_count, count);
 }
 
+TEST_F(LivermorePETest, distributions_precomputed)
+{
+    RandomEngine& rng_engine = this->rng();
+
+    const int num_samples = 10000;
+
+    // Sampled element
+    ElementId el_id{0};
+
+    // Production cuts
+    auto cutoffs = this->cutoff_params()->get(MaterialId{0});
+
+    // Sample secondary energies with and without precomputed cascades
+    std::vector<std::map<double, int>> energy_to_count(2);
+    std::vector<int>                   num_secondaries(2);
+    for (bool precompute : {false, true})
+    {
+        relax_inp_.is_auger_enabled   = true;
+        relax_inp_.precompute_cascade = precompute;
+        set_relaxation_params(relax_inp_);
+        EXPECT_EQ(precompute, relax_params_->precompute_cascade());
+
+        auto pointers              = model_->host_pointers();
+        pointers.atomic_relaxation = relax_params_->host_pointers();
+
+        const auto& el = pointers.atomic_relaxation.elements[el_id.get()];
+        if (precompute)
+        {
+            // No vacancy stack is needed, and the most unlikely cascades
+            // (with the most secondaries) are discarded
+            EXPECT_EQ(0, el.max_stack_size);
+            EXPECT_EQ(5, el.max_secondary);
+        }
+        else
+        {
+            EXPECT_EQ(4, el.max_stack_size);
+            EXPECT_EQ(7, el.max_secondary);
+            this->resize_vacancies(el.max_stack_size * num_samples);
+        }
+        this->resize_secondaries((el.max_secondary + 1) * num_samples);
+
+        LivermorePEInteractor interact(pointers,
+                                       scratch_,
+                                       el_id,
+                                       this->particle_track(),
+                                       cutoffs,
+                                       this->direction(),
+                                       this->secondary_allocator());
+
+        for (int i = 0; i < num_samples; ++i)
+        {
+            Interaction out = interact(rng_engine);
+            SCOPED_TRACE(out);
+            ASSERT_TRUE(out);
+            this->check_energy_conservation(out);
+            num_secondaries[precompute] += out.secondaries.size();
+            for (const auto& secondary : out.secondaries)
+            {
+                energy_to_count[precompute][secondary.energy.value()]++;
+            }
+        }
+    }
+    EXPECT_EQ(21514, num_secondaries[false]);
+    EXPECT_EQ(21374, num_secondaries[true]);
+
+    // The same discrete energies are produced at statistically consistent
+    // rates
+    for (const auto& it : energy_to_count[true])
+    {
+        int expected = energy_to_count[false][it.first];
+        EXPECT_NEAR(expected, it.second, 5 * std::sqrt(expected + 10.0))
+            << "for energy " << it.first;
+    }
+}
+
 TEST_F(LivermorePETest, macro_xs)
 {
     using celeritas::units::MevEnergy;
@@ -552,6 +627,44 @@ TEST_F(LivermorePETest, macro_xs)
     EXPECT_VEC_SOFT_EQ(expected_macro_xs, macro_xs);
 }
 
+TEST_F(LivermorePETest, tabulated_elements)
+{
+    using celeritas::AllItems;
+    using celeritas::ModelId;
+
+    // Exact element selection is the default
+    EXPECT_FALSE(model_->host_pointers().element_tables);
+
+    LivermorePEModel::Options opts;
+    opts.tabulate_elements = true;
+    std::string       data_path = this->test_data_path("physics/em", "");
+    LivermorePEReader read_element_data(data_path.c_str());
+    LivermorePEModel  model(ModelId{0},
+                           *this->particle_params(),
+                           *this->material_params(),
+                           read_element_data,
+                           nullptr,
+                           0,
+                           opts);
+
+    const auto& pe = model.host_pointers();
+    ASSERT_TRUE(pe.element_tables);
+    auto loge = pe.element_tables.log_energy[AllItems<celeritas::real_type>{}];
+    EXPECT_TRUE(std::is_sorted(loge.begin(), loge.end()));
+
+    // Grid has points just below and above every subshell binding energy
+    for (const auto& shell :
+         pe.xs.shells[AllItems<celeritas::detail::LivermoreSubshell>{}])
+    {
+        const double edge = std::log(shell.binding_energy.value());
+        auto iter = std::lower_bound(loge.begin(), loge.end(), edge);
+        ASSERT_NE(loge.begin(), iter);
+        ASSERT_NE(loge.end(), iter);
+        EXPECT_SOFT_NEAR(edge, *(iter - 1), 1e-5);
+        EXPECT_SOFT_NEAR(edge, *iter, 1e-5);
+    }
+}
+
 TEST_F(LivermorePETest, max_secondaries)
 {
     using celeritas::AtomicRelaxElement;
@@ -14,6 +14,7 @@
 #include "physics/base/Units.hh"
 #include "physics/material/MaterialTrackView.hh"
 
+#include <cmath>
 #include "celeritas_test.hh"
 #include "base/ArrayUtils.hh"
 #include "base/Range.hh"
@@ -210,3 +211,89 @@ TEST_F(RayleighInteractorTest, stress_test)
     EXPECT_VEC_SOFT_EQ(expected_average_rng_counts, average_rng_counts);
     EXPECT_VEC_SOFT_EQ(expected_average_angle, average_angle);
 }
+
+TEST_F(RayleighInteractorTest, tabulated)
+{
+    const int num_samples = 8192;
+
+    // Build models with and without tabulated angular distributions
+    RayleighModel::Options opts;
+    opts.tabulate_angular = true;
+    RayleighModel tab_model(
+        ModelId{0}, *this->particle_params(), *this->material_params(), opts);
+    ASSERT_TRUE(tab_model.host_group().tables);
+    EXPECT_FALSE(model_->host_group().tables);
+
+    // Sample from the heaviest element
+    ElementId el_id{2};
+
+    std::vector<real_type> average_angle;
+    std::vector<real_type> average_rng_counts;
+    std::vector<real_type> fit_average_angle;
+
+    for (double inc_e : {1e-5, 1e-4, 0.001, 0.01, 0.1, 1., 10., 100., 1000.})
+    {
+        this->set_inc_particle(pdg::gamma(), MevEnergy{inc_e});
+        RandomEngine& rng_engine = this->rng();
+
+        RayleighInteractor interact(tab_model.host_group(),
+                                    this->particle_track(),
+                                    this->direction(),
+                                    el_id);
+
+        real_type sum_angle = 0;
+        for (CELER_MAYBE_UNUSED auto i : celeritas::range(num_samples))
+        {
+            celeritas::Interaction result = interact(rng_engine);
+            SCOPED_TRACE(result);
+            this->sanity_check(result);
+            sum_angle += dot_product(result.direction, this->direction());
+        }
+
+        average_rng_counts.push_back(real_type(rng_engine.count())
+                                     / real_type(num_samples));
+        average_angle.push_back(sum_angle / num_samples);
+
+        // Sample using rejection from the form factor fit
+        RayleighInteractor interact_fit(this->model_->host_group(),
+                                        this->particle_track(),
+                                        this->direction(),
+                                        el_id);
+        sum_angle = 0;
+        for (CELER_MAYBE_UNUSED auto i : celeritas::range(num_samples))
+        {
+            celeritas::Interaction result = interact_fit(rng_engine);
+            sum_angle += dot_product(result.direction, this->direction());
+        }
+        fit_average_angle.push_back(sum_angle / num_samples);
+    }
+
+    // At most three canonical draws (six 32-bit samples) per interaction
+    const real_type expected_average_rng_counts[]
+        = {4, 6, 6, 6, 6, 6, 6, 6, 6};
+
+    const real_type expected_average_angle[] = {0.009481701181513,
+                                                0.005288707252224,
+                                                0.006481680350481,
+                                                0.296710359821,
+                                                0.8169178311736,
+                                                0.9786783026386,
+                                                0.9974503735881,
+                                                0.9999101714822,
+                                                0.9999858525756};
+
+    EXPECT_VEC_SOFT_EQ(expected_average_rng_counts, average_rng_counts);
+    EXPECT_VEC_SOFT_EQ(expected_average_angle, average_angle);
+
+    // Tabulated and rejection sampling agree within statistical noise: the
+    // variance of each sampled cosine is at most 1 - mu^2, so the standard
+    // deviation of the difference in means is bounded by the combined error
+    for (auto i : celeritas::range(average_angle.size()))
+    {
+        const real_type mu_tab = average_angle[i];
+        const real_type mu_fit = fit_average_angle[i];
+        const real_type sigma
+            = std::sqrt((2 - mu_tab * mu_tab - mu_fit * mu_fit) / num_samples);
+        EXPECT_NEAR(mu_fit, mu_tab, 4 * sigma) << "at index " << i;
+    }
+}
@@ -13,6 +13,7 @@
 #include "base/Range.hh"
 #include "base/SoftEqual.hh"
 #include "physics/grid/Interpolator.hh"
+#include "physics/grid/UniformGrid.hh"
 
 using namespace celeritas;
 
@@ -22,6 +23,7 @@ namespace celeritas_test
 void CalculatorTestBase::build(real_type emin, real_type emax, size_type count)
 {
     CELER_EXPECT(count >= 2);
+    data_ = XsGridData{};
     data_.log_energy
         = UniformGridData::from_bounds(std::log(emin), std::log(emax), count);
 
@@ -55,6 +57,26 @@ void CalculatorTestBase::set_prime_index(size_type i)
     data_.prime_index = i;
 }
 
+//---------------------------------------------------------------------------//
+/*!
+ * Store the energy of each grid point
+ */
+void CalculatorTestBase::add_grid_energy()
+{
+    CELER_EXPECT(data_);
+    UniformGrid            loge_grid(data_.log_energy);
+    std::vector<real_type> temp_e(loge_grid.size());
+    for (auto i : range(temp_e.size()))
+    {
+        temp_e[i] = std::exp(loge_grid[i]);
+    }
+    data_.energy
+        = make_builder(&value_storage_).insert_back(temp_e.begin(), temp_e.end());
+    value_ref_ = value_storage_;
+
+    CELER_ENSURE(data_);
+}
+
 //---------------------------------------------------------------------------//
 /*!
  * Get cross sections that can be modified.
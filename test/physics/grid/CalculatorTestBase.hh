@@ -39,6 +39,7 @@ class CalculatorTestBase : public celeritas::Test
     // Construct linear cross sections
     void     build(real_type emin, real_type emax, size_type count);
     void     set_prime_index(size_type i);
+    void     add_grid_energy();
     SpanReal mutable_values();
 
     const XsGridData& data() const { return data_; }
@@ -43,6 +43,9 @@ TEST_F(ValueGridInserterTest, all)
         EXPECT_EQ(3, inserted.log_energy.size);
         EXPECT_EQ(1, inserted.prime_index);
         EXPECT_VEC_SOFT_EQ(values, real_storage[inserted.value]);
+
+        const real_type energy[] = {1, 1.6487212707001282, 2.718281828459045};
+        EXPECT_VEC_SOFT_EQ(energy, real_storage[inserted.energy]);
     }
     {
         const real_type values[] = {1, 2, 4, 6, 8};
@@ -56,5 +59,22 @@ TEST_F(ValueGridInserterTest, all)
         EXPECT_EQ(XsGridData::no_scaling(), inserted.prime_index);
         EXPECT_VEC_SOFT_EQ(values, real_storage[inserted.value]);
     }
-    EXPECT_EQ(2, grid_storage.size());
+    {
+        // Grids sharing a log-energy grid, even from a copied inserter,
+        // share the stored energies
+        const real_type values[] = {5, 6, 7};
+
+        ValueGridInserter copied = insert;
+        auto              idx    = copied(
+            UniformGridData::from_bounds(0.0, 1.0, 3), make_span(values));
+        EXPECT_EQ(2, idx.unchecked_get());
+        const XsGridData& inserted = grid_storage[idx];
+        const XsGridData& first = grid_storage[ValueGridInserter::XsIndex{0}];
+
+        EXPECT_VEC_SOFT_EQ(values, real_storage[inserted.value]);
+        EXPECT_EQ(first.energy.begin(), inserted.energy.begin());
+        EXPECT_EQ(first.energy.end(), inserted.energy.end());
+    }
+    EXPECT_EQ(3, grid_storage.size());
+    EXPECT_EQ(3 + 3 + 5 + 5 + 3, real_storage.size());
 }
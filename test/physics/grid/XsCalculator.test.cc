@@ -147,6 +147,60 @@ TEST_F(XsCalculatorTest, scaled_highest)
     EXPECT_SOFT_EQ(.1, calc(Energy{1000}));
 }
 
+TEST_F(XsCalculatorTest, batch)
+{
+    // Energies including grid points, midpoints, and out-of-bounds values
+    std::vector<real_type> energy;
+    for (real_type e = 1e-3; e < 1e6; e *= 1.1)
+    {
+        energy.push_back(e);
+    }
+    for (real_type e : {0.1, 1.0, 10.0, 100.0, 1e3, 1e4})
+    {
+        energy.push_back(e);
+    }
+
+    for (size_type prime_index : {XsGridData::no_scaling(),
+                                  size_type(0),
+                                  size_type(3),
+                                  size_type(5)})
+    {
+        this->build(0.1, 1e4, 6);
+        if (prime_index != XsGridData::no_scaling())
+        {
+            this->set_prime_index(prime_index);
+        }
+
+        // Reference from scalar calculation
+        std::vector<real_type> expected(energy.size());
+        {
+            XsCalculator calc(this->data(), this->values());
+            for (auto i : range(energy.size()))
+            {
+                expected[i] = calc(Energy{energy[i]});
+            }
+
+            // Without precomputed energies, the batch falls back to scalar
+            std::vector<real_type> actual(energy.size());
+            calc(make_span(energy), make_span(actual));
+            EXPECT_VEC_EQ(expected, actual);
+        }
+
+        this->add_grid_energy();
+        XsCalculator calc(this->data(), this->values());
+
+        // Scalar results with precomputed energies
+        for (auto i : range(energy.size()))
+        {
+            EXPECT_SOFT_EQ(expected[i], calc(Energy{energy[i]}));
+        }
+
+        std::vector<real_type> actual(energy.size());
+        calc(make_span(energy), make_span(actual));
+        EXPECT_VEC_SOFT_EQ(expected, actual);
+    }
+}
+
 TEST_F(XsCalculatorTest, TEST_IF_CELERITAS_DEBUG(scaled_off_the_end))
 {
     // values of 1, 10, 100 --> actual xs = {1, 10, 100}
@@ -0,0 +1,261 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TabulatedElementSelector.test.cc
+//---------------------------------------------------------------------------//
+#include "physics/material/TabulatedElementSelector.hh"
+
+#include <cmath>
+#include <memory>
+#include <random>
+#include "celeritas_test.hh"
+#include "base/Range.hh"
+#include "physics/material/ElementSelector.hh"
+#include "physics/material/ElementTableBuilder.hh"
+#include "physics/material/MaterialParams.hh"
+
+using namespace celeritas;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class TabulatedElementSelectorTest : public celeritas::Test
+{
+  public:
+    //!@{
+    //! Type aliases
+    using RandomEngine = std::mt19937;
+    using MevEnergy    = units::MevEnergy;
+    using HostData     = ElementTableBuilder::HostData;
+    using HostRef
+        = ElementTableData<Ownership::const_reference, MemSpace::host>;
+    //!@}
+
+  protected:
+    void SetUp() override
+    {
+        using celeritas::units::AmuMass;
+
+        MaterialParams::Input inp;
+        inp.elements = {
+            {1, AmuMass{1.008}, "H"},
+            {11, AmuMass{22.98976928}, "Na"},
+            {13, AmuMass{26.9815385}, "Al"},
+            {53, AmuMass{126.90447}, "I"},
+        };
+        inp.materials = {
+            {0.0, 0.0, MatterState::unspecified, {}, "hard_vacuum"},
+            {0.1 * constants::na_avogadro,
+             293.0,
+             MatterState::gas,
+             {{ElementId{2}, 1.0}},
+             "Al"},
+            {1 * constants::na_avogadro,
+             293.0,
+             MatterState::solid,
+             {{ElementId{0}, 0.48},
+              {ElementId{1}, 0.24},
+              {ElementId{2}, 0.16},
+              {ElementId{3}, 0.12}},
+             "everything_weighted"},
+            {1 * constants::na_avogadro,
+             293.0,
+             MatterState::solid,
+             {{ElementId{0}, 0.5}, {ElementId{3}, 0.5}},
+             "HI"},
+        };
+        mats = std::make_shared<MaterialParams>(std::move(inp));
+
+        // Grid points at 1, 10, 100 MeV
+        log_grid = UniformGridData::from_bounds(0, std::log(100.0), 3);
+    }
+
+    //! Tally selected components
+    std::vector<int> sample(const HostRef& ref,
+                            const char*    mat_name,
+                            MevEnergy      energy,
+                            int            num_samples)
+    {
+        TabulatedElementSelector select_el(ref, mats->find(mat_name), energy);
+        std::vector<int> tally(
+            mats->get(mats->find(mat_name)).num_elements(), 0);
+        for (CELER_MAYBE_UNUSED auto i : range(num_samples))
+        {
+            auto comp_id = select_el(rng);
+            EXPECT_LT(comp_id.get(), tally.size());
+            ++tally[comp_id.get()];
+        }
+        return tally;
+    }
+
+    std::shared_ptr<MaterialParams> mats;
+    UniformGridData                 log_grid;
+    RandomEngine                    rng;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(TabulatedElementSelectorTest, build)
+{
+    ElementTableBuilder build_tables(*mats, log_grid);
+    HostData            data = build_tables(
+        [](ElementId el, MevEnergy) { return real_type(el.get() + 1); });
+    ASSERT_TRUE(data);
+    ASSERT_EQ(mats->num_materials(), data.materials.size());
+
+    // Vacuum has no table and can't be sampled
+    const auto& vacuum = data.materials[MaterialId{0}];
+    EXPECT_EQ(0, vacuum.num_elements);
+    EXPECT_FALSE(vacuum);
+
+    // Single-element materials don't need a table
+    const auto& al = data.materials[MaterialId{1}];
+    EXPECT_EQ(1, al.num_elements);
+    EXPECT_TRUE(al.entries.empty());
+    EXPECT_TRUE(al);
+
+    // One alias table per energy point
+    const auto& weighted = data.materials[MaterialId{2}];
+    EXPECT_EQ(4, weighted.num_elements);
+    EXPECT_EQ(4 * 3, weighted.entries.size());
+    EXPECT_TRUE(weighted);
+
+    const auto& hi = data.materials[MaterialId{3}];
+    EXPECT_EQ(2 * 3, hi.entries.size());
+    EXPECT_EQ(4 * 3 + 2 * 3, data.entries.size());
+}
+
+//! Number densities scaled to 1/xs so equiprobable
+TEST_F(TabulatedElementSelectorTest, everything_weighted)
+{
+    ElementTableBuilder build_tables(*mats, log_grid);
+    HostData            data = build_tables(
+        [](ElementId el, MevEnergy) { return real_type(el.get() + 1); });
+    HostRef ref;
+    ref = data;
+
+    // Single element never consumes a random number
+    EXPECT_EQ(std::vector<int>({100}),
+              this->sample(ref, "Al", MevEnergy{1}, 100));
+
+    // Out-of-bounds and in-bounds energies all give the same result
+    for (real_type e : {0.1, 1.0, 3.0, 100.0, 1000.0})
+    {
+        auto tally
+            = this->sample(ref, "everything_weighted", MevEnergy{e}, 40000);
+        for (int count : tally)
+        {
+            EXPECT_SOFT_NEAR(0.25, count / 40000.0, 0.05) << "at E=" << e;
+        }
+    }
+}
+
+//! Energy-dependent cross sections are interpolated between grid points
+TEST_F(TabulatedElementSelectorTest, interpolated)
+{
+    // Hydrogen xs is zero at 1 MeV and equal to iodine at 10 MeV and above
+    ElementTableBuilder build_tables(*mats, log_grid);
+    HostData            data
+        = build_tables([](ElementId el, MevEnergy energy) -> real_type {
+              if (el.get() == 0)
+                  return energy.value() > 2 ? 1 : 0;
+              return 1;
+          });
+    HostRef ref;
+    ref = data;
+
+    const int num_samples = 40000;
+    auto      tally = this->sample(ref, "HI", MevEnergy{1}, num_samples);
+    EXPECT_EQ(0, tally[0]);
+    EXPECT_EQ(num_samples, tally[1]);
+
+    // Halfway between 1 and 10 in log space: H sampled a quarter of the time
+    tally = this->sample(ref, "HI", MevEnergy{std::sqrt(10.0)}, num_samples);
+    EXPECT_SOFT_NEAR(0.25, tally[0] / real_type(num_samples), 0.05);
+
+    tally = this->sample(ref, "HI", MevEnergy{50}, num_samples);
+    EXPECT_SOFT_NEAR(0.5, tally[0] / real_type(num_samples), 0.05);
+}
+
+//! All-zero cross sections fall back to number fractions
+TEST_F(TabulatedElementSelectorTest, zero_xs)
+{
+    ElementTableBuilder build_tables(*mats, log_grid);
+    HostData data = build_tables([](ElementId, MevEnergy) { return 0.0; });
+    HostRef  ref;
+    ref = data;
+
+    const int num_samples = 40000;
+    auto      tally
+        = this->sample(ref, "everything_weighted", MevEnergy{5}, num_samples);
+    const double expected_frac[] = {0.48, 0.24, 0.16, 0.12};
+    for (auto i : range(tally.size()))
+    {
+        EXPECT_SOFT_NEAR(
+            expected_frac[i], tally[i] / real_type(num_samples), 0.05);
+    }
+}
+
+//! Selection matches on-the-fly sampling on both sides of a cross section edge
+TEST_F(TabulatedElementSelectorTest, edge)
+{
+    // Iodine xs jumps by a factor of 9 at an edge between grid points
+    const MevEnergy edge{3};
+    auto calc_xs = [edge](ElementId el, MevEnergy energy) -> real_type {
+        return el.get() == 3 && energy > edge ? 9 : 1;
+    };
+
+    ElementTableBuilder build_tables(*mats, log_grid, {edge});
+    EXPECT_EQ(3 + 2, build_tables.log_energy().size());
+    HostData data = build_tables(calc_xs);
+    HostRef  ref;
+    ref = data;
+
+    // Without the edge, selection is interpolated across it
+    ElementTableBuilder build_uniform(*mats, log_grid);
+    HostData            uniform_data = build_uniform(calc_xs);
+    HostRef             uniform_ref;
+    uniform_ref = uniform_data;
+
+    const MaterialView     material = mats->get(mats->find("HI"));
+    std::vector<real_type> storage(material.num_elements());
+    const int              num_samples = 40000;
+
+    // Fraction of hydrogen just below and just above the edge
+    const real_type energies[]   = {3 * (1 - 1e-4), 3 * (1 + 1e-4)};
+    const real_type expected_h[] = {0.5, 0.1};
+    for (auto i : range(2))
+    {
+        const MevEnergy energy{energies[i]};
+        ElementSelector select_exact(
+            material,
+            [&calc_xs, energy](ElementId el) { return calc_xs(el, energy); },
+            make_span(storage));
+        int exact_h = 0;
+        for (CELER_MAYBE_UNUSED auto j : range(num_samples))
+        {
+            if (select_exact(rng) == ElementComponentId{0})
+            {
+                ++exact_h;
+            }
+        }
+        auto tally = this->sample(ref, "HI", energy, num_samples);
+
+        EXPECT_NEAR(expected_h[i], exact_h / real_type(num_samples), 0.01)
+            << "at E=" << energy.value();
+        EXPECT_NEAR(exact_h / real_type(num_samples),
+                    tally[0] / real_type(num_samples),
+                    0.01)
+            << "at E=" << energy.value();
+    }
+
+    // Below the edge, the uniform grid interpolates toward the upper value
+    auto tally = this->sample(
+        uniform_ref, "HI", MevEnergy{energies[0]}, num_samples);
+    EXPECT_LT(tally[0] / real_type(num_samples), 0.4);
+}
@@ -0,0 +1,149 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file BufferedRngEngine.test.cc
+//---------------------------------------------------------------------------//
+#include "random/BufferedRngEngine.hh"
+
+#include <random>
+#include "base/CollectionAlgorithms.hh"
+#include "random/detail/Philox.hh"
+#include "celeritas_test.hh"
+#include "DiagnosticRngEngine.hh"
+
+using namespace celeritas;
+using celeritas_test::DiagnosticRngEngine;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class BufferedRngEngineTest : public celeritas::Test
+{
+  protected:
+    using BufferValue = RngBufferData<Ownership::value, MemSpace::host>;
+    using BufferRef   = RngBufferData<Ownership::reference, MemSpace::host>;
+    using BufferCRef
+        = RngBufferData<Ownership::const_reference, MemSpace::host>;
+    using RandomEngine = DiagnosticRngEngine<std::mt19937>;
+
+    BufferValue  buffer;
+    RandomEngine fallback;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(BufferedRngEngineTest, philox)
+{
+    using detail::philox4x32;
+    using detail::PhiloxCounter;
+    using detail::PhiloxKey;
+
+    // Known-answer tests from the Random123 distribution
+    PhiloxCounter result = philox4x32({0, 0, 0, 0}, {0, 0});
+    EXPECT_EQ(0x6627e8d5u, result[0]);
+    EXPECT_EQ(0xe169c58du, result[1]);
+    EXPECT_EQ(0xbc57ac4cu, result[2]);
+    EXPECT_EQ(0x9b00dbd8u, result[3]);
+
+    result = philox4x32({0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu},
+                        {0xffffffffu, 0xffffffffu});
+    EXPECT_EQ(0x408f276du, result[0]);
+    EXPECT_EQ(0x41c83b0eu, result[1]);
+    EXPECT_EQ(0xa20bc7c6u, result[2]);
+    EXPECT_EQ(0x6d5451fdu, result[3]);
+
+    result = philox4x32({0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u},
+                        {0xa4093822u, 0x299f31d0u});
+    EXPECT_EQ(0xd16cfe09u, result[0]);
+    EXPECT_EQ(0x94fdccebu, result[1]);
+    EXPECT_EQ(0x5001e420u, result[2]);
+    EXPECT_EQ(0x24126ea1u, result[3]);
+
+    // Conversion to reals
+    EXPECT_EQ(0.0, detail::uint32_pair_to_canonical(0, 0));
+    EXPECT_EQ(1 - 1.0 / (1ull << 53),
+              detail::uint32_pair_to_canonical(0xffffffffu, 0xffffffffu));
+}
+
+TEST_F(BufferedRngEngineTest, generate)
+{
+    resize(&buffer, 100, 7);
+    EXPECT_EQ(100, buffer.num_streams);
+    EXPECT_EQ(8, buffer.capacity);
+
+    BufferRef ref;
+    ref = buffer;
+    generate_uniforms(ref, 12345, 0);
+    const auto first_pass = buffer.uniforms[AllItems<real_type>{}];
+
+    double total = 0;
+    for (real_type v : first_pass)
+    {
+        ASSERT_GE(v, 0);
+        ASSERT_LT(v, 1);
+        total += v;
+    }
+    EXPECT_SOFT_NEAR(0.5, total / first_pass.size(), 0.05);
+
+    // Generation is reproducible and depends on seed and pass
+    std::vector<real_type> expected(first_pass.begin(), first_pass.end());
+    generate_uniforms(ref, 12345, 0);
+    EXPECT_VEC_EQ(expected, buffer.uniforms[AllItems<real_type>{}]);
+    generate_uniforms(ref, 12345, 1);
+    EXPECT_NE(expected.front(), buffer.uniforms[AllItems<real_type>{}][0]);
+    generate_uniforms(ref, 54321, 0);
+    EXPECT_NE(expected.front(), buffer.uniforms[AllItems<real_type>{}][0]);
+
+    // Values for a track don't depend on the number of tracks
+    BufferValue small_buffer;
+    resize(&small_buffer, 3, 8);
+    BufferRef small_ref;
+    small_ref = small_buffer;
+    generate_uniforms(small_ref, 12345, 0);
+    for (size_type k = 0; k < 8; ++k)
+    {
+        EXPECT_EQ(expected[k * 100 + 2],
+                  small_buffer.uniforms[ItemId<real_type>{k * 3 + 2}]);
+    }
+}
+
+TEST_F(BufferedRngEngineTest, consume)
+{
+    resize(&buffer, 4, 2);
+    BufferRef ref;
+    ref = buffer;
+    generate_uniforms(ref, 12345, 0);
+    BufferCRef cref;
+    cref = buffer;
+
+    BufferedRngEngine<RandomEngine> rng(cref, ThreadId{1}, fallback);
+    EXPECT_EQ(0, rng.num_buffered());
+
+    // Buffered values for track 1 are used first
+    EXPECT_EQ(buffer.uniforms[ItemId<real_type>{1}], generate_canonical(rng));
+    EXPECT_EQ(buffer.uniforms[ItemId<real_type>{5}], generate_canonical(rng));
+    EXPECT_EQ(2, rng.num_buffered());
+    EXPECT_EQ(0, fallback.count());
+
+    // Then the fallback engine
+    real_type v = generate_canonical(rng);
+    EXPECT_GE(v, 0);
+    EXPECT_LT(v, 1);
+    EXPECT_EQ(1, rng.num_fallback());
+    EXPECT_EQ(2, fallback.count());
+
+    // Raw integers always come from the fallback
+    rng();
+    EXPECT_EQ(3, fallback.count());
+    EXPECT_EQ(2, rng.num_buffered());
+
+    // Single-precision values stay below 1
+    fill(real_type(1 - 1e-12), &buffer.uniforms);
+    BufferedRngEngine<RandomEngine> rng_float(cref, ThreadId{0}, fallback);
+    EXPECT_LT(generate_canonical<float>(rng_float), 1.0f);
+}
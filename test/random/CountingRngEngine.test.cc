@@ -0,0 +1,133 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file CountingRngEngine.test.cc
+//---------------------------------------------------------------------------//
+#include "random/CountingRngEngine.hh"
+
+#include <random>
+#include "random/distributions/BernoulliDistribution.hh"
+#include "celeritas_test.hh"
+#include "DiagnosticRngEngine.hh"
+
+using namespace celeritas;
+using celeritas_test::DiagnosticRngEngine;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class CountingRngEngineTest : public celeritas::Test
+{
+  protected:
+    using CounterValue = RngCounterData<Ownership::value, MemSpace::host>;
+    using CounterRef   = RngCounterData<Ownership::reference, MemSpace::host>;
+    using RandomEngine = DiagnosticRngEngine<std::mt19937>;
+
+    //! Sample with rejection, accepting with the given probability
+    struct RejectionSampler
+    {
+        real_type accept_prob;
+
+        template<class Engine>
+        real_type operator()(Engine& rng) const
+        {
+            real_type result;
+            do
+            {
+                result = generate_canonical(rng);
+            } while (!BernoulliDistribution(accept_prob)(rng));
+            return result;
+        }
+    };
+
+    RandomEngine rng;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(CountingRngEngineTest, count)
+{
+    CountingRngEngine<RandomEngine> counting_rng(rng);
+    EXPECT_EQ(0, counting_rng.count());
+
+    // Values are unchanged by counting
+    std::mt19937 reference_rng;
+    EXPECT_EQ(reference_rng(), counting_rng());
+    EXPECT_EQ(generate_canonical<double>(reference_rng),
+              generate_canonical<double>(counting_rng));
+    EXPECT_EQ(generate_canonical<float>(reference_rng),
+              generate_canonical<float>(counting_rng));
+
+    // Each sample counts once, regardless of the bits used by the engine
+    EXPECT_EQ(3, counting_rng.count());
+    EXPECT_EQ(4, rng.count());
+}
+
+TEST_F(CountingRngEngineTest, tally)
+{
+    CounterValue counters;
+    resize(&counters, 2, 64);
+    CounterRef counters_ref = make_ref(counters);
+
+    // Disabled counters leave the sampling unchanged
+    RejectionSampler sample{0.25};
+    sample_counted(sample, rng, CounterRef{}, 0);
+
+    // Each iteration of the rejection loop uses two draws
+    const int num_samples = 1000;
+    for (int i = 0; i < num_samples; ++i)
+    {
+        sample_counted(sample, rng, counters_ref, 1);
+    }
+
+    auto stats = calc_rng_counter_stats(counters);
+    ASSERT_EQ(2, stats.size());
+    EXPECT_EQ(0, stats[0].num_samples);
+    EXPECT_EQ(0, stats[0].mean);
+    EXPECT_EQ(num_samples, stats[1].num_samples);
+    EXPECT_EQ(0, stats[1].num_draws % 2);
+    EXPECT_SOFT_NEAR(8.0, stats[1].mean, 0.1);
+    EXPECT_EQ(6, stats[1].p50);
+    EXPECT_LE(stats[1].p50, stats[1].p90);
+    EXPECT_LE(stats[1].p90, stats[1].p99);
+    EXPECT_LE(stats[1].p99, stats[1].max);
+    EXPECT_GE(stats[1].max, 4);
+}
+
+TEST_F(CountingRngEngineTest, stats)
+{
+    CounterValue counters;
+    resize(&counters, 1, 4);
+    CounterRef counters_ref = make_ref(counters);
+
+    // 90 samples with 1 draw, 9 with 2, and 1 with 10 (in the overflow bin)
+    auto tally_draws = [&](int num_samples, int num_draws) {
+        for (int i = 0; i < num_samples; ++i)
+        {
+            CountingRngEngine<RandomEngine> counting_rng(rng);
+            for (int j = 0; j < num_draws; ++j)
+            {
+                counting_rng();
+            }
+            counting_rng.tally(counters_ref, 0);
+        }
+    };
+    tally_draws(90, 1);
+    tally_draws(9, 2);
+    tally_draws(1, 10);
+
+    auto stats = calc_rng_counter_stats(counters);
+    ASSERT_EQ(1, stats.size());
+    EXPECT_EQ(100, stats[0].num_samples);
+    EXPECT_EQ(90 + 18 + 10, stats[0].num_draws);
+    EXPECT_DOUBLE_EQ(1.18, stats[0].mean);
+    EXPECT_EQ(1, stats[0].p50);
+    EXPECT_EQ(1, stats[0].p90);
+    EXPECT_EQ(2, stats[0].p99);
+    EXPECT_EQ(10, stats[0].max);
+}
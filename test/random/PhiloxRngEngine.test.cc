@@ -0,0 +1,97 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file PhiloxRngEngine.test.cc
+//---------------------------------------------------------------------------//
+#include "random/PhiloxRngEngine.hh"
+
+#include <vector>
+#include "random/distributions/UniformRealDistribution.hh"
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class PhiloxRngEngineTest : public celeritas::Test
+{
+  protected:
+    static std::vector<PhiloxRngEngine::result_type>
+    draw(PhiloxRngEngine rng, int count)
+    {
+        std::vector<PhiloxRngEngine::result_type> result;
+        for (int i = 0; i < count; ++i)
+        {
+            result.push_back(rng());
+        }
+        return result;
+    }
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(PhiloxRngEngineTest, stream)
+{
+    // Values are the Philox output for the step's counter
+    const detail::PhiloxCounter expected
+        = detail::philox4x32({0, 3, 2, 1}, {0x9abcdef0u, 0x12345678u});
+    PhiloxRngEngine rng(0x123456789abcdef0ull, 1, 2, 3);
+    for (auto v : expected)
+    {
+        EXPECT_EQ(v, rng());
+    }
+
+    // The next block increments the counter
+    const detail::PhiloxCounter next
+        = detail::philox4x32({1, 3, 2, 1}, {0x9abcdef0u, 0x12345678u});
+    EXPECT_EQ(next[0], rng());
+}
+
+TEST_F(PhiloxRngEngineTest, independence)
+{
+    const auto ref = draw(PhiloxRngEngine(12345, 0, 10, 5), 8);
+
+    // Reconstructing the engine for the same step replays the stream
+    EXPECT_EQ(ref, draw(PhiloxRngEngine(12345, 0, 10, 5), 8));
+
+    // Each identifier selects a different stream
+    EXPECT_NE(ref, draw(PhiloxRngEngine(12346, 0, 10, 5), 8));
+    EXPECT_NE(ref, draw(PhiloxRngEngine(12345, 1, 10, 5), 8));
+    EXPECT_NE(ref, draw(PhiloxRngEngine(12345, 0, 11, 5), 8));
+    EXPECT_NE(ref, draw(PhiloxRngEngine(12345, 0, 10, 6), 8));
+}
+
+TEST_F(PhiloxRngEngineTest, canonical)
+{
+    PhiloxRngEngine rng(12345, 0, 0, 0);
+    UniformRealDistribution<double> sample_uniform;
+
+    constexpr int num_samples = 10000;
+    double        total       = 0;
+    for (int i = 0; i < num_samples; ++i)
+    {
+        double v = sample_uniform(rng);
+        ASSERT_GE(v, 0);
+        ASSERT_LT(v, 1);
+        total += v;
+
+        float f = generate_canonical<float>(rng);
+        ASSERT_GE(f, 0);
+        ASSERT_LT(f, 1);
+    }
+    EXPECT_SOFT_NEAR(0.5, total / num_samples, 0.01);
+
+    // Doubles use two integer draws
+    PhiloxRngEngine first(1, 2, 3, 4);
+    PhiloxRngEngine second(1, 2, 3, 4);
+    const auto      a = second();
+    const auto      b = second();
+    EXPECT_EQ(detail::uint32_pair_to_canonical(a, b),
+              generate_canonical<double>(first));
+}
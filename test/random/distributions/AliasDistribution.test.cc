@@ -0,0 +1,133 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file AliasDistribution.test.cc
+//---------------------------------------------------------------------------//
+#include "random/distributions/AliasDistribution.hh"
+
+#include <random>
+#include "base/Range.hh"
+#include "random/distributions/AliasTableBuilder.hh"
+#include "celeritas_test.hh"
+#include "random/SequenceEngine.hh"
+
+using celeritas::AliasDistribution;
+using celeritas::AliasTableBuilder;
+using celeritas::AliasTableData;
+using celeritas::AliasTableEntry;
+using celeritas::make_span;
+using celeritas::real_type;
+using celeritas::size_type;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class AliasDistributionTest : public celeritas::Test
+{
+  protected:
+    AliasTableData build(std::vector<real_type> weights)
+    {
+        AliasTableBuilder build_table(&entries_);
+        return build_table(make_span(weights));
+    }
+
+    AliasDistribution make_distribution(AliasTableData table) const
+    {
+        return AliasDistribution(entries_[table]);
+    }
+
+    //! Fraction of the table that samples each bin
+    std::vector<real_type> table_pdf(AliasTableData table) const
+    {
+        auto                   entries = entries_[table];
+        std::vector<real_type> result(entries.size(), 0);
+        for (auto i : celeritas::range(entries.size()))
+        {
+            result[i] += entries[i].probability;
+            result[entries[i].alias] += 1 - entries[i].probability;
+        }
+        for (real_type& v : result)
+        {
+            v /= entries.size();
+        }
+        return result;
+    }
+
+    AliasTableBuilder::EntryCollection entries_;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(AliasDistributionTest, build)
+{
+    // Single bin
+    auto single = this->build({2.5});
+    EXPECT_EQ(1, single.size());
+    EXPECT_VEC_SOFT_EQ((std::vector<real_type>{1}), this->table_pdf(single));
+
+    // Uniform
+    auto uniform = this->build({1, 1, 1, 1});
+    EXPECT_EQ(4, uniform.size());
+    for (const AliasTableEntry& e : entries_[uniform])
+    {
+        EXPECT_SOFT_EQ(1, e.probability);
+    }
+
+    // Nonuniform with zero weights
+    std::vector<real_type> weights{0.1, 0, 0.4, 0.2, 0.3, 0};
+    auto                   nonuniform = this->build(weights);
+    EXPECT_EQ(6, nonuniform.size());
+    EXPECT_VEC_SOFT_EQ(weights, this->table_pdf(nonuniform));
+
+    // Tables are appended to the same collection
+    EXPECT_EQ(1 + 4 + 6, entries_.size());
+}
+
+TEST_F(AliasDistributionTest, sample)
+{
+    std::vector<real_type> weights{1, 0, 3, 6, 0.5, 1.5};
+    const real_type        total = 12;
+    auto                   table = this->build(weights);
+
+    std::mt19937           rng;
+    AliasDistribution      sample = this->make_distribution(table);
+    std::vector<size_type> counts(weights.size());
+    const int              num_samples = 12000;
+    for (CELER_MAYBE_UNUSED auto i : celeritas::range(num_samples))
+    {
+        size_type idx = sample(rng);
+        ASSERT_LT(idx, counts.size());
+        ++counts[idx];
+    }
+
+    EXPECT_EQ(0, counts[1]);
+    for (auto i : celeritas::range(weights.size()))
+    {
+        EXPECT_SOFT_NEAR(weights[i] / total,
+                         real_type(counts[i]) / num_samples,
+                         0.05)
+            << "for bin " << i;
+    }
+}
+
+TEST_F(AliasDistributionTest, edges)
+{
+    auto              table  = this->build({1, 3});
+    AliasDistribution sample = this->make_distribution(table);
+    EXPECT_EQ(2, sample.size());
+
+    // Canonical values at the extremes of the range
+    auto rng = celeritas_test::SequenceEngine::from_reals(
+        {0.0, 1 - 1e-15, 0.24, 0.26, 0.5, 0.99});
+    EXPECT_EQ(0, sample(rng));
+    EXPECT_EQ(1, sample(rng));
+    EXPECT_EQ(0, sample(rng));
+    EXPECT_EQ(1, sample(rng));
+    EXPECT_EQ(1, sample(rng));
+    EXPECT_EQ(1, sample(rng));
+}
@@ -15,6 +15,7 @@
 #include "physics/base/ParticleParams.hh"
 #include "physics/material/MaterialParams.hh"
 #include "random/RngParams.hh"
+#include "sim/TrackInitOverflow.hh"
 #include "sim/TrackInitParams.hh"
 #include "sim/TrackInterface.hh"
 #include "TrackInit.test.hh"
@@ -312,5 +313,52 @@ TEST_F(TrackInitTest, secondaries)
     }
 }
 
+TEST_F(TrackInitTest, overflow)
+{
+    const size_type num_primaries  = 512;
+    const size_type num_tracks     = 512;
+    const size_type storage_factor = 1;
+
+    build_params(num_primaries, storage_factor);
+    build_states(num_tracks, storage_factor);
+    TrackInitOverflow overflow;
+
+    extend_from_primaries(init_params->host_pointers(), &init);
+    initialize_tracks(params, states, &init, &overflow);
+
+    // Every track survives and produces a secondary, so the initializers
+    // exceed the capacity after the second step
+    std::vector<size_type> alloc(num_tracks, 1);
+    std::vector<char>      alive(num_tracks, 1);
+    ITTestInput            input(alloc, alive);
+    for (int i = 0; i < 3; ++i)
+    {
+        secondaries
+            = CollectionStateStore<SecondaryAllocatorData, MemSpace::device>(
+                num_tracks);
+        interact(states, secondaries.ref(), input.device_pointers());
+        extend_from_secondaries(params, states, &init, &overflow);
+        initialize_tracks(params, states, &init, &overflow);
+    }
+    EXPECT_EQ(num_tracks, init.initializers.size());
+    EXPECT_EQ(2 * num_tracks, overflow.size());
+
+    // Kill all the tracks without producing secondaries: the buffered
+    // initializers are restored as the track slots are vacated
+    std::vector<size_type> no_alloc(num_tracks, 0);
+    std::vector<char>      dead(num_tracks, 0);
+    ITTestInput            kill(no_alloc, dead);
+    size_type              num_steps = 0;
+    while (init.initializers.size() > 0 || !overflow.empty())
+    {
+        interact(states, secondaries.ref(), kill.device_pointers());
+        extend_from_secondaries(params, states, &init, &overflow);
+        initialize_tracks(params, states, &init, &overflow);
+        ++num_steps;
+    }
+    EXPECT_EQ(3, num_steps);
+    EXPECT_EQ(2 * num_tracks, overflow.max_size());
+}
+
 //---------------------------------------------------------------------------//
 } // namespace celeritas_test
@@ -0,0 +1,119 @@
+//----------------------------------*-C++-*----------------------------------//
+// Copyright 2021 UT-Battelle, LLC, and other Celeritas developers.
+// See the top-level COPYRIGHT file for details.
+// SPDX-License-Identifier: (Apache-2.0 OR MIT)
+//---------------------------------------------------------------------------//
+//! \file TrackInitOverflow.test.cc
+//---------------------------------------------------------------------------//
+#include "sim/TrackInitOverflow.hh"
+
+#include <vector>
+#include "base/CollectionBuilder.hh"
+#include "base/Range.hh"
+#include "celeritas_test.hh"
+
+using namespace celeritas;
+
+//---------------------------------------------------------------------------//
+// TEST HARNESS
+//---------------------------------------------------------------------------//
+
+class TrackInitOverflowTest : public celeritas::Test
+{
+  protected:
+    using Initializers
+        = ResizableData<TrackInitializer, Ownership::value, MemSpace::host>;
+
+    void SetUp() override
+    {
+        make_builder(&inits.storage).resize(6);
+        inits.resize(0);
+    }
+
+    // Push initializers with the given track IDs onto the back of the stack
+    void push(std::vector<unsigned int> ids)
+    {
+        for (auto id : ids)
+        {
+            inits.resize(inits.size() + 1);
+            inits.storage[ThreadId{inits.size() - 1}].sim.track_id = TrackId{id};
+        }
+    }
+
+    // Get the track IDs of the initializers, bottom to top
+    std::vector<unsigned int> track_ids() const
+    {
+        std::vector<unsigned int> result;
+        for (auto i : range(ThreadId{inits.size()}))
+        {
+            result.push_back(inits.storage[i].sim.track_id.unchecked_get());
+        }
+        return result;
+    }
+
+    // Host storage stands in for device memory
+    Initializers      inits;
+    TrackInitOverflow overflow;
+};
+
+//---------------------------------------------------------------------------//
+// TESTS
+//---------------------------------------------------------------------------//
+
+TEST_F(TrackInitOverflowTest, spill_restore)
+{
+    this->push({0, 1, 2, 3, 4});
+
+    // Spill the oldest initializers
+    overflow.spill(3, &inits);
+    EXPECT_EQ(3, overflow.size());
+    {
+        const unsigned int expected[] = {3, 4};
+        EXPECT_VEC_EQ(expected, this->track_ids());
+    }
+
+    // Fill the storage with new initializers: nothing can be restored
+    this->push({5, 6, 7, 8});
+    EXPECT_EQ(0, overflow.restore(&inits));
+
+    // Consume some initializers and spill again
+    inits.resize(3);
+    overflow.spill(2, &inits);
+    EXPECT_EQ(5, overflow.size());
+    EXPECT_EQ(5, overflow.max_size());
+    {
+        const unsigned int expected[] = {5};
+        EXPECT_VEC_EQ(expected, this->track_ids());
+    }
+
+    // Restore as many as fit, preserving the original order
+    EXPECT_EQ(5, overflow.restore(&inits));
+    EXPECT_TRUE(overflow.empty());
+    {
+        const unsigned int expected[] = {0, 1, 2, 3, 4, 5};
+        EXPECT_VEC_EQ(expected, this->track_ids());
+    }
+}
+
+TEST_F(TrackInitOverflowTest, partial_restore)
+{
+    this->push({0, 1, 2, 3, 4, 5});
+    overflow.spill(6, &inits);
+    EXPECT_EQ(0, inits.size());
+
+    this->push({6, 7, 8, 9});
+    EXPECT_EQ(2, overflow.restore(&inits));
+    EXPECT_EQ(4, overflow.size());
+    {
+        const unsigned int expected[] = {4, 5, 6, 7, 8, 9};
+        EXPECT_VEC_EQ(expected, this->track_ids());
+    }
+
+    inits.resize(0);
+    EXPECT_EQ(4, overflow.restore(&inits));
+    {
+        const unsigned int expected[] = {0, 1, 2, 3};
+        EXPECT_VEC_EQ(expected, this->track_ids());
+    }
+    EXPECT_EQ(6, overflow.max_size());
+}